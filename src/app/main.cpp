@@ -15,15 +15,38 @@
  */
 
 #include <QApplication>
+#include <QCommandLineParser>
 #include <QMessageBox>
 #include <QSqlDatabase>
 #include <QSqlQuery>
+#include <QStandardPaths>
+#include <QTimer>
 #include <QDebug>
+#include <cstring>
 #include "MainWindow.h"
 #include "LoginDialog.h"
+#include "StyleSheet.h"
+#include "StartupProfiler.h"
 #include "database.h"
+#include "backup.h"
+#include "maintenance.h"
+
+using firewood::core::StartupProfiler;
+
+static const char *kExitAfterFirstPaint = "--exit-after-first-paint";
 
 int main(int argc, char *argv[]) {
+    StartupProfiler &profiler = StartupProfiler::instance();
+
+    // The headless benchmark has to pick the platform before QApplication exists
+    bool headless = false;
+    for (int i = 1; i < argc; ++i) {
+        headless = headless || std::strcmp(argv[i], kExitAfterFirstPaint) == 0;
+    }
+    if (headless && qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
     QApplication app(argc, argv);
     
     qDebug() << "Starting Firewood Bank application...";
@@ -33,22 +56,68 @@ int main(int argc, char *argv[]) {
     app.setApplicationVersion("0.1.0");
     app.setOrganizationName("Firewood Bank");
     
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Firewood Bank Management System");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    QCommandLineOption profileOption("startup-profile",
+        "Write the startup phase breakdown to this JSON file (default: startup_profile.json in the app data folder).",
+        "path");
+    QCommandLineOption exitOption(QString::fromLatin1(kExitAfterFirstPaint).mid(2),
+        "Headless startup benchmark: sign in as --user with the password in FIREWOOD_PASSWORD, "
+        "exit once the main window has painted its first frame.");
+    QCommandLineOption userOption("user", "Account to sign in with when benchmarking startup.", "username");
+    QCommandLineOption databaseOption("database", "Open this database file instead of the default one.", "path");
+    parser.addOptions({profileOption, exitOption, userOption, databaseOption});
+    parser.process(app);
+    profiler.mark("Qt application");
+    
+    // One stylesheet for every window; widgets select variants by property
+    app.setStyleSheet(AdobeStyles::applicationStyleSheet());
+    profiler.mark("application stylesheet");
+    
     // Open database connection
-    QSqlDatabase db = firewood::db::openDefaultConnection();
+    QSqlDatabase db = parser.isSet(databaseOption)
+        ? firewood::db::openConnection(parser.value(databaseOption))
+        : firewood::db::openDefaultConnection();
     if (!db.isOpen()) {
         qDebug() << "CRITICAL: Failed to open database connection!";
         QMessageBox::critical(nullptr, "Database Error", 
                              "Failed to open database connection. The application cannot continue.");
         return 1;
     }
+    profiler.mark("database open and migrations");
+    
+    profiler.setOutputPath(parser.isSet(profileOption)
+        ? parser.value(profileOption)
+        : QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/startup_profile.json");
+    
+    // Online backups run in the background for the whole session (not per login)
+    firewood::db::BackupScheduler backupScheduler(db.databaseName());
+    backupScheduler.start();
+    
+    // ANALYZE / optimize / vacuum / quick_check while nobody is using the app
+    firewood::db::MaintenanceScheduler maintenanceScheduler(db.databaseName());
+    maintenanceScheduler.start();
+    profiler.mark("background schedulers");
     
     // Login/logout loop - allows users to logout and login again without restarting app
     while (true) {
         // Show login dialog
         LoginDialog loginDialog;
-        if (loginDialog.exec() != QDialog::Accepted) {
-            qDebug() << "Login cancelled or failed. Exiting application.";
-            return 0;
+        profiler.mark("login dialog");
+        if (headless) {
+            if (!loginDialog.loginWith(parser.value(userOption), qEnvironmentVariable("FIREWOOD_PASSWORD"))) {
+                qCritical() << "Startup benchmark could not sign in; pass --user and set FIREWOOD_PASSWORD";
+                return 1;
+            }
+            profiler.mark("sign in");
+        } else {
+            if (loginDialog.exec() != QDialog::Accepted) {
+                qDebug() << "Login cancelled or failed. Exiting application.";
+                return 0;
+            }
+            profiler.markWaiting("sign in");
         }
         
         QString username = loginDialog.getUsername();
@@ -61,7 +130,7 @@ int main(int argc, char *argv[]) {
         
         // Query full name from database
         QSqlQuery query(db);
-        query.prepare("SELECT full_name FROM users WHERE username = :username");
+        query.prepare("SELECT full_name FROM user_accounts WHERE username = :username");
         query.bindValue(":username", username);
         if (query.exec() && query.next()) {
             QString dbFullName = query.value(0).toString();
@@ -69,6 +138,7 @@ int main(int argc, char *argv[]) {
                 fullName = dbFullName;
             }
         }
+        profiler.mark("full name lookup");
         
         // Create and show main window after successful login
         MainWindow *window = new MainWindow(username, fullName, userType);
@@ -85,6 +155,11 @@ int main(int argc, char *argv[]) {
             userLoggedOut = true;
         });
         
+        if (headless) {
+            // The profile is written when the first frame is painted
+            QObject::connect(window, &MainWindow::firstFramePainted, &app, &QCoreApplication::quit);
+        }
+        
         window->show();
         qDebug() << "Application started successfully";
         
@@ -95,7 +170,7 @@ int main(int argc, char *argv[]) {
         delete window;
         
         // If user didn't logout (closed window instead), exit the application
-        if (!userLoggedOut) {
+        if (!userLoggedOut || headless) {
             qDebug() << "Window closed without logout. Exiting application.";
             return 0;
         }
@@ -2,121 +2,94 @@
 
 namespace firewood::core {
 
-bool Authorization::hasPermission(const QString &userType, Permission permission)
+namespace {
+
+constexpr bool allRowsValid()
 {
-    QString typeLower = userType.toLower();
-    
-    // Admin has all permissions
-    if (typeLower == "admin") {
-        return true;
-    }
-    
-    // Lead permissions (between Admin and Employee)
-    // Leads can do everything except manage users and system settings
-    if (typeLower == "lead") {
-        switch (permission) {
-            case Permission::ManageUsers:
-            case Permission::ManageSystemSettings:
-                return false;  // Only admins can do these
-            case Permission::EditInventory:  // KEY: Leads CAN edit inventory
-            case Permission::ManageAllInventory:
-            case Permission::ViewClients:
-            case Permission::EditClients:
-            case Permission::ManageAllClients:
-            case Permission::AddOrders:
-            case Permission::EditOrders:
-            case Permission::ManageAllOrders:
-            case Permission::ViewInventory:
-            case Permission::ManageAgencies:
-            case Permission::ManageAllVolunteers:
-            case Permission::ViewAllReports:
-                return true;
-            default:
-                return false;
-        }
-    }
-    
-    // Employee permissions
-    // NOTE: Employees can VIEW inventory but NOT EDIT
-    if (typeLower == "employee") {
-        switch (permission) {
-            case Permission::ViewClients:
-            case Permission::EditClients:
-            case Permission::AddOrders:
-            case Permission::EditOrders:
-            case Permission::ViewInventory:  // Can view
-                return true;
-            case Permission::EditInventory:   // CANNOT edit (only Leads and Admins)
-            case Permission::ManageAllInventory:
-                return false;
-            default:
-                return false;
+    for (const char *row : detail::PermissionMatrix) {
+        if (!detail::isValidPermissionRow(row)) {
+            return false;
         }
     }
-    
-    // Volunteer permissions (can be both client and volunteer)
-    if (typeLower == "volunteer") {
-        switch (permission) {
-            case Permission::ViewOwnInfo:
-            case Permission::EditOwnInfo:
-            case Permission::ViewClients:  // Can view client info (including their own)
-                return true;
-            default:
-                return false;
-        }
-    }
-    
-    // Client permissions (very restricted - no login access)
-    if (typeLower == "client") {
-        return false;  // Clients cannot login, so no permissions
-    }
-    
-    return false;
+    return true;
+}
+
+constexpr std::uint32_t allPermissions = (std::uint32_t(1) << detail::PermissionCount) - 1;
+
+using P = Authorization::Permission;
+
+static_assert(detail::PermissionCount < 32, "Permission masks are 32 bits wide");
+static_assert(detail::RoleCount == static_cast<std::size_t>(code(UserType::Client)),
+              "PermissionMatrix needs one row per UserType");
+static_assert(allRowsValid(), "Every PermissionMatrix row needs one 'Y' or '-' per Permission");
+
+static_assert(Authorization::permissionMask(UserType::Admin) == allPermissions, "Admins have every permission");
+static_assert(Authorization::permissionMask(UserType::Client) == 0, "Clients cannot log in");
+static_assert(!Authorization::hasPermission(UserType::Lead, P::ManageUsers)
+              && !Authorization::hasPermission(UserType::Lead, P::ManageSystemSettings),
+              "Only admins manage users and system settings");
+static_assert(Authorization::hasPermission(UserType::Lead, P::EditInventory)
+              && Authorization::hasPermission(UserType::Employee, P::ViewInventory)
+              && !Authorization::hasPermission(UserType::Employee, P::EditInventory),
+              "Employees view inventory; leads and admins edit it");
+static_assert(Authorization::hasPermission(UserType::Volunteer, P::EditOwnInfo)
+              && !Authorization::hasPermission(UserType::Volunteer, P::EditClients),
+              "Volunteers edit only their own information");
+
+} // namespace
+
+bool Authorization::hasPermission(const QString &userType, Permission permission)
+{
+    return hasPermission(parseUserType(userType), permission);
 }
 
 bool Authorization::isAdmin(const QString &userType)
 {
-    return userType.toLower() == "admin";
+    return parseUserType(userType) == UserType::Admin;
 }
 
 bool Authorization::isLead(const QString &userType)
 {
-    return userType.toLower() == "lead";
+    return parseUserType(userType) == UserType::Lead;
 }
 
 bool Authorization::isEmployee(const QString &userType)
 {
-    return userType.toLower() == "employee";
+    return parseUserType(userType) == UserType::Employee;
 }
 
 bool Authorization::isVolunteer(const QString &userType)
 {
-    return userType.toLower() == "volunteer";
+    return parseUserType(userType) == UserType::Volunteer;
 }
 
 bool Authorization::isClient(const QString &userType)
 {
-    return userType.toLower() == "client";
+    return parseUserType(userType) == UserType::Client;
 }
 
 bool Authorization::canLogin(const QString &userType)
 {
-    QString typeLower = userType.toLower();
     // Only admin, lead, employee, and volunteer can login
     // Clients cannot login (they don't have usernames/passwords)
-    return typeLower == "admin" || typeLower == "lead" || 
-           typeLower == "employee" || typeLower == "volunteer";
+    const std::optional<UserType> type = parseUserType(userType);
+    return type && *type != UserType::Client;
 }
 
 QString Authorization::getUserTypeDisplayName(const QString &userType)
 {
-    QString typeLower = userType.toLower();
-    if (typeLower == "admin") return "Administrator";
-    if (typeLower == "lead") return "Team Lead";
-    if (typeLower == "employee") return "Employee";
-    if (typeLower == "volunteer") return "Volunteer";
-    if (typeLower == "client") return "Client";
-    return userType; // Return original if unknown
+    const std::optional<UserType> type = parseUserType(userType);
+    if (!type) {
+        return userType; // Return original if unknown
+    }
+    switch (*type) {
+        case UserType::Admin: return "Administrator";
+        case UserType::Lead: return "Team Lead";
+        case UserType::Employee: return "Employee";
+        case UserType::Volunteer: return "Volunteer";
+        case UserType::Client: return "Client";
+    }
+    return userType;
 }
 
 QString Authorization::getPermissionDescription(Permission permission)
@@ -1,6 +1,11 @@
 #pragma once
 
+#include "Codes.h"
 #include <QString>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <optional>
 
 namespace firewood::core {
 
@@ -30,12 +35,24 @@ public:
         
         // Volunteer permissions
         ViewOwnInfo,
-        EditOwnInfo
+        EditOwnInfo,
+
+        Count  // Number of permissions; keep last
     };
     
     /**
-     * @brief Check if a user type has a specific permission
+     * @brief Bit set of the permissions granted to a user type (bit n = Permission n)
+     */
+    static constexpr std::uint32_t permissionMask(UserType type);
+
+    /**
+     * @brief Check if a user type has a specific permission (a single bit test)
+     *
+     * Parse the user type once with parseUserType() and keep the result; the QString
+     * overload parses on every call.
      */
+    static constexpr bool hasPermission(UserType type, Permission permission);
+    static constexpr bool hasPermission(std::optional<UserType> type, Permission permission);
     static bool hasPermission(const QString &userType, Permission permission);
     
     /**
@@ -79,5 +96,66 @@ public:
     static QString getPermissionDescription(Permission permission);
 };
 
+namespace detail {
+
+// One character per Authorization::Permission in declaration order: 'Y' granted,
+// '-' denied. Rows follow UserType code order. Checked by static_asserts in
+// Authorization.cpp, so a row of the wrong length fails to compile.
+inline constexpr const char *PermissionMatrix[] = {
+    //  Manage/Reports  Staff     Own
+    "YYYYYYYY"       "YYYYYY"  "YY",   // Admin
+    "-YYYYYY-"       "YYYYYY"  "--",   // Lead: everything except users and system settings
+    "--------"       "YYYYY-"  "--",   // Employee: can view but not edit inventory
+    "--------"       "Y-----"  "YY",   // Volunteer
+    "--------"       "------"  "--"    // Client: cannot log in
+};
+
+inline constexpr int PermissionCount = static_cast<int>(Authorization::Permission::Count);
+inline constexpr std::size_t RoleCount = std::size(PermissionMatrix);
+
+constexpr bool isValidPermissionRow(const char *row)
+{
+    int length = 0;
+    for (; row[length] != '\0'; ++length) {
+        if (row[length] != 'Y' && row[length] != '-') {
+            return false;
+        }
+    }
+    return length == PermissionCount;
+}
+
+constexpr std::array<std::uint32_t, RoleCount> buildPermissionMasks()
+{
+    std::array<std::uint32_t, RoleCount> masks{};
+    for (std::size_t role = 0; role < RoleCount; ++role) {
+        for (int permission = 0; permission < PermissionCount; ++permission) {
+            if (PermissionMatrix[role][permission] == 'Y') {
+                masks[role] |= std::uint32_t(1) << permission;
+            }
+        }
+    }
+    return masks;
+}
+
+inline constexpr std::array<std::uint32_t, RoleCount> PermissionMasks = buildPermissionMasks();
+
+} // namespace detail
+
+constexpr std::uint32_t Authorization::permissionMask(UserType type)
+{
+    const int row = code(type) - 1;
+    return row >= 0 && row < static_cast<int>(detail::RoleCount) ? detail::PermissionMasks[row] : 0;
+}
+
+constexpr bool Authorization::hasPermission(UserType type, Permission permission)
+{
+    return (permissionMask(type) >> static_cast<int>(permission)) & 1u;
+}
+
+constexpr bool Authorization::hasPermission(std::optional<UserType> type, Permission permission)
+{
+    return type && hasPermission(*type, permission);
+}
+
 } // namespace firewood::core
 
@@ -0,0 +1,180 @@
+#include "BookkeepingPivot.h"
+#include <algorithm>
+
+namespace firewood::core {
+
+namespace {
+
+QString rowKey(const QString &name, BookkeepingPivot::Kind kind)
+{
+    return (kind == BookkeepingPivot::Kind::Income ? "i:" : "e:") + name;
+}
+
+} // namespace
+
+BookkeepingPivot::BookkeepingPivot(const DateRange &period)
+    : m_period(period)
+{
+    if (!period.isValid()) {
+        return;
+    }
+
+    const QDate firstMonth = period.first().addDays(1 - period.first().day());
+    m_monthCount = (period.last().year() - firstMonth.year()) * 12 + period.last().month() - firstMonth.month() + 1;
+
+    m_monthEndDays.reserve(m_monthCount);
+    for (int month = 0; month < m_monthCount; ++month) {
+        m_monthEndDays.push_back(DateRange::dayNumber(firstMonth.addMonths(month + 1)));
+    }
+}
+
+int BookkeepingPivot::monthIndex(const QDate &date) const
+{
+    return date.isValid() ? monthIndexForDay(DateRange::dayNumber(date)) : -1;
+}
+
+int BookkeepingPivot::monthIndexForDay(qint64 dayNumber) const
+{
+    if (m_monthCount == 0 || dayNumber < m_period.firstDay() || dayNumber >= m_period.endDay()) {
+        return -1;
+    }
+    const auto it = std::upper_bound(m_monthEndDays.begin(), m_monthEndDays.end(), dayNumber);
+    return static_cast<int>(it - m_monthEndDays.begin());
+}
+
+int BookkeepingPivot::addCategory(const QString &name, Kind kind, Money annualBudget)
+{
+    const QString key = rowKey(name, kind);
+    const auto existing = m_rowByKey.constFind(key);
+    if (existing != m_rowByKey.constEnd()) {
+        return existing.value();
+    }
+
+    const int row = m_categories.size();
+    m_categories.append({name, kind, annualBudget});
+    m_rowByKey.insert(key, row);
+    m_cells.resize(static_cast<size_t>(m_categories.size()) * m_monthCount, 0);
+
+    // Totals no longer cover every row
+    m_running.clear();
+    m_rowTotals.clear();
+    m_monthTotals.clear();
+    m_runningTotals.clear();
+    return row;
+}
+
+int BookkeepingPivot::categoryIndex(const QString &name, Kind kind) const
+{
+    return m_rowByKey.value(rowKey(name, kind), -1);
+}
+
+void BookkeepingPivot::add(int row, int month, Money amount)
+{
+    if (row < 0 || row >= m_categories.size() || month < 0 || month >= m_monthCount) {
+        return;
+    }
+    m_cells[cellIndex(row, month)] += amount.cents();
+}
+
+void BookkeepingPivot::finalize()
+{
+    const int rows = m_categories.size();
+    m_running.assign(m_cells.size(), 0);
+    m_rowTotals.assign(rows, 0);
+    m_monthTotals.assign(2 * m_monthCount, 0);
+    m_runningTotals.assign(2 * m_monthCount, 0);
+
+    for (int row = 0; row < rows; ++row) {
+        const int kind = kindIndex(m_categories[row].kind);
+        qint64 running = 0;
+        for (int month = 0; month < m_monthCount; ++month) {
+            const qint64 cents = m_cells[cellIndex(row, month)];
+            running += cents;
+            m_running[cellIndex(row, month)] = running;
+            m_monthTotals[kind * m_monthCount + month] += cents;
+        }
+        m_rowTotals[row] = running;
+    }
+
+    for (int kind = 0; kind < 2; ++kind) {
+        qint64 running = 0;
+        for (int month = 0; month < m_monthCount; ++month) {
+            running += m_monthTotals[kind * m_monthCount + month];
+            m_runningTotals[kind * m_monthCount + month] = running;
+        }
+    }
+}
+
+Money BookkeepingPivot::categoryTotal(int row) const
+{
+    if (row < 0 || row >= static_cast<int>(m_rowTotals.size())) {
+        return Money();
+    }
+    return Money::fromCents(m_rowTotals[row]);
+}
+
+Money BookkeepingPivot::monthTotal(Kind kind, int month) const
+{
+    if (month < 0 || month >= m_monthCount || m_monthTotals.empty()) {
+        return Money();
+    }
+    return Money::fromCents(m_monthTotals[kindIndex(kind) * m_monthCount + month]);
+}
+
+Money BookkeepingPivot::total(Kind kind) const
+{
+    return yearToDateTotal(kind, m_monthCount - 1);
+}
+
+Money BookkeepingPivot::yearToDate(int row, int throughMonth) const
+{
+    if (throughMonth < 0 || m_running.empty()) {
+        return Money();
+    }
+    throughMonth = std::min(throughMonth, m_monthCount - 1);
+    return Money::fromCents(m_running[cellIndex(row, throughMonth)]);
+}
+
+Money BookkeepingPivot::yearToDateTotal(Kind kind, int throughMonth) const
+{
+    if (throughMonth < 0 || m_runningTotals.empty()) {
+        return Money();
+    }
+    throughMonth = std::min(throughMonth, m_monthCount - 1);
+    return Money::fromCents(m_runningTotals[kindIndex(kind) * m_monthCount + throughMonth]);
+}
+
+Money BookkeepingPivot::monthOverMonth(int row, int month) const
+{
+    const Money previous = month > 0 ? amount(row, month - 1) : Money();
+    return amount(row, month) - previous;
+}
+
+Money BookkeepingPivot::monthOverMonthTotal(Kind kind, int month) const
+{
+    return monthTotal(kind, month) - monthTotal(kind, month - 1);
+}
+
+Money BookkeepingPivot::budgetToDate(int row, int throughMonth) const
+{
+    if (throughMonth < 0) {
+        return Money();
+    }
+    const qint64 months = std::min(throughMonth + 1, 12);
+    // Round to the nearest cent, halves away from zero
+    const qint64 scaled = m_categories[row].annualBudget.cents() * months;
+    return Money::fromCents(scaled >= 0 ? (scaled + 6) / 12 : (scaled - 6) / 12);
+}
+
+Money BookkeepingPivot::budgetVariance(int row, int throughMonth) const
+{
+    const Category &entry = m_categories[row];
+    if (entry.annualBudget.isZero()) {
+        return Money();
+    }
+    const Money budget = budgetToDate(row, throughMonth);
+    const Money actual = yearToDate(row, throughMonth);
+    return entry.kind == Kind::Expense ? budget - actual : actual - budget;
+}
+
+} // namespace firewood::core
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "DateRange.h"
+#include "Money.h"
+#include <QDate>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <vector>
+
+namespace firewood::core {
+
+/**
+ * @brief Income and expense totals by category and month for one period
+ *
+ * Amounts are kept in a dense category x month array of cents, filled once by
+ * add() and then finished with finalize(), which builds the row and column totals
+ * and the running (year-to-date) sums. Every figure the bookkeeping views show is
+ * then a lookup or a subtraction, so switching views never goes back to the
+ * database. Months are counted from the first month of the period (0 = July for
+ * the default fiscal year).
+ */
+class BookkeepingPivot {
+public:
+    enum class Kind { Income, Expense };
+
+    struct Category {
+        QString name;             // income.source or expenses.category
+        Kind kind = Kind::Expense;
+        Money annualBudget;       // budget_categories.annual_budget; zero if unbudgeted
+    };
+
+    BookkeepingPivot() = default;
+
+    /**
+     * @brief Empty pivot with one column per calendar month the period touches
+     */
+    explicit BookkeepingPivot(const DateRange &period);
+
+    DateRange period() const { return m_period; }
+    int monthCount() const { return m_monthCount; }
+    int categoryCount() const { return m_categories.size(); }
+
+    /**
+     * @brief First day of a month column
+     */
+    QDate monthStart(int month) const { return m_period.first().addDays(1 - m_period.first().day()).addMonths(month); }
+
+    /**
+     * @brief Column for a date, or -1 if it is outside the period
+     */
+    int monthIndex(const QDate &date) const;
+
+    /**
+     * @brief Column for a day number (the *_day columns), or -1 if outside the period
+     */
+    int monthIndexForDay(qint64 dayNumber) const;
+
+    /**
+     * @brief Row for a category, adding it (unbudgeted) if it is new
+     *
+     * Only call before finalize(); adding a row afterwards discards the totals.
+     */
+    int addCategory(const QString &name, Kind kind, Money annualBudget = Money());
+    int categoryIndex(const QString &name, Kind kind) const;
+    const Category &category(int row) const { return m_categories[row]; }
+
+    void add(int row, int month, Money amount);
+
+    /**
+     * @brief Builds totals and running sums; call once after the last add()
+     */
+    void finalize();
+
+    Money amount(int row, int month) const { return Money::fromCents(m_cells[cellIndex(row, month)]); }
+    Money categoryTotal(int row) const;
+    Money monthTotal(Kind kind, int month) const;
+    Money total(Kind kind) const;
+    Money net(int month) const { return monthTotal(Kind::Income, month) - monthTotal(Kind::Expense, month); }
+    Money netTotal() const { return total(Kind::Income) - total(Kind::Expense); }
+
+    /**
+     * @brief Sum from the first month through the given month, inclusive
+     */
+    Money yearToDate(int row, int throughMonth) const;
+    Money yearToDateTotal(Kind kind, int throughMonth) const;
+
+    /**
+     * @brief Change from the previous month; the first month compares with zero
+     */
+    Money monthOverMonth(int row, int month) const;
+    Money monthOverMonthTotal(Kind kind, int month) const;
+
+    /**
+     * @brief Share of the annual budget for the months through the given month
+     */
+    Money budgetToDate(int row, int throughMonth) const;
+
+    /**
+     * @brief Budget to date against actual to date; positive is favourable
+     *
+     * For expenses that is spending under budget, for income receipts ahead of it.
+     * Categories without a budget report zero.
+     */
+    Money budgetVariance(int row, int throughMonth) const;
+
+private:
+    int cellIndex(int row, int month) const { return row * m_monthCount + month; }
+    int kindIndex(Kind kind) const { return kind == Kind::Income ? 0 : 1; }
+
+    DateRange m_period;
+    int m_monthCount = 0;
+    std::vector<qint64> m_monthEndDays;     // Exclusive end day number of each month column
+
+    QList<Category> m_categories;
+    QHash<QString, int> m_rowByKey;         // "<kind>:<name>" -> row
+
+    std::vector<qint64> m_cells;            // Row-major, categoryCount x monthCount
+    std::vector<qint64> m_running;          // Running sum along each row
+    std::vector<qint64> m_rowTotals;
+    std::vector<qint64> m_monthTotals;      // [kind][month]
+    std::vector<qint64> m_runningTotals;    // [kind][month], running
+};
+
+} // namespace firewood::core
@@ -0,0 +1,293 @@
+#include "ClientMatch.h"
+#include <QHash>
+#include <QSet>
+#include <algorithm>
+
+namespace firewood::core {
+
+namespace {
+
+// Lowercase words with accents, apostrophes and other punctuation removed
+QStringList foldedWords(const QString &text)
+{
+    const QString decomposed = text.normalized(QString::NormalizationForm_KD).toLower();
+    QString folded;
+    folded.reserve(decomposed.size());
+    for (const QChar ch : decomposed) {
+        if (ch.isLetterOrNumber()) {
+            folded += ch;
+        } else if (ch == QLatin1Char('\'') || ch == QChar(0x2019) || ch.category() == QChar::Mark_NonSpacing) {
+            continue;   // O'Brien and OBrien, José and Jose
+        } else {
+            folded += QLatin1Char(' ');
+        }
+    }
+    return folded.split(QLatin1Char(' '), Qt::SkipEmptyParts);
+}
+
+// Common short forms of given names, mapped to one spelling
+const QHash<QString, QString> &givenNames()
+{
+    static const QHash<QString, QString> names = {
+        {"jon", "john"}, {"johnny", "john"}, {"jonathan", "john"},
+        {"bill", "william"}, {"billy", "william"}, {"will", "william"}, {"willy", "william"},
+        {"bob", "robert"}, {"bobby", "robert"}, {"rob", "robert"}, {"robbie", "robert"},
+        {"jim", "james"}, {"jimmy", "james"}, {"jamie", "james"},
+        {"mike", "michael"}, {"mikey", "michael"},
+        {"dave", "david"}, {"davey", "david"},
+        {"rick", "richard"}, {"ricky", "richard"}, {"dick", "richard"}, {"rich", "richard"},
+        {"tom", "thomas"}, {"tommy", "thomas"},
+        {"joe", "joseph"}, {"joey", "joseph"},
+        {"chuck", "charles"}, {"charlie", "charles"},
+        {"ed", "edward"}, {"eddie", "edward"}, {"ted", "edward"},
+        {"dan", "daniel"}, {"danny", "daniel"},
+        {"steve", "steven"}, {"stephen", "steven"},
+        {"chris", "christopher"},
+        {"tony", "anthony"}, {"larry", "lawrence"}, {"jerry", "gerald"},
+        {"ron", "ronald"}, {"ronnie", "ronald"}, {"don", "donald"}, {"donnie", "donald"},
+        {"doug", "douglas"}, {"greg", "gregory"}, {"jeff", "jeffrey"}, {"geoff", "jeffrey"},
+        {"matt", "matthew"}, {"nick", "nicholas"}, {"sam", "samuel"}, {"ben", "benjamin"},
+        {"andy", "andrew"}, {"drew", "andrew"}, {"ken", "kenneth"}, {"kenny", "kenneth"},
+        {"liz", "elizabeth"}, {"beth", "elizabeth"}, {"betty", "elizabeth"}, {"libby", "elizabeth"},
+        {"kathy", "katherine"}, {"kate", "katherine"}, {"katie", "katherine"},
+        {"catherine", "katherine"}, {"kathryn", "katherine"},
+        {"peggy", "margaret"}, {"maggie", "margaret"}, {"meg", "margaret"},
+        {"sue", "susan"}, {"susie", "susan"}, {"barb", "barbara"},
+        {"deb", "deborah"}, {"debbie", "deborah"}, {"debra", "deborah"},
+        {"jen", "jennifer"}, {"jenny", "jennifer"}, {"sandy", "sandra"},
+        {"patty", "patricia"}, {"trish", "patricia"}, {"cindy", "cynthia"},
+        {"vicky", "victoria"}, {"becky", "rebecca"}, {"mandy", "amanda"}
+    };
+    return names;
+}
+
+// Titles and generational suffixes; "and" joins couples ("John and Mary Smith")
+const QSet<QString> &ignoredNameWords()
+{
+    static const QSet<QString> words = {"mr", "mrs", "ms", "miss", "dr", "jr", "sr", "ii", "iii", "and"};
+    return words;
+}
+
+// USPS standard abbreviations for street suffixes, directions and units
+const QHash<QString, QString> &addressWords()
+{
+    static const QHash<QString, QString> words = {
+        {"road", "rd"}, {"street", "st"}, {"str", "st"}, {"avenue", "ave"}, {"av", "ave"},
+        {"drive", "dr"}, {"lane", "ln"}, {"court", "ct"}, {"circle", "cir"}, {"place", "pl"},
+        {"boulevard", "blvd"}, {"highway", "hwy"}, {"route", "rte"}, {"rt", "rte"},
+        {"terrace", "ter"}, {"parkway", "pkwy"}, {"trail", "trl"}, {"square", "sq"},
+        {"extension", "ext"}, {"point", "pt"}, {"mountain", "mtn"}, {"county", "co"},
+        {"north", "n"}, {"south", "s"}, {"east", "e"}, {"west", "w"},
+        {"northeast", "ne"}, {"northwest", "nw"}, {"southeast", "se"}, {"southwest", "sw"},
+        {"apartment", "apt"}, {"suite", "ste"}, {"number", "no"}
+    };
+    return words;
+}
+
+QString joinedSorted(QStringList words)
+{
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    return words.join(QLatin1Char(' '));
+}
+
+} // namespace
+
+QStringList nameTokens(const QString &name)
+{
+    const QStringList words = foldedWords(name);
+    QStringList tokens;
+    QStringList initials;
+    for (const QString &word : words) {
+        if (ignoredNameWords().contains(word)) {
+            continue;
+        }
+        // Middle initials are often left out; keep them only if nothing else is left
+        if (word.size() == 1 && word.at(0).isLetter()) {
+            initials << word;
+            continue;
+        }
+        tokens << givenNames().value(word, word);
+    }
+    return tokens.isEmpty() ? initials : tokens;
+}
+
+QString canonicalAddress(const QString &address)
+{
+    const QStringList words = foldedWords(address);
+    QStringList canonical;
+    canonical.reserve(words.size());
+    for (int i = 0; i < words.size(); ++i) {
+        const QString &word = words[i];
+        // "P.O. Box", "PO Box" and "Post Office Box" all become "po box"
+        if (word == "p" && i + 1 < words.size() && words[i + 1] == "o") {
+            canonical << "po";
+            ++i;
+        } else if (word == "post" && i + 1 < words.size() && words[i + 1] == "office") {
+            canonical << "po";
+            ++i;
+        } else {
+            canonical << addressWords().value(word, word);
+        }
+    }
+    return canonical.join(QLatin1Char(' '));
+}
+
+QString phoneDigits(const QString &phone)
+{
+    QString digits;
+    for (const QChar ch : phone) {
+        if (ch.isDigit()) {
+            digits += ch;
+        }
+    }
+    if (digits.size() > 10 && digits.startsWith(QLatin1Char('1'))) {
+        digits.remove(0, 1);
+    }
+    // Anything after ten digits is an extension
+    digits.truncate(10);
+    return digits.size() >= 7 ? digits : QString();
+}
+
+QString soundex(const QString &word)
+{
+    // Codes for a to z; 0 letters (vowels, h, w, y) are not coded
+    static const char codes[] = "01230120022455012623010202";
+
+    QString letters;
+    for (const QChar ch : foldedWords(word).join(QString())) {
+        if (ch >= QLatin1Char('a') && ch <= QLatin1Char('z')) {
+            letters += ch;
+        }
+    }
+    if (letters.isEmpty()) {
+        return QString();
+    }
+
+    QString result(letters.at(0).toUpper());
+    char last = codes[letters.at(0).unicode() - 'a'];
+    for (int i = 1; i < letters.size() && result.size() < 4; ++i) {
+        const QChar ch = letters.at(i);
+        const char digit = codes[ch.unicode() - 'a'];
+        if (digit != '0' && digit != last) {
+            result += QLatin1Char(digit);
+        }
+        // A vowel separates two letters with the same code; h and w do not
+        if (ch != QLatin1Char('h') && ch != QLatin1Char('w')) {
+            last = digit;
+        }
+    }
+    return result.leftJustified(4, QLatin1Char('0'));
+}
+
+QStringList trigrams(const QString &key)
+{
+    QStringList result;
+    for (const QString &word : key.split(QLatin1Char(' '), Qt::SkipEmptyParts)) {
+        const QString padded = QLatin1Char(' ') + word + QLatin1Char(' ');
+        for (int i = 0; i + 3 <= padded.size(); ++i) {
+            result << padded.mid(i, 3);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+double trigramSimilarity(const QStringList &a, const QStringList &b)
+{
+    if (a.isEmpty() || b.isEmpty()) {
+        return 0;
+    }
+
+    int shared = 0;
+    auto i = a.constBegin();
+    auto j = b.constBegin();
+    while (i != a.constEnd() && j != b.constEnd()) {
+        if (*i < *j) {
+            ++i;
+        } else if (*j < *i) {
+            ++j;
+        } else {
+            ++shared;
+            ++i;
+            ++j;
+        }
+    }
+
+    const double jaccard = double(shared) / (a.size() + b.size() - shared);
+    const double contained = double(shared) / std::min(a.size(), b.size());
+    return std::max(jaccard, 0.9 * contained);
+}
+
+ClientMatchKeys clientMatchKeys(const QString &name, const QString &phone, const QString &address)
+{
+    ClientMatchKeys keys;
+    const QStringList tokens = nameTokens(name);
+    keys.name = joinedSorted(tokens);
+
+    QStringList codes;
+    for (const QString &token : tokens) {
+        // Numbers ("Household 12") have no sound; keep them as they are
+        const QString code = soundex(token);
+        codes << (code.isEmpty() ? token : code);
+    }
+    keys.phonetic = joinedSorted(codes);
+
+    keys.phone = phoneDigits(phone);
+    keys.address = canonicalAddress(address);
+    keys.nameTrigrams = trigrams(keys.name);
+    keys.addressTrigrams = trigrams(keys.address);
+    return keys;
+}
+
+ClientMatchScore scoreClientMatch(const ClientMatchKeys &a, const ClientMatchKeys &b)
+{
+    static constexpr double NameWeight = 0.45;
+    static constexpr double AddressWeight = 0.35;
+    static constexpr double PhoneWeight = 0.2;
+
+    ClientMatchScore match;
+    double total = 0;
+    double weights = 0;
+
+    double name = a.name == b.name && !a.name.isEmpty() ? 1.0 : trigramSimilarity(a.nameTrigrams, b.nameTrigrams);
+    if (name >= 1.0) {
+        match.reasons << "Same name";
+    } else if (!a.phonetic.isEmpty() && a.phonetic == b.phonetic) {
+        name = std::max(name, 0.9);
+        match.reasons << "Names sound alike";
+    } else if (name >= 0.6) {
+        match.reasons << "Similar name";
+    }
+    total += NameWeight * name;
+    weights += NameWeight;
+
+    if (a.hasAddress() && b.hasAddress()) {
+        const double address = a.address == b.address ? 1.0
+                                                       : trigramSimilarity(a.addressTrigrams, b.addressTrigrams);
+        if (address >= 1.0) {
+            match.reasons << "Same address";
+        } else if (address >= 0.6) {
+            match.reasons << "Similar address";
+        }
+        total += AddressWeight * address;
+        weights += AddressWeight;
+    }
+
+    if (a.hasPhone() && b.hasPhone()) {
+        // A seven-digit number matches the same number with an area code
+        const bool samePhone = a.phone == b.phone
+            || ((a.phone.size() == 7 || b.phone.size() == 7) && a.phone.right(7) == b.phone.right(7));
+        if (samePhone) {
+            match.reasons << "Same phone";
+        }
+        total += samePhone ? PhoneWeight : 0;
+        weights += PhoneWeight;
+    }
+
+    match.score = total / weights;
+    return match;
+}
+
+} // namespace firewood::core
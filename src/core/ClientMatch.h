@@ -0,0 +1,84 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+
+namespace firewood::core {
+
+/**
+ * @brief Score from which two households are reported as likely duplicates
+ *
+ * Matching names and addresses score 1.0 and the same name at an unrelated
+ * address about 0.5. The same address and phone under another family member's
+ * name scores about 0.75: households, not people, are the unit served.
+ */
+constexpr double LikelyDuplicateScore = 0.7;
+
+/**
+ * @brief Normalized forms of a household's name, phone and address
+ *
+ * Spelling, punctuation, case, nicknames and street-suffix variants are taken
+ * out, so "Jon Smith, 12 Oak Rd." and "Smith, John, 12 Oak Road" get the same
+ * keys. The text keys are stored and indexed in household_match_keys; the
+ * trigram lists back the fuzzy comparison and the trigram candidate index.
+ */
+struct ClientMatchKeys {
+    QString name;               // Name tokens, nicknames expanded, sorted ("john smith")
+    QString phonetic;           // Soundex code of each name token, sorted ("J500 S530")
+    QString phone;              // Up to ten digits, without a leading 1; empty if under seven
+    QString address;            // Lowercase words, suffixes and directions abbreviated ("12 oak rd")
+    QStringList nameTrigrams;   // Sorted and distinct
+    QStringList addressTrigrams;
+
+    bool hasAddress() const { return !address.isEmpty(); }
+    bool hasPhone() const { return !phone.isEmpty(); }
+};
+
+ClientMatchKeys clientMatchKeys(const QString &name, const QString &phone, const QString &address);
+
+QStringList nameTokens(const QString &name);
+QString canonicalAddress(const QString &address);
+QString phoneDigits(const QString &phone);
+
+/**
+ * @brief American Soundex code of a word, e.g. "J500" for both Jon and John
+ * @return Empty if the word has no letters
+ */
+QString soundex(const QString &word);
+
+/**
+ * @brief Distinct three-character pieces of a key, each word padded with spaces
+ *
+ * "oak rd" gives " oa", "oak", "ak ", " rd" and "rd ", sorted.
+ */
+QStringList trigrams(const QString &key);
+
+/**
+ * @brief Similarity of two sorted trigram lists, 0 to 1
+ *
+ * The larger of the Jaccard index and 0.9 times the share of the smaller list
+ * found in the larger, so a missing middle name or apartment number still
+ * scores high.
+ */
+double trigramSimilarity(const QStringList &a, const QStringList &b);
+
+/**
+ * @brief How alike two households are, and why
+ */
+struct ClientMatchScore {
+    double score = 0;       // 0 to 1
+    QStringList reasons;    // "Same phone", "Similar name", ...
+
+    bool isLikelyDuplicate() const { return score >= LikelyDuplicateScore; }
+};
+
+/**
+ * @brief Weighs name, address and phone similarity
+ *
+ * The name always counts; the address and phone only count when both
+ * households have one, so a record without a phone is neither helped nor hurt
+ * by it. Names that sound alike score at least 0.9.
+ */
+ClientMatchScore scoreClientMatch(const ClientMatchKeys &a, const ClientMatchKeys &b);
+
+} // namespace firewood::core
@@ -0,0 +1,145 @@
+#include "Codes.h"
+
+namespace firewood::core {
+
+namespace {
+
+QString canonicalName(const QList<CodeName> &codes, int value)
+{
+    for (const CodeName &entry : codes) {
+        if (entry.code == value) {
+            return QString::fromLatin1(entry.name);
+        }
+    }
+    return QString();
+}
+
+std::optional<int> parseCode(const QList<CodeName> &codes, const QString &text)
+{
+    const QString trimmed = text.trimmed();
+    if (trimmed.isEmpty()) {
+        return std::nullopt;
+    }
+    for (const CodeName &entry : codes) {
+        if (trimmed.compare(QLatin1String(entry.name), Qt::CaseInsensitive) == 0) {
+            return entry.code;
+        }
+    }
+    return std::nullopt;
+}
+
+template <typename Enum>
+std::optional<Enum> parseAs(const QList<CodeName> &codes, const QString &text)
+{
+    const std::optional<int> value = parseCode(codes, text);
+    if (!value) {
+        return std::nullopt;
+    }
+    return static_cast<Enum>(*value);
+}
+
+} // namespace
+
+QList<CodeName> orderStatusCodes()
+{
+    static const QList<CodeName> codes = {
+        {code(OrderStatus::Pending), "Pending"},
+        {code(OrderStatus::Scheduled), "Scheduled"},
+        {code(OrderStatus::InProgress), "In Progress"},
+        {code(OrderStatus::Completed), "Completed"},
+        {code(OrderStatus::Cancelled), "Cancelled"}
+    };
+    return codes;
+}
+
+QList<CodeName> orderPriorityCodes()
+{
+    static const QList<CodeName> codes = {
+        {code(OrderPriority::Low), "Low"},
+        {code(OrderPriority::Normal), "Normal"},
+        {code(OrderPriority::High), "High"},
+        {code(OrderPriority::Emergency), "Emergency"}
+    };
+    return codes;
+}
+
+QList<CodeName> userTypeCodes()
+{
+    static const QList<CodeName> codes = {
+        {code(UserType::Admin), "admin"},
+        {code(UserType::Lead), "lead"},
+        {code(UserType::Employee), "employee"},
+        {code(UserType::Volunteer), "volunteer"},
+        {code(UserType::Client), "client"},
+        {code(UserType::Employee), "user"}           // Role name before user_type existed
+    };
+    return codes;
+}
+
+QList<CodeName> paymentMethodCodes()
+{
+    // Orders use the display spelling, expenses the lowercase keys
+    static const QList<CodeName> codes = {
+        {code(PaymentMethod::Cash), "Cash"},
+        {code(PaymentMethod::Check), "Check"},
+        {code(PaymentMethod::CreditCard), "Credit Card"},
+        {code(PaymentMethod::WorkForWood), "Work-for-Wood"},
+        {code(PaymentMethod::Voucher), "Voucher"},
+        {code(PaymentMethod::Free), "Free"},
+        {code(PaymentMethod::BankTransfer), "Bank Transfer"},
+        {code(PaymentMethod::Other), "Other"},
+        {code(PaymentMethod::CreditCard), "card"},
+        {code(PaymentMethod::BankTransfer), "bank_transfer"}
+    };
+    return codes;
+}
+
+QString toString(OrderStatus status)
+{
+    return canonicalName(orderStatusCodes(), code(status));
+}
+
+QString toString(OrderPriority priority)
+{
+    return canonicalName(orderPriorityCodes(), code(priority));
+}
+
+QString toString(UserType type)
+{
+    return canonicalName(userTypeCodes(), code(type));
+}
+
+QString toString(PaymentMethod method)
+{
+    return canonicalName(paymentMethodCodes(), code(method));
+}
+
+std::optional<OrderStatus> parseOrderStatus(const QString &text)
+{
+    return parseAs<OrderStatus>(orderStatusCodes(), text);
+}
+
+std::optional<OrderPriority> parseOrderPriority(const QString &text)
+{
+    return parseAs<OrderPriority>(orderPriorityCodes(), text);
+}
+
+std::optional<UserType> parseUserType(const QString &text)
+{
+    return parseAs<UserType>(userTypeCodes(), text);
+}
+
+std::optional<PaymentMethod> parsePaymentMethod(const QString &text)
+{
+    return parseAs<PaymentMethod>(paymentMethodCodes(), text);
+}
+
+QString openOrderStatusCodeList()
+{
+    return QString("%1, %2, %3")
+        .arg(code(OrderStatus::Pending))
+        .arg(code(OrderStatus::Scheduled))
+        .arg(code(OrderStatus::InProgress));
+}
+
+} // namespace firewood::core
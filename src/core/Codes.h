@@ -0,0 +1,106 @@
+#pragma once
+
+#include <QList>
+#include <QString>
+#include <optional>
+
+namespace firewood::core {
+
+/**
+ * @brief Integer codes for the enumerated text columns
+ *
+ * The text columns (orders.status, orders.priority, orders.payment_method,
+ * expenses.payment_method, user_accounts.user_type and user_accounts.role) keep
+ * their readable values; each has an indexed *_code companion computed from this
+ * mapping, and the lookup tables (order_statuses, order_priorities, user_types,
+ * payment_methods) are filled from it. Codes are stored in the database, so never
+ * renumber an existing value.
+ */
+enum class OrderStatus : int {
+    Pending = 1,
+    Scheduled = 2,
+    InProgress = 3,
+    Completed = 4,
+    Cancelled = 5
+};
+
+enum class OrderPriority : int {
+    Low = 1,
+    Normal = 2,
+    High = 3,
+    Emergency = 4
+};
+
+enum class UserType : int {
+    Admin = 1,
+    Lead = 2,
+    Employee = 3,
+    Volunteer = 4,
+    Client = 5
+};
+
+enum class PaymentMethod : int {
+    Cash = 1,
+    Check = 2,
+    CreditCard = 3,
+    WorkForWood = 4,
+    Voucher = 5,
+    Free = 6,
+    BankTransfer = 7,
+    Other = 8
+};
+
+/**
+ * @brief One accepted spelling of a code
+ *
+ * The first entry for a code is the canonical text; later entries with the same
+ * code are older spellings that still map to it. Matching ignores case.
+ */
+struct CodeName {
+    int code;
+    const char *name;
+};
+
+QList<CodeName> orderStatusCodes();
+QList<CodeName> orderPriorityCodes();
+QList<CodeName> userTypeCodes();
+QList<CodeName> paymentMethodCodes();
+
+template <typename Enum>
+constexpr int code(Enum value) { return static_cast<int>(value); }
+
+/**
+ * @brief Canonical text stored in the column for a code
+ */
+QString toString(OrderStatus status);
+QString toString(OrderPriority priority);
+QString toString(UserType type);
+QString toString(PaymentMethod method);
+
+/**
+ * @brief Code for a stored text value (case-insensitive, surrounding spaces ignored)
+ * @return std::nullopt for unknown or empty text
+ */
+std::optional<OrderStatus> parseOrderStatus(const QString &text);
+std::optional<OrderPriority> parseOrderPriority(const QString &text);
+std::optional<UserType> parseUserType(const QString &text);
+std::optional<PaymentMethod> parsePaymentMethod(const QString &text);
+
+/**
+ * @brief Pending, Scheduled and In Progress orders still need wood delivered
+ */
+constexpr bool isOpen(OrderStatus status)
+{
+    return status == OrderStatus::Pending || status == OrderStatus::Scheduled
+        || status == OrderStatus::InProgress;
+}
+
+/**
+ * @brief Open status codes as a SQL list, for "status_code IN (...)"
+ *
+ * The partial index idx_orders_open_delivery uses the same list; SQLite only
+ * uses it when the query repeats the literal codes.
+ */
+QString openOrderStatusCodeList();
+
+} // namespace firewood::core
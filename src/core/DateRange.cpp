@@ -0,0 +1,66 @@
+#include "DateRange.h"
+
+namespace firewood::core {
+
+DateRange DateRange::between(const QDate &first, const QDate &last)
+{
+    if (first > last) {
+        return DateRange(last, first);
+    }
+    return DateRange(first, last);
+}
+
+DateRange DateRange::day(const QDate &date)
+{
+    return DateRange(date, date);
+}
+
+DateRange DateRange::week(const QDate &date)
+{
+    const QDate monday = date.addDays(1 - date.dayOfWeek());
+    return DateRange(monday, monday.addDays(6));
+}
+
+DateRange DateRange::month(const QDate &date)
+{
+    const QDate first(date.year(), date.month(), 1);
+    return DateRange(first, first.addMonths(1).addDays(-1));
+}
+
+DateRange DateRange::quarter(const QDate &date)
+{
+    const int firstMonth = ((date.month() - 1) / 3) * 3 + 1;
+    const QDate first(date.year(), firstMonth, 1);
+    return DateRange(first, first.addMonths(3).addDays(-1));
+}
+
+DateRange DateRange::year(const QDate &date)
+{
+    return DateRange(QDate(date.year(), 1, 1), QDate(date.year(), 12, 31));
+}
+
+DateRange DateRange::fiscalYear(const QDate &date, int startMonth)
+{
+    if (startMonth < 1 || startMonth > 12) {
+        startMonth = 1;
+    }
+    // A fiscal year starting in July 2024 runs through June 2025
+    const int startYear = date.month() >= startMonth ? date.year() : date.year() - 1;
+    const QDate first(startYear, startMonth, 1);
+    return DateRange(first, first.addYears(1).addDays(-1));
+}
+
+DateRange DateRange::fiscalYearToDate(const QDate &date, int startMonth)
+{
+    return DateRange(fiscalYear(date, startMonth).first(), date);
+}
+
+QString DateRange::sqlCondition(const QString &dayColumn) const
+{
+    if (!isValid()) {
+        return "0";
+    }
+    return QString("%1 >= %2 AND %1 < %3").arg(dayColumn).arg(firstDay()).arg(endDay());
+}
+
+} // namespace firewood::core
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <QDate>
+#include <QString>
+
+namespace firewood::core {
+
+/**
+ * @brief An inclusive range of calendar days used to filter dated records
+ *
+ * Date columns have integer day-number companions (order_day, delivery_day, day, ...)
+ * holding the Julian day number, the same value QDate::toJulianDay() returns.
+ * Filter with "<col>_day >= firstDay() AND <col>_day < endDay()" so SQLite can use
+ * the day-number index instead of matching text patterns.
+ */
+class DateRange {
+public:
+    /**
+     * @brief Month the fiscal year starts in (July 1 - June 30)
+     */
+    static constexpr int DefaultFiscalYearStartMonth = 7;
+
+    DateRange() = default;
+
+    /**
+     * @brief Range from first to last, both inclusive (swapped if reversed)
+     */
+    static DateRange between(const QDate &first, const QDate &last);
+
+    static DateRange day(const QDate &date);
+    static DateRange week(const QDate &date);        // Monday through Sunday
+    static DateRange month(const QDate &date);
+    static DateRange quarter(const QDate &date);     // Calendar quarters
+    static DateRange year(const QDate &date);
+
+    /**
+     * @brief Fiscal year containing the date
+     * @param startMonth First month of the fiscal year (1-12)
+     */
+    static DateRange fiscalYear(const QDate &date, int startMonth = DefaultFiscalYearStartMonth);
+
+    /**
+     * @brief Fiscal year from its first day up to and including the given date
+     */
+    static DateRange fiscalYearToDate(const QDate &date, int startMonth = DefaultFiscalYearStartMonth);
+
+    /**
+     * @brief Day number stored in the *_day columns for a date
+     */
+    static qint64 dayNumber(const QDate &date) { return date.toJulianDay(); }
+
+    bool isValid() const { return m_first.isValid() && m_last.isValid(); }
+    bool contains(const QDate &date) const { return isValid() && date >= m_first && date <= m_last; }
+
+    QDate first() const { return m_first; }
+    QDate last() const { return m_last; }
+    qint64 days() const { return isValid() ? m_first.daysTo(m_last) + 1 : 0; }
+
+    /**
+     * @brief First day number in the range (inclusive bound)
+     */
+    qint64 firstDay() const { return m_first.toJulianDay(); }
+
+    /**
+     * @brief Day number after the last day (exclusive bound)
+     */
+    qint64 endDay() const { return m_last.toJulianDay() + 1; }
+
+    /**
+     * @brief SQL condition "column >= first AND column < end" for a day-number column
+     *
+     * The bounds are integers, so the condition can be used in setFilter().
+     */
+    QString sqlCondition(const QString &dayColumn) const;
+
+    bool operator==(const DateRange &other) const { return m_first == other.m_first && m_last == other.m_last; }
+    bool operator!=(const DateRange &other) const { return !(*this == other); }
+
+private:
+    DateRange(const QDate &first, const QDate &last) : m_first(first), m_last(last) {}
+
+    QDate m_first;
+    QDate m_last;
+};
+
+} // namespace firewood::core
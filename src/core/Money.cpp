@@ -0,0 +1,93 @@
+#include "Money.h"
+#include <cmath>
+
+namespace firewood::core {
+
+Money Money::fromDouble(double amount)
+{
+    return Money(static_cast<qint64>(std::llround(amount * 100.0)));
+}
+
+std::optional<Money> Money::parse(const QString &text)
+{
+    QString s = text.trimmed();
+    bool negative = false;
+
+    // Accounting style "(12.50)"
+    if (s.startsWith('(') && s.endsWith(')')) {
+        negative = true;
+        s = s.mid(1, s.size() - 2).trimmed();
+    }
+    // "-$12.50" and "$-12.50"
+    if (!negative && s.startsWith('-')) {
+        negative = true;
+        s = s.mid(1).trimmed();
+    }
+    if (s.startsWith('$')) {
+        s = s.mid(1).trimmed();
+    }
+    if (!negative && s.startsWith('-')) {
+        negative = true;
+        s = s.mid(1).trimmed();
+    }
+
+    qint64 whole = 0;
+    int wholeDigits = 0;
+    int i = 0;
+    for (; i < s.size() && s[i] != '.'; ++i) {
+        const QChar c = s[i];
+        if (c == ',') {
+            continue;  // Thousands separator
+        }
+        if (!c.isDigit() || ++wholeDigits > 15) {
+            return std::nullopt;
+        }
+        whole = whole * 10 + c.digitValue();
+    }
+
+    qint64 fraction = 0;
+    int fractionDigits = 0;
+    if (i < s.size()) {
+        for (++i; i < s.size(); ++i) {
+            const QChar c = s[i];
+            if (!c.isDigit() || ++fractionDigits > 2) {
+                return std::nullopt;
+            }
+            fraction = fraction * 10 + c.digitValue();
+        }
+    }
+
+    if (wholeDigits == 0 && fractionDigits == 0) {
+        return std::nullopt;
+    }
+    if (fractionDigits == 1) {
+        fraction *= 10;
+    }
+
+    const qint64 cents = whole * 100 + fraction;
+    return Money(negative ? -cents : cents);
+}
+
+QString Money::format() const
+{
+    const qint64 absolute = m_cents < 0 ? -m_cents : m_cents;
+    QString whole = QString::number(absolute / 100);
+    for (int pos = whole.size() - 3; pos > 0; pos -= 3) {
+        whole.insert(pos, ',');
+    }
+    return QString("%1$%2.%3")
+        .arg(m_cents < 0 ? "-" : "")
+        .arg(whole)
+        .arg(absolute % 100, 2, 10, QChar('0'));
+}
+
+QString Money::toPlainString() const
+{
+    const qint64 absolute = m_cents < 0 ? -m_cents : m_cents;
+    return QString("%1%2.%3")
+        .arg(m_cents < 0 ? "-" : "")
+        .arg(absolute / 100)
+        .arg(absolute % 100, 2, 10, QChar('0'));
+}
+
+} // namespace firewood::core
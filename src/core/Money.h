@@ -0,0 +1,69 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+#include <optional>
+
+namespace firewood::core {
+
+/**
+ * @brief An exact amount of money in whole cents
+ *
+ * Amount columns are still REAL for the table models and dialogs; each has an
+ * integer *_cents companion (amount_paid_cents, amount_cents, credit_balance_cents)
+ * rounded to the cent. Sum the cents columns and wrap the result with fromCents()
+ * so totals do not drift by fractions of a cent.
+ */
+class Money {
+public:
+    constexpr Money() = default;
+
+    static constexpr Money fromCents(qint64 cents) { return Money(cents); }
+
+    /**
+     * @brief Nearest cent to a floating-point amount (halves round away from zero)
+     */
+    static Money fromDouble(double amount);
+
+    /**
+     * @brief Parses "1234.5", "$1,234.56", "-$3.10" or "(3.10)"
+     * @return std::nullopt for empty text, stray characters or more than two decimals
+     */
+    static std::optional<Money> parse(const QString &text);
+
+    constexpr qint64 cents() const { return m_cents; }
+    double toDouble() const { return static_cast<double>(m_cents) / 100.0; }
+
+    constexpr bool isZero() const { return m_cents == 0; }
+    constexpr bool isNegative() const { return m_cents < 0; }
+
+    /**
+     * @brief Display text with currency sign and thousands separators, e.g. "-$1,234.50"
+     */
+    QString format() const;
+
+    /**
+     * @brief Plain decimal text for CSV and SQL, e.g. "-1234.50"
+     */
+    QString toPlainString() const;
+
+    constexpr Money operator+(Money other) const { return Money(m_cents + other.m_cents); }
+    constexpr Money operator-(Money other) const { return Money(m_cents - other.m_cents); }
+    constexpr Money operator-() const { return Money(-m_cents); }
+    Money &operator+=(Money other) { m_cents += other.m_cents; return *this; }
+    Money &operator-=(Money other) { m_cents -= other.m_cents; return *this; }
+
+    constexpr bool operator==(Money other) const { return m_cents == other.m_cents; }
+    constexpr bool operator!=(Money other) const { return m_cents != other.m_cents; }
+    constexpr bool operator<(Money other) const { return m_cents < other.m_cents; }
+    constexpr bool operator<=(Money other) const { return m_cents <= other.m_cents; }
+    constexpr bool operator>(Money other) const { return m_cents > other.m_cents; }
+    constexpr bool operator>=(Money other) const { return m_cents >= other.m_cents; }
+
+private:
+    constexpr explicit Money(qint64 cents) : m_cents(cents) {}
+
+    qint64 m_cents = 0;
+};
+
+} // namespace firewood::core
@@ -0,0 +1,140 @@
+#include "Report.h"
+#include "Money.h"
+#include <QStringList>
+
+namespace firewood::core {
+
+namespace {
+
+QString cellText(const ReportColumn &column, const QVariant &value, bool display)
+{
+    if (value.isNull()) {
+        return QString();
+    }
+    switch (column.kind) {
+    case ReportColumn::Kind::Integer:
+        return QString::number(value.toLongLong());
+    case ReportColumn::Kind::Decimal:
+        return QString::number(value.toDouble(), 'f', column.decimals);
+    case ReportColumn::Kind::Money: {
+        const Money amount = Money::fromCents(value.toLongLong());
+        return display ? amount.format() : amount.toPlainString();
+    }
+    default:
+        return value.toString();
+    }
+}
+
+QString csvField(const QString &text)
+{
+    if (text.contains(QLatin1Char(',')) || text.contains(QLatin1Char('"'))
+        || text.contains(QLatin1Char('\n')) || text.contains(QLatin1Char('\r'))) {
+        QString quoted = text;
+        quoted.replace(QLatin1String("\""), QLatin1String("\"\""));
+        return QLatin1Char('"') + quoted + QLatin1Char('"');
+    }
+    return text;
+}
+
+QString periodText(const DateRange &period)
+{
+    return QString("%1 to %2").arg(period.first().toString(Qt::ISODate), period.last().toString(Qt::ISODate));
+}
+
+} // namespace
+
+Report::Report(const QString &title, const DateRange &period)
+    : m_title(title),
+      m_period(period),
+      m_generatedAt(QDateTime::currentDateTime())
+{
+}
+
+bool Report::isComplete() const
+{
+    for (const ReportSection &section : m_sections) {
+        if (!section.isValid()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QString Report::toCsv() const
+{
+    QString out;
+    out += csvField(m_title) + '\n';
+    out += csvField("Period: " + periodText(m_period)) + '\n';
+    out += csvField("Generated: " + m_generatedAt.toString(Qt::ISODate)) + '\n';
+
+    for (const ReportSection &section : m_sections) {
+        out += '\n' + csvField(section.title.toUpper()) + '\n';
+        if (!section.isValid()) {
+            out += csvField("Not available: " + section.error) + '\n';
+            continue;
+        }
+
+        QStringList fields;
+        for (const ReportColumn &column : section.columns) {
+            fields << csvField(column.title);
+        }
+        out += fields.join(',') + '\n';
+
+        for (const QVariantList &row : section.rows) {
+            fields.clear();
+            for (int i = 0; i < section.columns.size(); ++i) {
+                fields << csvField(cellText(section.columns[i], row.value(i), false));
+            }
+            out += fields.join(',') + '\n';
+        }
+    }
+    return out;
+}
+
+QString Report::toHtml() const
+{
+    QString out;
+    out += "<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n";
+    out += "<title>" + m_title.toHtmlEscaped() + "</title>\n";
+    out += "<style>\n"
+           "body { font-family: sans-serif; margin: 24px; }\n"
+           "table { border-collapse: collapse; margin-bottom: 24px; }\n"
+           "th, td { border: 1px solid #ccc; padding: 4px 10px; }\n"
+           "th { background: #f0e6d8; text-align: left; }\n"
+           "td.number { text-align: right; }\n"
+           ".error { color: #dc143c; }\n"
+           "</style>\n</head>\n<body>\n";
+    out += "<h1>" + m_title.toHtmlEscaped() + "</h1>\n";
+    out += "<p>" + periodText(m_period).toHtmlEscaped() + "<br>Generated "
+         + m_generatedAt.toString(Qt::ISODate).toHtmlEscaped() + "</p>\n";
+
+    for (const ReportSection &section : m_sections) {
+        out += "<h2>" + section.title.toHtmlEscaped() + "</h2>\n";
+        if (!section.isValid()) {
+            out += "<p class=\"error\">Not available: " + section.error.toHtmlEscaped() + "</p>\n";
+            continue;
+        }
+
+        out += "<table>\n<tr>";
+        for (const ReportColumn &column : section.columns) {
+            out += "<th>" + column.title.toHtmlEscaped() + "</th>";
+        }
+        out += "</tr>\n";
+
+        for (const QVariantList &row : section.rows) {
+            out += "<tr>";
+            for (int i = 0; i < section.columns.size(); ++i) {
+                const ReportColumn &column = section.columns[i];
+                out += column.kind == ReportColumn::Kind::Text ? "<td>" : "<td class=\"number\">";
+                out += cellText(column, row.value(i), true).toHtmlEscaped() + "</td>";
+            }
+            out += "</tr>\n";
+        }
+        out += "</table>\n";
+    }
+
+    out += "</body>\n</html>\n";
+    return out;
+}
+
+} // namespace firewood::core
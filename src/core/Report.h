@@ -0,0 +1,76 @@
+#pragma once
+
+#include "DateRange.h"
+#include <QDateTime>
+#include <QList>
+#include <QString>
+#include <QVariant>
+
+namespace firewood::core {
+
+/**
+ * @brief One column of a report section
+ *
+ * Money cells hold whole cents (qint64) and are written with Money; Decimal
+ * cells hold a double shown with the given number of decimals.
+ */
+struct ReportColumn {
+    enum class Kind { Text, Integer, Decimal, Money };
+
+    QString title;
+    Kind kind = Kind::Text;
+    int decimals = 0;
+};
+
+/**
+ * @brief A titled table of report rows
+ *
+ * A section whose query failed keeps its title and columns, has no rows and
+ * carries the error text, so the rest of the report can still be written.
+ */
+struct ReportSection {
+    QString title;
+    QList<ReportColumn> columns;
+    QList<QVariantList> rows;
+    QString error;
+
+    bool isValid() const { return error.isEmpty(); }
+};
+
+/**
+ * @brief A finished report for one period, rendered to CSV or HTML
+ *
+ * Sections keep the order they were added in. Rendering only formats the
+ * stored values: CSV gets plain numbers (Money::toPlainString()) so it opens
+ * cleanly in a spreadsheet, HTML gets display text (Money::format()).
+ */
+class Report {
+public:
+    Report() = default;
+    Report(const QString &title, const DateRange &period);
+
+    QString title() const { return m_title; }
+    DateRange period() const { return m_period; }
+
+    QDateTime generatedAt() const { return m_generatedAt; }
+    void setGeneratedAt(const QDateTime &generatedAt) { m_generatedAt = generatedAt; }
+
+    void addSection(const ReportSection &section) { m_sections.append(section); }
+    const QList<ReportSection> &sections() const { return m_sections; }
+
+    /**
+     * @brief True if every section was loaded
+     */
+    bool isComplete() const;
+
+    QString toCsv() const;
+    QString toHtml() const;
+
+private:
+    QString m_title;
+    DateRange m_period;
+    QDateTime m_generatedAt;
+    QList<ReportSection> m_sections;
+};
+
+} // namespace firewood::core
@@ -0,0 +1,131 @@
+#include "StartupProfiler.h"
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+
+namespace firewood::core {
+
+namespace {
+
+double milliseconds(qint64 ns)
+{
+    return ns / 1e6;
+}
+
+} // namespace
+
+StartupProfiler &StartupProfiler::instance()
+{
+    static StartupProfiler profiler;
+    return profiler;
+}
+
+StartupProfiler::StartupProfiler()
+{
+    m_clock.start();
+}
+
+void StartupProfiler::mark(const QString &phase)
+{
+    record(phase, false);
+}
+
+void StartupProfiler::markWaiting(const QString &phase)
+{
+    record(phase, true);
+}
+
+void StartupProfiler::record(const QString &phase, bool waiting)
+{
+    if (m_finished) {
+        return;
+    }
+    const qint64 now = m_clock.nsecsElapsed();
+    m_phases.append({phase, m_lastNs, now - m_lastNs, waiting});
+    m_lastNs = now;
+}
+
+void StartupProfiler::finish(const QString &phase)
+{
+    if (m_finished) {
+        return;
+    }
+    record(phase, false);
+    m_finished = true;
+
+    qDebug() << "Startup profile:";
+    for (const Phase &entry : m_phases) {
+        qDebug().noquote() << QString("  %1 ms  %2%3")
+            .arg(milliseconds(entry.durationNs), 9, 'f', 2)
+            .arg(entry.name)
+            .arg(entry.waiting ? " (waiting for user)" : "");
+    }
+    qDebug().noquote() << QString("  %1 ms  total, %2 ms excluding waits")
+        .arg(milliseconds(totalNs()), 9, 'f', 2)
+        .arg(milliseconds(activeNs()), 0, 'f', 2);
+
+    if (!m_outputPath.isEmpty() && writeJson(m_outputPath)) {
+        qDebug() << "Startup profile written to" << m_outputPath;
+    }
+}
+
+qint64 StartupProfiler::totalNs() const
+{
+    return m_lastNs;
+}
+
+qint64 StartupProfiler::activeNs() const
+{
+    qint64 total = 0;
+    for (const Phase &entry : m_phases) {
+        if (!entry.waiting) {
+            total += entry.durationNs;
+        }
+    }
+    return total;
+}
+
+QByteArray StartupProfiler::toJson() const
+{
+    QJsonArray phases;
+    for (const Phase &entry : m_phases) {
+        phases.append(QJsonObject{
+            {"name", entry.name},
+            {"start_ms", milliseconds(entry.startNs)},
+            {"duration_ms", milliseconds(entry.durationNs)},
+            {"waiting", entry.waiting}
+        });
+    }
+
+    const QJsonObject root{
+        {"recorded_at", QDateTime::currentDateTimeUtc().toString(Qt::ISODate)},
+        {"total_ms", milliseconds(totalNs())},
+        {"active_ms", milliseconds(activeNs())},
+        {"phases", phases}
+    };
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+bool StartupProfiler::writeJson(const QString &path) const
+{
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "WARNING: Could not write startup profile:" << path << file.errorString();
+        return false;
+    }
+    file.write(toJson());
+    if (!file.commit()) {
+        qDebug() << "WARNING: Could not write startup profile:" << path << file.errorString();
+        return false;
+    }
+    return true;
+}
+
+} // namespace firewood::core
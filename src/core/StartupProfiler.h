@@ -0,0 +1,67 @@
+#pragma once
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QList>
+#include <QString>
+
+namespace firewood::core {
+
+/**
+ * @brief Named phases from the start of main() to the first painted main window
+ *
+ * Each mark() ends a phase that began at the previous mark (or when the profiler
+ * was first used), timed with a monotonic clock. Phases spent waiting for the
+ * user, such as the login dialog, are flagged so they can be left out of the
+ * active total. finish() logs the breakdown and writes it as JSON; marks after
+ * that are ignored, so logging out and in again is not profiled.
+ */
+class StartupProfiler {
+public:
+    struct Phase {
+        QString name;
+        qint64 startNs = 0;       // Since the profiler started
+        qint64 durationNs = 0;
+        bool waiting = false;     // Time spent waiting for the user
+    };
+
+    /**
+     * @brief The process-wide profiler; the first call starts the clock
+     */
+    static StartupProfiler &instance();
+
+    void mark(const QString &phase);
+    void markWaiting(const QString &phase);
+
+    /**
+     * @brief Marks the last phase, logs the breakdown and writes the JSON file if one is set
+     */
+    void finish(const QString &phase);
+
+    bool isFinished() const { return m_finished; }
+
+    /**
+     * @brief File finish() writes the JSON breakdown to; empty for none
+     */
+    void setOutputPath(const QString &path) { m_outputPath = path; }
+    QString outputPath() const { return m_outputPath; }
+
+    QList<Phase> phases() const { return m_phases; }
+    qint64 totalNs() const;
+    qint64 activeNs() const;      // Total minus the waiting phases
+
+    QByteArray toJson() const;
+    bool writeJson(const QString &path) const;
+
+private:
+    StartupProfiler();
+    void record(const QString &phase, bool waiting);
+
+    QElapsedTimer m_clock;
+    qint64 m_lastNs = 0;
+    QList<Phase> m_phases;
+    QString m_outputPath;
+    bool m_finished = false;
+};
+
+} // namespace firewood::core
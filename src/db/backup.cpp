@@ -0,0 +1,459 @@
+#include "backup.h"
+#ifdef FIREWOOD_USE_SYSTEM_SQLITE
+#include <sqlite3.h>
+#endif
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QThread>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QSet>
+#include <QStandardPaths>
+#include <QDebug>
+
+namespace firewood::db {
+
+static BackupScheduler *s_instance = nullptr;
+
+static const QString kBackupPrefix = QStringLiteral("firewood_bank-");
+static const QString kBackupSuffix = QStringLiteral(".sqlite");
+static const QString kBackupTimestampFormat = QStringLiteral("yyyyMMdd-HHmmss");
+
+static QString defaultBackupDirectory() {
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/backups";
+}
+
+#ifdef FIREWOOD_USE_SYSTEM_SQLITE
+
+static QString sqliteError(sqlite3 *handle) {
+    return handle ? QString::fromUtf8(sqlite3_errmsg(handle)) : QString("out of memory");
+}
+
+static bool checkIntegrity(sqlite3 *handle, QString &error) {
+    sqlite3_stmt *stmt = nullptr;
+    if (sqlite3_prepare_v2(handle, "PRAGMA integrity_check;", -1, &stmt, nullptr) != SQLITE_OK) {
+        error = sqliteError(handle);
+        return false;
+    }
+
+    QStringList problems;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        const auto *text = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+        QString line = QString::fromUtf8(text ? text : "");
+        if (line != "ok") {
+            problems << line;
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    if (!problems.isEmpty()) {
+        error = "Integrity check failed: " + problems.mid(0, 5).join("; ");
+        return false;
+    }
+    return true;
+}
+
+BackupResult runOnlineBackup(const QString &sourcePath, const QString &destPath,
+                             const BackupPolicy &policy) {
+    BackupResult result;
+    result.filePath = destPath;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const QString partialPath = destPath + ".partial";
+    QFile::remove(partialPath);
+
+    sqlite3 *source = nullptr;
+    sqlite3 *dest = nullptr;
+
+    if (sqlite3_open_v2(sourcePath.toUtf8().constData(), &source, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+        result.error = "Could not open database: " + sqliteError(source);
+        sqlite3_close(source);
+        return result;
+    }
+    sqlite3_busy_timeout(source, 2000);
+
+    if (sqlite3_open_v2(partialPath.toUtf8().constData(), &dest,
+                        SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) != SQLITE_OK) {
+        result.error = "Could not create backup file: " + sqliteError(dest);
+        sqlite3_close(dest);
+        sqlite3_close(source);
+        return result;
+    }
+
+    sqlite3_backup *backup = sqlite3_backup_init(dest, "main", source, "main");
+    if (!backup) {
+        result.error = "Could not start backup: " + sqliteError(dest);
+        sqlite3_close(dest);
+        sqlite3_close(source);
+        QFile::remove(partialPath);
+        return result;
+    }
+
+    // Copy a few pages at a time; between steps the source lock is released so the
+    // application can keep writing. If the source changes mid-copy SQLite restarts
+    // the copy from the changed pages on the next step, so a busy session could
+    // keep it going forever: both the busy retries and the duration are capped.
+    int rc = SQLITE_OK;
+    int busyRetries = 0;
+    QString gaveUp;
+    const int pagesPerStep = policy.pagesPerStep > 0 ? policy.pagesPerStep : -1;
+    while (true) {
+        rc = sqlite3_backup_step(backup, pagesPerStep);
+        result.steps++;
+        if (rc == SQLITE_DONE) {
+            break;
+        }
+        if (rc != SQLITE_OK && rc != SQLITE_BUSY && rc != SQLITE_LOCKED) {
+            break;
+        }
+        busyRetries = (rc == SQLITE_OK) ? 0 : busyRetries + 1;
+        if (policy.maxBusyRetries > 0 && busyRetries >= policy.maxBusyRetries) {
+            gaveUp = QString("Gave up after %1 busy retries").arg(busyRetries);
+            break;
+        }
+        if (policy.maxDurationMs > 0 && timer.elapsed() >= policy.maxDurationMs) {
+            gaveUp = QString("Gave up after %1 ms with %2 of %3 pages left; the database kept changing")
+                         .arg(timer.elapsed())
+                         .arg(sqlite3_backup_remaining(backup))
+                         .arg(sqlite3_backup_pagecount(backup));
+            break;
+        }
+        if (policy.stepPauseMs > 0) {
+            QThread::msleep(static_cast<unsigned long>(policy.stepPauseMs));
+        }
+    }
+    result.pageCount = sqlite3_backup_pagecount(backup);
+    sqlite3_backup_finish(backup);
+    sqlite3_close(source);
+
+    if (rc != SQLITE_DONE) {
+        result.error = gaveUp.isEmpty() ? "Backup step failed: " + QString::fromUtf8(sqlite3_errstr(rc)) : gaveUp;
+        result.elapsedMs = timer.elapsed();
+        sqlite3_close(dest);
+        QFile::remove(partialPath);
+        return result;
+    }
+
+    QString integrityError;
+    result.integrityOk = checkIntegrity(dest, integrityError);
+    sqlite3_close(dest);
+
+    if (!result.integrityOk) {
+        result.error = integrityError;
+        QFile::remove(partialPath);
+        return result;
+    }
+
+    QFile::remove(destPath);
+    if (!QFile::rename(partialPath, destPath)) {
+        result.error = "Could not move backup into place: " + destPath;
+        QFile::remove(partialPath);
+        return result;
+    }
+
+    result.bytes = QFileInfo(destPath).size();
+    result.elapsedMs = timer.elapsed();
+    result.success = true;
+    return result;
+}
+
+#else
+
+// Without direct access to SQLite the copy is made with VACUUM INTO on a private
+// Qt SQL connection, which reads the whole database in one transaction. In WAL
+// mode that reader does not block writers, so the database is switched first.
+static bool checkIntegrity(const QString &path, QString &error) {
+    const QString name = QString("firewood_backup_check_%1").arg(reinterpret_cast<quintptr>(&path), 0, 16);
+    bool ok = false;
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", name);
+        db.setDatabaseName(path);
+        db.setConnectOptions("QSQLITE_OPEN_READONLY");
+        if (!db.open()) {
+            error = db.lastError().text();
+        } else {
+            QSqlQuery query(db);
+            if (!query.exec("PRAGMA integrity_check;")) {
+                error = query.lastError().text();
+            } else {
+                QStringList problems;
+                while (query.next()) {
+                    if (query.value(0).toString() != "ok") {
+                        problems << query.value(0).toString();
+                    }
+                }
+                ok = problems.isEmpty();
+                if (!ok) {
+                    error = "Integrity check failed: " + problems.mid(0, 5).join("; ");
+                }
+            }
+        }
+        db.close();
+    }
+    QSqlDatabase::removeDatabase(name);
+    return ok;
+}
+
+BackupResult runOnlineBackup(const QString &sourcePath, const QString &destPath,
+                             const BackupPolicy &policy) {
+    Q_UNUSED(policy)
+    BackupResult result;
+    result.filePath = destPath;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const QString partialPath = destPath + ".partial";
+    QFile::remove(partialPath);
+
+    const QString name = QString("firewood_backup_%1").arg(reinterpret_cast<quintptr>(&result), 0, 16);
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", name);
+        db.setDatabaseName(sourcePath);
+        db.setConnectOptions("QSQLITE_BUSY_TIMEOUT=2000");
+        if (!db.open()) {
+            result.error = "Could not open database: " + db.lastError().text();
+        } else {
+            // Persistent, so this only converts the file on the first backup. A file
+            // that cannot use WAL (e.g. on a network share) is still backed up.
+            QSqlQuery query(db);
+            if (!query.exec("PRAGMA journal_mode = WAL;") || !query.next()
+                || query.value(0).toString().compare("wal", Qt::CaseInsensitive) != 0) {
+                qDebug() << "WARNING: Could not switch the database to WAL mode; writers wait for this backup:"
+                         << query.lastError().text();
+            }
+            query.finish();
+
+            QString target = partialPath;
+            target.replace("'", "''");
+            result.steps = 1;
+            if (!query.exec(QString("VACUUM INTO '%1';").arg(target))) {
+                result.error = "Backup failed: " + query.lastError().text();
+            }
+            db.close();
+        }
+    }
+    QSqlDatabase::removeDatabase(name);
+
+    if (!result.error.isEmpty()) {
+        result.elapsedMs = timer.elapsed();
+        QFile::remove(partialPath);
+        return result;
+    }
+
+    QString integrityError;
+    result.integrityOk = checkIntegrity(partialPath, integrityError);
+    if (!result.integrityOk) {
+        result.error = integrityError;
+        result.elapsedMs = timer.elapsed();
+        QFile::remove(partialPath);
+        return result;
+    }
+
+    QFile::remove(destPath);
+    if (!QFile::rename(partialPath, destPath)) {
+        result.error = "Could not move backup into place: " + destPath;
+        QFile::remove(partialPath);
+        return result;
+    }
+
+    result.bytes = QFileInfo(destPath).size();
+    result.elapsedMs = timer.elapsed();
+    result.success = true;
+    return result;
+}
+
+#endif
+
+QStringList applyBackupRetention(const QString &directory, const BackupPolicy &policy,
+                                 const QDateTime &now) {
+    QStringList removed;
+
+    QDir dir(directory);
+    const QStringList files = dir.entryList({kBackupPrefix + "*" + kBackupSuffix},
+                                            QDir::Files, QDir::Name | QDir::Reversed);
+
+    // Names embed the timestamp, so reverse name order is newest first
+    QSet<QDate> daysKept;
+    QSet<QPair<int, int>> weeksKept;
+    int index = 0;
+
+    for (const QString &name : files) {
+        const QString stamp = name.mid(kBackupPrefix.length(),
+                                       name.length() - kBackupPrefix.length() - kBackupSuffix.length());
+        const QDateTime taken = QDateTime::fromString(stamp, kBackupTimestampFormat);
+        if (!taken.isValid()) {
+            continue;  // Not one of ours; leave it alone
+        }
+
+        bool keepThis = index++ < policy.keepRecent;
+
+        const QDate day = taken.date();
+        const qint64 ageDays = day.daysTo(now.date());
+        if (ageDays < policy.keepDaily && !daysKept.contains(day)) {
+            daysKept.insert(day);
+            keepThis = true;
+        }
+
+        int weekYear = 0;
+        const int week = day.weekNumber(&weekYear);
+        if (ageDays < qint64(policy.keepWeekly) * 7 && !weeksKept.contains({weekYear, week})) {
+            weeksKept.insert({weekYear, week});
+            keepThis = true;
+        }
+
+        if (!keepThis && dir.remove(name)) {
+            removed << dir.filePath(name);
+        }
+    }
+
+    return removed;
+}
+
+BackupScheduler::BackupScheduler(const QString &databasePath, const BackupPolicy &policy, QObject *parent)
+    : QObject(parent), m_databasePath(databasePath), m_policy(policy)
+{
+    qRegisterMetaType<firewood::db::BackupResult>();
+
+    if (m_policy.backupDirectory.isEmpty()) {
+        m_policy.backupDirectory = defaultBackupDirectory();
+    }
+
+    connect(&m_timer, &QTimer::timeout, this, [this]() { backupNow(); });
+
+    if (!s_instance) {
+        s_instance = this;
+    }
+}
+
+BackupScheduler::~BackupScheduler()
+{
+    stop();
+    if (m_worker) {
+        // Let an in-flight copy finish; it never touches this object directly
+        m_worker->wait();
+    }
+    if (s_instance == this) {
+        s_instance = nullptr;
+    }
+}
+
+BackupScheduler *BackupScheduler::instance()
+{
+    return s_instance;
+}
+
+void BackupScheduler::start()
+{
+    if (m_policy.intervalMinutes <= 0) {
+        qDebug() << "Scheduled backups disabled";
+        return;
+    }
+
+    m_timer.start(m_policy.intervalMinutes * 60 * 1000);
+
+    // Catch up shortly after launch if the newest backup is older than one interval
+    QDir dir(m_policy.backupDirectory);
+    const QFileInfoList existing = dir.entryInfoList({kBackupPrefix + "*" + kBackupSuffix},
+                                                     QDir::Files, QDir::Time);
+    const bool stale = existing.isEmpty() ||
+        existing.first().lastModified().secsTo(QDateTime::currentDateTime()) > m_policy.intervalMinutes * 60;
+    if (stale) {
+        QTimer::singleShot(2 * 60 * 1000, this, [this]() { backupNow(); });
+    }
+
+    qDebug() << "Backup scheduler started, interval" << m_policy.intervalMinutes << "minutes, directory"
+             << m_policy.backupDirectory;
+}
+
+void BackupScheduler::stop()
+{
+    m_timer.stop();
+}
+
+bool BackupScheduler::backupNow()
+{
+    if (m_running) {
+        qDebug() << "Backup already in progress, skipping request";
+        return false;
+    }
+
+    m_running = true;
+    emit backupStarted();
+
+    // Reported like any other failed run, after this call returns
+    if (!QDir().mkpath(m_policy.backupDirectory)) {
+        BackupResult failed;
+        failed.error = "Could not create backup directory: " + m_policy.backupDirectory;
+        failed.finishedAt = QDateTime::currentDateTime();
+        QMetaObject::invokeMethod(this, [this, failed]() { onWorkerFinished(failed); }, Qt::QueuedConnection);
+        return true;
+    }
+
+    const QString destPath = QDir(m_policy.backupDirectory).filePath(
+        kBackupPrefix + QDateTime::currentDateTime().toString(kBackupTimestampFormat) + kBackupSuffix);
+    const QString sourcePath = m_databasePath;
+    const BackupPolicy policy = m_policy;
+
+    qDebug() << "Starting online backup to" << destPath;
+
+    m_worker = QThread::create([this, sourcePath, destPath, policy]() {
+        BackupResult result = runOnlineBackup(sourcePath, destPath, policy);
+        if (result.success) {
+            result.removedFiles = applyBackupRetention(policy.backupDirectory, policy);
+        }
+        result.finishedAt = QDateTime::currentDateTime();
+        QMetaObject::invokeMethod(this, [this, result]() { onWorkerFinished(result); }, Qt::QueuedConnection);
+    });
+    connect(m_worker, &QThread::finished, m_worker, &QObject::deleteLater);
+    m_worker->start(QThread::LowPriority);
+    return true;
+}
+
+void BackupScheduler::onWorkerFinished(const BackupResult &result)
+{
+    m_running = false;
+    m_worker = nullptr;
+
+    if (result.success) {
+        qDebug() << "Backup completed:" << result.filePath << result.bytes << "bytes," << result.pageCount
+                 << "pages in" << result.steps << "steps," << result.elapsedMs << "ms";
+        if (!result.removedFiles.isEmpty()) {
+            qDebug() << "Pruned" << result.removedFiles.size() << "old backups";
+        }
+    } else {
+        qDebug() << "ERROR: Backup failed:" << result.error;
+    }
+
+    recordResult(result);
+    emit backupFinished(result);
+}
+
+void BackupScheduler::recordResult(const BackupResult &result)
+{
+    QSqlDatabase db = QSqlDatabase::database();
+    if (!db.isValid() || !db.isOpen()) {
+        return;
+    }
+
+    QSqlQuery query(db);
+    query.prepare("INSERT INTO backup_log (file_path, success, integrity_ok, bytes, page_count, elapsed_ms, error) "
+                  "VALUES (:path, :success, :integrity, :bytes, :pages, :elapsed, :error)");
+    query.bindValue(":path", result.filePath);
+    query.bindValue(":success", result.success ? 1 : 0);
+    query.bindValue(":integrity", result.integrityOk ? 1 : 0);
+    query.bindValue(":bytes", result.bytes);
+    query.bindValue(":pages", result.pageCount);
+    query.bindValue(":elapsed", result.elapsedMs);
+    query.bindValue(":error", result.error);
+    if (!query.exec()) {
+        qDebug() << "WARNING: Could not record backup result:" << query.lastError().text();
+    }
+}
+
+} // namespace firewood::db
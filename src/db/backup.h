@@ -0,0 +1,119 @@
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QDateTime>
+#include <QTimer>
+#include <QMetaType>
+
+class QThread;
+
+namespace firewood::db {
+
+/**
+ * @brief Tuning, schedule and retention rules for online backups
+ */
+struct BackupPolicy {
+    QString backupDirectory;      // Defaults to <AppData>/backups when empty
+    int pagesPerStep = 64;        // Pages copied per sqlite3_backup_step() call
+    int stepPauseMs = 25;         // Pause between steps so writers can get the lock
+    int maxBusyRetries = 200;     // Consecutive busy/locked steps before giving up
+    int maxDurationMs = 10 * 60 * 1000;  // Gives up on a copy that keeps restarting past this
+    int intervalMinutes = 240;    // Scheduled backup interval (0 disables the schedule)
+    int keepRecent = 6;           // Newest backups that are always kept
+    int keepDaily = 14;           // Keep the newest backup of each of the last N days
+    int keepWeekly = 8;           // Keep the newest backup of each of the last N weeks
+};
+
+/**
+ * @brief Outcome of a single backup run
+ */
+struct BackupResult {
+    bool success = false;
+    bool integrityOk = false;
+    QString filePath;
+    QString error;
+    qint64 bytes = 0;
+    int pageCount = 0;
+    int steps = 0;
+    qint64 elapsedMs = 0;
+    QDateTime finishedAt;
+    QStringList removedFiles;     // Old backups pruned by the retention rules
+};
+
+/**
+ * @brief Copies a live database with the SQLite online backup API
+ *
+ * Blocking; run it on a worker thread. The source is opened read-only on its own
+ * connection and copied a few pages at a time, so writers are only held off for
+ * the duration of one step. The copy is written to a ".partial" file, checked
+ * with PRAGMA integrity_check and only then renamed into place.
+ *
+ * The backup API needs the build option FIREWOOD_USE_SYSTEM_SQLITE (on by
+ * default). Without it the database is switched to WAL mode, so writers are not
+ * blocked by the reader, and copied with VACUUM INTO in a single step; the
+ * paging and retry settings of the policy do not apply.
+ */
+BackupResult runOnlineBackup(const QString &sourcePath, const QString &destPath,
+                             const BackupPolicy &policy);
+
+/**
+ * @brief Deletes backups in a directory that fall outside the retention rules
+ * @return Paths of the files that were removed
+ */
+QStringList applyBackupRetention(const QString &directory, const BackupPolicy &policy,
+                                 const QDateTime &now = QDateTime::currentDateTime());
+
+/**
+ * @brief Runs scheduled and on-demand backups on a worker thread
+ *
+ * One scheduler is created at startup for the application database. Results are
+ * recorded in the backup_log table and reported through backupFinished().
+ */
+class BackupScheduler : public QObject {
+    Q_OBJECT
+
+public:
+    explicit BackupScheduler(const QString &databasePath, const BackupPolicy &policy = BackupPolicy(),
+                             QObject *parent = nullptr);
+    ~BackupScheduler() override;
+
+    /**
+     * @brief The scheduler created at startup, or nullptr if none exists
+     */
+    static BackupScheduler *instance();
+
+    void start();
+    void stop();
+    bool isRunning() const { return m_running; }
+    QString backupDirectory() const { return m_policy.backupDirectory; }
+
+public slots:
+    /**
+     * @brief Starts a backup immediately unless one is already in progress
+     *
+     * Every started backup, including one that fails before copying anything,
+     * is reported through backupFinished().
+     * @return false only if a backup is already running
+     */
+    bool backupNow();
+
+signals:
+    void backupStarted();
+    void backupFinished(const firewood::db::BackupResult &result);
+
+private:
+    void onWorkerFinished(const BackupResult &result);
+    void recordResult(const BackupResult &result);
+
+    QString m_databasePath;
+    BackupPolicy m_policy;
+    QTimer m_timer;
+    QThread *m_worker = nullptr;
+    bool m_running = false;
+};
+
+} // namespace firewood::db
+
+Q_DECLARE_METATYPE(firewood::db::BackupResult)
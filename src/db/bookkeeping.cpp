@@ -0,0 +1,69 @@
+#include "bookkeeping.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+
+namespace firewood::db {
+
+using core::BookkeepingPivot;
+using core::Money;
+
+core::BookkeepingPivot loadBookkeepingPivot(QSqlDatabase &db, const core::DateRange &period) {
+    BookkeepingPivot pivot(period);
+
+    // Budgeted categories first, so they keep a stable order even in empty months
+    QSqlQuery budgets(db);
+    if (budgets.exec("SELECT category_name, category_type, COALESCE(annual_budget, 0) FROM budget_categories "
+                     "WHERE active = 1 ORDER BY category_type DESC, category_name")) {
+        while (budgets.next()) {
+            const BookkeepingPivot::Kind kind = budgets.value(1).toString().compare("income", Qt::CaseInsensitive) == 0
+                ? BookkeepingPivot::Kind::Income
+                : BookkeepingPivot::Kind::Expense;
+            pivot.addCategory(budgets.value(0).toString(), kind, Money::fromDouble(budgets.value(2).toDouble()));
+        }
+    } else {
+        qDebug() << "ERROR: Failed to load budget categories:" << budgets.lastError().text();
+    }
+
+    QSqlQuery query(db);
+    query.prepare("SELECT 0, source, day, amount_cents FROM income WHERE day >= ? AND day < ? "
+                  "UNION ALL "
+                  "SELECT 1, category, day, amount_cents FROM expenses WHERE day >= ? AND day < ?");
+    query.addBindValue(period.firstDay());
+    query.addBindValue(period.endDay());
+    query.addBindValue(period.firstDay());
+    query.addBindValue(period.endDay());
+    query.setForwardOnly(true);
+
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to load bookkeeping pivot:" << query.lastError().text();
+        pivot.finalize();
+        return pivot;
+    }
+
+    while (query.next()) {
+        const BookkeepingPivot::Kind kind = query.value(0).toInt() == 0
+            ? BookkeepingPivot::Kind::Income
+            : BookkeepingPivot::Kind::Expense;
+        const int row = pivot.addCategory(query.value(1).toString(), kind);
+        pivot.add(row, pivot.monthIndexForDay(query.value(2).toLongLong()),
+                  Money::fromCents(query.value(3).toLongLong()));
+    }
+
+    pivot.finalize();
+    return pivot;
+}
+
+bool loadAllTimeTotals(QSqlDatabase &db, core::Money &income, core::Money &expenses) {
+    QSqlQuery query(db);
+    if (!query.exec("SELECT (SELECT COALESCE(SUM(amount_cents), 0) FROM income), "
+                    "(SELECT COALESCE(SUM(amount_cents), 0) FROM expenses)") || !query.next()) {
+        qDebug() << "ERROR: Failed to load all-time totals:" << query.lastError().text();
+        return false;
+    }
+    income = Money::fromCents(query.value(0).toLongLong());
+    expenses = Money::fromCents(query.value(1).toLongLong());
+    return true;
+}
+
+} // namespace firewood::db
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "BookkeepingPivot.h"
+#include "DateRange.h"
+#include <QSqlDatabase>
+
+namespace firewood::db {
+
+/**
+ * @brief Loads income and expenses for a period into a finished pivot
+ *
+ * Rows are the active budget_categories (with their annual budgets) plus any
+ * source or category found in the period without one. Income and expense rows
+ * are read in one statement over the day-number indexes and bucketed into months
+ * in memory. On a query error the pivot is returned empty but finalized.
+ */
+core::BookkeepingPivot loadBookkeepingPivot(QSqlDatabase &db, const core::DateRange &period);
+
+/**
+ * @brief All-time income and expense totals in one statement
+ * @return false if the query failed
+ */
+bool loadAllTimeTotals(QSqlDatabase &db, core::Money &income, core::Money &expenses);
+
+} // namespace firewood::db
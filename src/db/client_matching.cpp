@@ -0,0 +1,493 @@
+#include "client_matching.h"
+#include <QHash>
+#include <QSet>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QElapsedTimer>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace firewood::db {
+
+namespace {
+
+// household_trigrams.field
+constexpr int NameField = 1;
+constexpr int AddressField = 2;
+
+// Trigram lookups keep the households sharing the most trigrams
+constexpr int TrigramCandidates = 50;
+// Households sharing a phonetic code, phone or address
+constexpr int ExactCandidates = 200;
+// Dirty households keyed per savepoint
+constexpr int RefreshBatch = 500;
+
+// Rolled back to unless released, so a failed batch leaves no partial keys.
+// Unlike BEGIN, a savepoint also works inside a migration's transaction.
+class Savepoint {
+public:
+    explicit Savepoint(QSqlDatabase &db) : m_db(db) {
+        QSqlQuery query(m_db);
+        m_active = query.exec("SAVEPOINT client_match_keys");
+        if (!m_active) {
+            qDebug() << "ERROR: Failed to start match key savepoint:" << query.lastError().text();
+        }
+    }
+
+    ~Savepoint() {
+        if (m_active) {
+            QSqlQuery query(m_db);
+            query.exec("ROLLBACK TO client_match_keys");
+            query.exec("RELEASE client_match_keys");
+        }
+    }
+
+    Savepoint(const Savepoint &) = delete;
+    Savepoint &operator=(const Savepoint &) = delete;
+
+    bool isActive() const { return m_active; }
+
+    bool release() {
+        QSqlQuery query(m_db);
+        if (!query.exec("RELEASE client_match_keys")) {
+            qDebug() << "ERROR: Failed to release match key savepoint:" << query.lastError().text();
+            return false;
+        }
+        m_active = false;
+        return true;
+    }
+
+private:
+    QSqlDatabase &m_db;
+    bool m_active = false;
+};
+
+// Prepared once per refresh; a first run writes every household's keys
+class KeyWriter {
+public:
+    explicit KeyWriter(QSqlDatabase &db) : m_delete(db), m_insertKeys(db), m_insertTrigram(db), m_clean(db) {
+        m_delete.prepare("DELETE FROM household_match_keys WHERE household_id = ?");
+        m_clean.prepare("DELETE FROM household_match_dirty WHERE household_id = ?");
+        m_insertKeys.prepare("INSERT INTO household_match_keys "
+                             "(household_id, name_key, phonetic_key, phone_key, address_key) "
+                             "VALUES (?, ?, ?, ?, ?)");
+        m_insertTrigram.prepare("INSERT OR IGNORE INTO household_trigrams (field, trigram, household_id) "
+                                "VALUES (?, ?, ?)");
+    }
+
+    bool write(qint64 householdId, const core::ClientMatchKeys &keys) {
+        // Deleting the keys row deletes its trigrams (household_match_keys_ad)
+        m_delete.addBindValue(householdId);
+        if (!exec(m_delete)) {
+            return false;
+        }
+
+        m_insertKeys.addBindValue(householdId);
+        m_insertKeys.addBindValue(keys.name);
+        m_insertKeys.addBindValue(keys.phonetic);
+        m_insertKeys.addBindValue(keys.phone.right(7));
+        m_insertKeys.addBindValue(keys.address);
+        if (!exec(m_insertKeys)) {
+            return false;
+        }
+
+        return writeTrigrams(NameField, keys.nameTrigrams, householdId)
+            && writeTrigrams(AddressField, keys.addressTrigrams, householdId)
+            && clean(householdId);
+    }
+
+    // Takes a household off the dirty list
+    bool clean(qint64 householdId) {
+        m_clean.addBindValue(householdId);
+        return exec(m_clean);
+    }
+
+private:
+    bool writeTrigrams(int field, const QStringList &trigrams, qint64 householdId) {
+        for (const QString &trigram : trigrams) {
+            m_insertTrigram.addBindValue(field);
+            m_insertTrigram.addBindValue(trigram);
+            m_insertTrigram.addBindValue(householdId);
+            if (!exec(m_insertTrigram)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool exec(QSqlQuery &query) {
+        if (!query.exec()) {
+            qDebug() << "ERROR: Failed to write match keys:" << query.lastError().text();
+            return false;
+        }
+        return true;
+    }
+
+    QSqlQuery m_delete;
+    QSqlQuery m_insertKeys;
+    QSqlQuery m_insertTrigram;
+    QSqlQuery m_clean;
+};
+
+// Reads (id, name, phone, address) rows
+MatchedHousehold readHousehold(const QSqlQuery &query) {
+    return {query.value(0).toLongLong(), query.value(1).toString(),
+            query.value(2).toString(), query.value(3).toString()};
+}
+
+core::ClientMatchKeys keysFor(const MatchedHousehold &household) {
+    return core::clientMatchKeys(household.name, household.phone, household.address);
+}
+
+// Writes the keys of the given households and clears the dirty entries of
+// households that no longer exist, in one savepoint
+bool writeKeys(QSqlDatabase &db, const QList<MatchedHousehold> &households, const QList<qint64> &gone) {
+    Savepoint savepoint(db);
+    if (!savepoint.isActive()) {
+        return false;
+    }
+    KeyWriter writer(db);
+    for (const MatchedHousehold &household : households) {
+        if (!writer.write(household.id, keysFor(household))) {
+            return false;
+        }
+    }
+    for (qint64 id : gone) {
+        if (!writer.clean(id)) {
+            return false;
+        }
+    }
+    return savepoint.release();
+}
+
+QString placeholders(int count) {
+    QStringList marks;
+    marks.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        marks << "?";
+    }
+    return marks.join(", ");
+}
+
+// Households sharing at least 40% of the probe's trigrams in one field, most
+// shared first. The postings come straight off the primary key and are counted
+// here, which saves SQLite a temporary B-tree for the grouping and ordering.
+bool addTrigramCandidates(QSqlDatabase &db, int field, const QStringList &trigrams, QSet<qint64> &candidates) {
+    if (trigrams.isEmpty()) {
+        return true;
+    }
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.prepare(QString("SELECT household_id FROM household_trigrams WHERE field = ? AND trigram IN (%1)")
+                      .arg(placeholders(trigrams.size())));
+    query.addBindValue(field);
+    for (const QString &trigram : trigrams) {
+        query.addBindValue(trigram);
+    }
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to look up trigram candidates:" << query.lastError().text();
+        return false;
+    }
+
+    QHash<qint64, int> shared;
+    while (query.next()) {
+        ++shared[query.value(0).toLongLong()];
+    }
+
+    const int minShared = std::max(2, static_cast<int>(std::ceil(trigrams.size() * 0.4)));
+    std::vector<std::pair<int, qint64>> ranked;
+    for (auto it = shared.cbegin(); it != shared.cend(); ++it) {
+        if (it.value() >= minShared) {
+            ranked.emplace_back(it.value(), it.key());
+        }
+    }
+    const size_t keep = std::min(ranked.size(), static_cast<size_t>(TrigramCandidates));
+    std::partial_sort(ranked.begin(), ranked.begin() + keep, ranked.end(),
+                      [](const auto &a, const auto &b) { return a.first != b.first ? a.first > b.first : a.second < b.second; });
+    for (size_t i = 0; i < keep; ++i) {
+        candidates.insert(ranked[i].second);
+    }
+    return true;
+}
+
+bool addExactCandidates(QSqlDatabase &db, const core::ClientMatchKeys &keys, QSet<qint64> &candidates) {
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.prepare("SELECT household_id FROM household_match_keys "
+                  "WHERE (phonetic_key = ? AND ? <> '') OR (phone_key = ? AND ? <> '') "
+                  "OR (address_key = ? AND ? <> '') LIMIT ?");
+    for (const QString &key : {keys.phonetic, keys.phone.right(7), keys.address}) {
+        query.addBindValue(key);
+        query.addBindValue(key);
+    }
+    query.addBindValue(ExactCandidates);
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to look up match key candidates:" << query.lastError().text();
+        return false;
+    }
+    while (query.next()) {
+        candidates.insert(query.value(0).toLongLong());
+    }
+    return true;
+}
+
+} // namespace
+
+QStringList clientMatchStatements() {
+    return {
+        "CREATE TABLE IF NOT EXISTS household_match_keys ("
+        "household_id INTEGER PRIMARY KEY, "
+        "name_key TEXT NOT NULL, "
+        "phonetic_key TEXT NOT NULL, "
+        "phone_key TEXT NOT NULL, "
+        "address_key TEXT NOT NULL);",
+        "CREATE INDEX IF NOT EXISTS idx_household_match_phonetic ON household_match_keys(phonetic_key);",
+        "CREATE INDEX IF NOT EXISTS idx_household_match_phone ON household_match_keys(phone_key);",
+        "CREATE INDEX IF NOT EXISTS idx_household_match_address ON household_match_keys(address_key);",
+
+        // Field 1 holds name trigrams, field 2 address trigrams
+        "CREATE TABLE IF NOT EXISTS household_trigrams ("
+        "field INTEGER NOT NULL, "
+        "trigram TEXT NOT NULL, "
+        "household_id INTEGER NOT NULL, "
+        "PRIMARY KEY (field, trigram, household_id)) WITHOUT ROWID;",
+        "CREATE INDEX IF NOT EXISTS idx_household_trigrams_household ON household_trigrams(household_id);",
+
+        // Households whose keys are missing or out of date
+        "CREATE TABLE IF NOT EXISTS household_match_dirty (household_id INTEGER PRIMARY KEY);",
+
+        "CREATE TRIGGER IF NOT EXISTS household_match_keys_ad AFTER DELETE ON household_match_keys "
+        "BEGIN DELETE FROM household_trigrams WHERE household_id = OLD.household_id; END;",
+        "CREATE TRIGGER IF NOT EXISTS households_match_keys_ai AFTER INSERT ON households "
+        "BEGIN INSERT OR IGNORE INTO household_match_dirty (household_id) VALUES (NEW.id); END;",
+        "CREATE TRIGGER IF NOT EXISTS households_match_keys_au AFTER UPDATE OF id, name, phone, address ON households "
+        "WHEN OLD.id IS NOT NEW.id OR OLD.name IS NOT NEW.name OR OLD.phone IS NOT NEW.phone "
+        "OR OLD.address IS NOT NEW.address "
+        "BEGIN "
+        "DELETE FROM household_match_keys WHERE household_id = OLD.id; "
+        "INSERT OR IGNORE INTO household_match_dirty (household_id) VALUES (NEW.id); "
+        "END;",
+        "CREATE TRIGGER IF NOT EXISTS households_match_keys_ad AFTER DELETE ON households "
+        "BEGIN "
+        "DELETE FROM household_match_keys WHERE household_id = OLD.id; "
+        "DELETE FROM household_match_dirty WHERE household_id = OLD.id; "
+        "END;",
+
+        // Existing households are keyed by the first refresh
+        "INSERT OR IGNORE INTO household_match_dirty (household_id) SELECT id FROM households;"
+    };
+}
+
+bool refreshClientMatchKeys(QSqlDatabase &db) {
+    // In id order, a batch at a time, so each read is a range on the primary key
+    qint64 after = 0;
+    while (true) {
+        QSqlQuery query(db);
+        query.setForwardOnly(true);
+        query.prepare("SELECT d.household_id, h.name, h.phone, h.address, h.id "
+                      "FROM household_match_dirty d LEFT JOIN households h ON h.id = d.household_id "
+                      "WHERE d.household_id > ? ORDER BY d.household_id LIMIT ?");
+        query.addBindValue(after);
+        query.addBindValue(RefreshBatch);
+        if (!query.exec()) {
+            qDebug() << "ERROR: Failed to read dirty households:" << query.lastError().text();
+            return false;
+        }
+
+        QList<MatchedHousehold> households;
+        QList<qint64> gone;
+        int rows = 0;
+        while (query.next()) {
+            ++rows;
+            after = query.value(0).toLongLong();
+            if (query.value(4).isNull()) {
+                gone << after;
+            } else {
+                households << readHousehold(query);
+            }
+        }
+        query.finish();
+
+        if (rows > 0 && !writeKeys(db, households, gone)) {
+            return false;
+        }
+        if (rows < RefreshBatch) {
+            return true;
+        }
+    }
+}
+
+bool updateClientMatchKeys(QSqlDatabase &db, qint64 householdId) {
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.prepare("SELECT id, name, phone, address FROM households WHERE id = ?");
+    query.addBindValue(householdId);
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to read household for match keys:" << query.lastError().text();
+        return false;
+    }
+    const bool found = query.next();
+    const MatchedHousehold household = found ? readHousehold(query) : MatchedHousehold();
+    query.finish();
+    return found ? writeKeys(db, {household}, {}) : writeKeys(db, {}, {householdId});
+}
+
+QList<ClientMatch> findClientMatches(QSqlDatabase &db, const QString &name, const QString &phone,
+                                     const QString &address, double minScore, int limit) {
+    QList<ClientMatch> matches;
+    if (!refreshClientMatchKeys(db)) {
+        qDebug() << "WARNING: Matching against possibly stale client match keys";
+    }
+
+    const core::ClientMatchKeys keys = core::clientMatchKeys(name, phone, address);
+    QSet<qint64> candidates;
+    if (!addExactCandidates(db, keys, candidates)
+        || !addTrigramCandidates(db, NameField, keys.nameTrigrams, candidates)
+        || !addTrigramCandidates(db, AddressField, keys.addressTrigrams, candidates)) {
+        return matches;
+    }
+    if (candidates.isEmpty()) {
+        return matches;
+    }
+
+    // Scored from the households themselves, so the result never lags a write
+    const QList<qint64> ids(candidates.cbegin(), candidates.cend());
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.prepare(QString("SELECT id, name, phone, address FROM households WHERE id IN (%1)")
+                      .arg(placeholders(ids.size())));
+    for (qint64 id : ids) {
+        query.addBindValue(id);
+    }
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to read candidate households:" << query.lastError().text();
+        return matches;
+    }
+    while (query.next()) {
+        const MatchedHousehold household = readHousehold(query);
+        const core::ClientMatchScore match = core::scoreClientMatch(keys, keysFor(household));
+        if (match.score >= minScore) {
+            matches.append(ClientMatch{household, match});
+        }
+    }
+
+    std::sort(matches.begin(), matches.end(), [](const ClientMatch &a, const ClientMatch &b) {
+        return a.match.score != b.match.score ? a.match.score > b.match.score : a.household.id < b.household.id;
+    });
+    if (limit > 0 && matches.size() > limit) {
+        matches.resize(limit);
+    }
+    return matches;
+}
+
+QList<DuplicatePair> findLikelyDuplicates(QSqlDatabase &db, double minScore) {
+    QElapsedTimer timer;
+    timer.start();
+
+    QList<DuplicatePair> pairs;
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    if (!query.exec("SELECT id, name, phone, address FROM households ORDER BY id")) {
+        qDebug() << "ERROR: Failed to read households for duplicate scan:" << query.lastError().text();
+        return pairs;
+    }
+
+    QList<MatchedHousehold> households;
+    std::vector<core::ClientMatchKeys> keys;
+    while (query.next()) {
+        households << readHousehold(query);
+        keys.push_back(keysFor(households.constLast()));
+    }
+    const int count = households.size();
+
+    // Blocks: posting lists of household indexes, ascending. Exact keys and
+    // trigrams share one hash, told apart by a prefix.
+    QHash<QString, std::vector<int>> blocks;
+    for (int i = 0; i < count; ++i) {
+        const core::ClientMatchKeys &k = keys[i];
+        if (!k.phonetic.isEmpty()) {
+            blocks["p:" + k.phonetic].push_back(i);
+        }
+        if (k.hasPhone()) {
+            blocks["t:" + k.phone.right(7)].push_back(i);
+        }
+        if (k.hasAddress()) {
+            blocks["a:" + k.address].push_back(i);
+        }
+        for (const QString &trigram : k.nameTrigrams) {
+            blocks["n3:" + trigram].push_back(i);
+        }
+        for (const QString &trigram : k.addressTrigrams) {
+            blocks["a3:" + trigram].push_back(i);
+        }
+    }
+
+    // Trigrams like " rd" or "son" say little and would pair up everyone, so
+    // common ones are skipped. Exact keys never are: a shared phone or address
+    // is the strongest signal, however many households share it.
+    const size_t commonBlock = static_cast<size_t>(std::max(50, count / 100));
+    constexpr int ExactMatch = 1000;
+    constexpr int MinSharedTrigrams = 3;
+
+    std::vector<int> shared(count, 0);
+    std::vector<int> touched;
+    for (int i = 0; i < count; ++i) {
+        const core::ClientMatchKeys &k = keys[i];
+        const auto visit = [&](const QString &block, int weight) {
+            const auto found = blocks.constFind(block);
+            if (found == blocks.constEnd() || (weight < ExactMatch && found->size() > commonBlock)) {
+                return;
+            }
+            // Pairs are scored once, from their lower index
+            for (auto j = std::upper_bound(found->begin(), found->end(), i); j != found->end(); ++j) {
+                if (shared[*j] == 0) {
+                    touched.push_back(*j);
+                }
+                shared[*j] += weight;
+            }
+        };
+
+        if (!k.phonetic.isEmpty()) {
+            visit("p:" + k.phonetic, ExactMatch);
+        }
+        if (k.hasPhone()) {
+            visit("t:" + k.phone.right(7), ExactMatch);
+        }
+        if (k.hasAddress()) {
+            visit("a:" + k.address, ExactMatch);
+        }
+        for (const QString &trigram : k.nameTrigrams) {
+            visit("n3:" + trigram, 1);
+        }
+        for (const QString &trigram : k.addressTrigrams) {
+            visit("a3:" + trigram, 1);
+        }
+
+        for (int j : touched) {
+            if (shared[j] >= MinSharedTrigrams) {
+                const core::ClientMatchScore match = core::scoreClientMatch(k, keys[j]);
+                if (match.score >= minScore) {
+                    pairs.append(DuplicatePair{households[i], households[j], match});
+                }
+            }
+            shared[j] = 0;
+        }
+        touched.clear();
+    }
+
+    std::sort(pairs.begin(), pairs.end(), [](const DuplicatePair &a, const DuplicatePair &b) {
+        if (a.match.score != b.match.score) {
+            return a.match.score > b.match.score;
+        }
+        return a.first.id != b.first.id ? a.first.id < b.first.id : a.second.id < b.second.id;
+    });
+
+    qDebug() << "Duplicate scan:" << count << "households," << pairs.size()
+             << "likely duplicate pairs in" << timer.elapsed() << "ms";
+    return pairs;
+}
+
+} // namespace firewood::db
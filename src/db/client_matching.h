@@ -0,0 +1,88 @@
+#pragma once
+
+#include "ClientMatch.h"
+#include <QList>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+
+namespace firewood::db {
+
+/**
+ * @brief A household as shown next to a possible duplicate
+ */
+struct MatchedHousehold {
+    qint64 id = 0;
+    QString name;
+    QString phone;
+    QString address;
+};
+
+struct ClientMatch {
+    MatchedHousehold household;
+    core::ClientMatchScore match;
+};
+
+struct DuplicatePair {
+    MatchedHousehold first;     // The older record (lower id)
+    MatchedHousehold second;
+    core::ClientMatchScore match;
+};
+
+/**
+ * @brief Match key and trigram tables, their indexes and the triggers that expire them
+ *
+ * household_match_keys holds each household's core::ClientMatchKeys, indexed
+ * for exact lookups by phonetic code, canonical address and the last seven
+ * phone digits (so numbers with and without an area code meet).
+ * household_trigrams is the fuzzy candidate index: one row per distinct name or
+ * address trigram of a household, keyed (field, trigram, household_id).
+ *
+ * The keys are computed in C++, so SQL triggers can only mark them stale:
+ * inserting a household, or changing its name, phone or address, adds it to
+ * household_match_dirty (and drops its old keys); deleting it drops both.
+ * refreshClientMatchKeys() drains that list. Existing households are queued
+ * here and keyed by the first refresh. Does not start a transaction.
+ */
+QStringList clientMatchStatements();
+
+/**
+ * @brief Computes the keys of every household on the dirty list
+ *
+ * Reads household_match_dirty by primary key, so with nothing dirty it costs
+ * one index probe; runs before each lookup so households written by imports,
+ * sample data or other tools are matched too. Each batch is written in a
+ * savepoint, so it is atomic whether or not a transaction is open.
+ * @return false on a database error; the failed batch stays dirty
+ */
+bool refreshClientMatchKeys(QSqlDatabase &db);
+
+/**
+ * @brief Recomputes one household's keys, as soon as it has been saved
+ *
+ * Also takes it off the dirty list.
+ */
+bool updateClientMatchKeys(QSqlDatabase &db, qint64 householdId);
+
+/**
+ * @brief Households that look like the one being entered, best match first
+ *
+ * Candidates come from the exact key indexes and from the households sharing
+ * enough name or address trigrams; only they are read and scored.
+ */
+QList<ClientMatch> findClientMatches(QSqlDatabase &db, const QString &name, const QString &phone,
+                                     const QString &address, double minScore = core::LikelyDuplicateScore,
+                                     int limit = 5);
+
+/**
+ * @brief Every pair of households scoring at least minScore, best first
+ *
+ * Reads the households once and blocks in memory: two households are only
+ * scored when they share a phonetic code, phone or canonical address (always
+ * compared, however many share it), or at least three trigrams that are not
+ * among the most common. The work grows with the number of similar records,
+ * not with the square of the client base.
+ */
+QList<DuplicatePair> findLikelyDuplicates(QSqlDatabase &db, double minScore = core::LikelyDuplicateScore);
+
+} // namespace firewood::db
@@ -0,0 +1,222 @@
+#include "counters.h"
+#include "Codes.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+#include <cmath>
+
+namespace firewood::db {
+
+namespace {
+
+enum class Source { Orders, VolunteerHours };
+
+// Recomputed value for one counter; %1 is a condition on the source row's household_id
+struct Counter {
+    Source source;
+    const char *column;
+    QString expression;
+};
+
+// A table holding counters, and how its rows relate to a household
+struct CounterTable {
+    const char *table;
+    const char *key;
+    const char *ownsHousehold;    // %1 = household id column of a source row
+    const char *ownedBy;          // %1 = a household id; selects the rows owning it
+    QList<Source> sources;
+};
+
+const QList<Counter> &counters() {
+    static const QList<Counter> list = {
+        {Source::Orders, "order_count",
+         "(SELECT COUNT(*) FROM orders o WHERE %1)"},
+        {Source::Orders, "last_order_date",
+         "(SELECT o.order_date FROM orders o WHERE %1 ORDER BY o.order_day DESC, o.id DESC LIMIT 1)"},
+        {Source::Orders, "wood_credit_received",
+         "(SELECT COALESCE(SUM(o.delivered_cords), 0) FROM orders o WHERE %1 AND o.payment_code = "
+             + QString::number(core::code(core::PaymentMethod::WorkForWood)) + ")"},
+        {Source::VolunteerHours, "last_volunteer_date",
+         "(SELECT v.date FROM volunteer_hours v WHERE %1 ORDER BY v.day DESC, v.id DESC LIMIT 1)"}
+    };
+    return list;
+}
+
+const QList<CounterTable> &counterTables() {
+    static const QList<CounterTable> list = {
+        {"households", "id",
+         "%1 = households.id",
+         "id = %1",
+         {Source::Orders, Source::VolunteerHours}},
+        {"client_profiles", "user_id",
+         "%1 IN (SELECT household_id FROM household_user_mapping WHERE user_id = client_profiles.user_id)",
+         "user_id IN (SELECT user_id FROM household_user_mapping WHERE household_id = %1)",
+         {Source::Orders}},
+        {"volunteer_profiles", "user_id",
+         "%1 IN (SELECT household_id FROM household_user_mapping WHERE user_id = volunteer_profiles.user_id)",
+         "user_id IN (SELECT user_id FROM household_user_mapping WHERE household_id = %1)",
+         {Source::VolunteerHours}}
+    };
+    return list;
+}
+
+QString householdColumn(Source source) {
+    return source == Source::Orders ? "o.household_id" : "v.household_id";
+}
+
+QString expectedValue(const CounterTable &table, const Counter &counter) {
+    return counter.expression.arg(QString(table.ownsHousehold).arg(householdColumn(counter.source)));
+}
+
+// "col = (...), col = (...)" for the table's counters fed by the given sources
+QString assignments(const CounterTable &table, const QList<Source> &sources) {
+    QStringList parts;
+    for (const Counter &counter : counters()) {
+        if (table.sources.contains(counter.source) && sources.contains(counter.source)) {
+            parts << QString("%1 = %2").arg(counter.column, expectedValue(table, counter));
+        }
+    }
+    return parts.join(", ");
+}
+
+// Trigger body statements refreshing the counters of every row that owns a household
+QStringList refreshStatements(Source source, const QString &householdId, const QString &extraCondition = QString()) {
+    QStringList statements;
+    for (const CounterTable &table : counterTables()) {
+        if (!table.sources.contains(source)) {
+            continue;
+        }
+        QString sql = QString("UPDATE %1 SET %2 WHERE %3")
+            .arg(table.table, assignments(table, {source}), QString(table.ownedBy).arg(householdId));
+        if (!extraCondition.isEmpty()) {
+            sql += " AND " + extraCondition;
+        }
+        statements << sql + ";";
+    }
+    return statements;
+}
+
+QString trigger(const QString &name, const QString &event, const QStringList &body) {
+    return QString("CREATE TRIGGER IF NOT EXISTS %1\n%2\nBEGIN\n  %3\nEND;")
+        .arg(name, event, body.join("\n  "));
+}
+
+// Triggers for a source table whose rows belong to a household
+QStringList sourceTriggers(Source source, const QString &table, const QString &updateColumns) {
+    const QString prefix = "trg_" + table + "_counters";
+    return {
+        trigger(prefix + "_insert", "AFTER INSERT ON " + table,
+                refreshStatements(source, "NEW.household_id")),
+        trigger(prefix + "_delete", "AFTER DELETE ON " + table,
+                refreshStatements(source, "OLD.household_id")),
+        trigger(prefix + "_update", "AFTER UPDATE OF " + updateColumns + " ON " + table,
+                refreshStatements(source, "NEW.household_id")
+                    + refreshStatements(source, "OLD.household_id", "OLD.household_id IS NOT NEW.household_id"))
+    };
+}
+
+// Profile rows follow their user's households when the mapping changes
+QStringList mappingRefreshStatements(const QString &userId) {
+    QStringList statements;
+    for (const CounterTable &table : counterTables()) {
+        if (QLatin1String(table.key) != QLatin1String("user_id")) {
+            continue;
+        }
+        statements << QString("UPDATE %1 SET %2 WHERE user_id = %3;")
+            .arg(table.table, assignments(table, table.sources), userId);
+    }
+    return statements;
+}
+
+bool sameValue(const QVariant &stored, const QVariant &expected) {
+    if (stored.isNull() || expected.isNull()) {
+        return stored.isNull() == expected.isNull();
+    }
+    if (expected.typeId() == QMetaType::Double || stored.typeId() == QMetaType::Double) {
+        return std::abs(stored.toDouble() - expected.toDouble()) < 1e-9;
+    }
+    return stored.toString() == expected.toString();
+}
+
+} // namespace
+
+QStringList counterTriggerStatements() {
+    QStringList statements;
+    statements << sourceTriggers(Source::Orders, "orders",
+                                 "household_id, order_date, delivered_cords, payment_method");
+    statements << sourceTriggers(Source::VolunteerHours, "volunteer_hours", "household_id, date");
+    statements << trigger("trg_household_user_mapping_counters_insert", "AFTER INSERT ON household_user_mapping",
+                          mappingRefreshStatements("NEW.user_id"));
+    statements << trigger("trg_household_user_mapping_counters_delete", "AFTER DELETE ON household_user_mapping",
+                          mappingRefreshStatements("OLD.user_id"));
+    statements << trigger("trg_household_user_mapping_counters_update",
+                          "AFTER UPDATE OF household_id, user_id ON household_user_mapping",
+                          mappingRefreshStatements("NEW.user_id") + mappingRefreshStatements("OLD.user_id"));
+    return statements;
+}
+
+QStringList counterRebuildStatements() {
+    QStringList statements;
+    for (const CounterTable &table : counterTables()) {
+        statements << QString("UPDATE %1 SET %2;").arg(table.table, assignments(table, table.sources));
+    }
+    return statements;
+}
+
+QList<CounterMismatch> verifyClientCounters(QSqlDatabase &db) {
+    QList<CounterMismatch> mismatches;
+
+    for (const CounterTable &table : counterTables()) {
+        QStringList columns;
+        QList<const Counter *> checked;
+        for (const Counter &counter : counters()) {
+            if (table.sources.contains(counter.source)) {
+                columns << counter.column << expectedValue(table, counter);
+                checked << &counter;
+            }
+        }
+
+        QSqlQuery query(db);
+        if (!query.exec(QString("SELECT %1, %2 FROM %3;").arg(table.key, columns.join(", "), table.table))) {
+            qDebug() << "ERROR: Failed to verify counters in" << table.table << ":" << query.lastError().text();
+            continue;
+        }
+
+        while (query.next()) {
+            for (int i = 0; i < checked.size(); ++i) {
+                const QVariant stored = query.value(1 + 2 * i);
+                const QVariant expected = query.value(2 + 2 * i);
+                if (!sameValue(stored, expected)) {
+                    mismatches.append({table.table, query.value(0).toLongLong(), checked[i]->column, stored, expected});
+                }
+            }
+        }
+    }
+
+    return mismatches;
+}
+
+bool rebuildClientCounters(QSqlDatabase &db) {
+    if (!db.transaction()) {
+        qDebug() << "ERROR: Failed to start transaction:" << db.lastError().text();
+        return false;
+    }
+
+    QSqlQuery query(db);
+    for (const QString &sql : counterRebuildStatements()) {
+        if (!query.exec(sql)) {
+            qDebug() << "ERROR: Failed to rebuild counters:" << query.lastError().text();
+            qDebug() << "SQL:" << sql;
+            db.rollback();
+            return false;
+        }
+    }
+
+    if (!db.commit()) {
+        qDebug() << "ERROR: Failed to commit rebuilt counters:" << db.lastError().text();
+        return false;
+    }
+    return true;
+}
+
+} // namespace firewood::db
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QList>
+
+namespace firewood::db {
+
+/**
+ * @brief A denormalized counter whose stored value differs from the source rows
+ */
+struct CounterMismatch {
+    QString table;                // households, client_profiles or volunteer_profiles
+    qint64 id = 0;                // households.id or the profile's user_id
+    QString column;
+    QVariant stored;
+    QVariant expected;
+};
+
+/**
+ * @brief Triggers that keep the per-client counters current
+ *
+ * order_count, last_order_date and wood_credit_received (cords delivered on
+ * Work-for-Wood orders) follow the orders table; last_volunteer_date follows
+ * volunteer_hours. Counters are kept on households and, through
+ * household_user_mapping, on client_profiles and volunteer_profiles. Each trigger
+ * recomputes only the rows owning the changed household, so the values are exact
+ * rather than incremented.
+ */
+QStringList counterTriggerStatements();
+
+/**
+ * @brief UPDATE statements that recompute every counter from the source tables
+ *
+ * Does not start a transaction; used by migrations and rebuildClientCounters().
+ */
+QStringList counterRebuildStatements();
+
+/**
+ * @brief Compares every stored counter with its recomputed value
+ */
+QList<CounterMismatch> verifyClientCounters(QSqlDatabase &db);
+
+/**
+ * @brief Recomputes all counters in one transaction
+ * @return true if successful, false otherwise
+ */
+bool rebuildClientCounters(QSqlDatabase &db);
+
+} // namespace firewood::db
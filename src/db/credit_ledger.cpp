@@ -0,0 +1,276 @@
+#include "credit_ledger.h"
+#include "Codes.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+
+namespace firewood::db {
+
+namespace {
+
+QString kindCode(CreditEntryKind kind) {
+    return QString::number(static_cast<int>(kind));
+}
+
+const QString todayDay = "CAST(julianday('now', 'localtime') + 0.5 AS INTEGER)";
+
+// True while a household takes part in Work-for-Wood, flagged on the household
+// or on a volunteer profile mapped to it; %1 = a household id
+const QString participates =
+    "(EXISTS (SELECT 1 FROM households WHERE id = %1 AND works_for_wood = 1) "
+    "OR EXISTS (SELECT 1 FROM household_user_mapping m JOIN volunteer_profiles v ON v.user_id = m.user_id "
+    "WHERE m.household_id = %1 AND v.works_for_wood = 1))";
+
+// A source row that posts its own entries
+struct CreditSource {
+    const char *table;
+    const char *column;         // credit_ledger column holding the source row's id
+    CreditEntryKind kind;
+    const char *memo;
+    QString updateColumns;
+    QString day;                // %1 = NEW or OLD
+    QString target;             // Cords the row should have posted in total; %1 = NEW or OLD
+};
+
+QList<CreditSource> creditSources() {
+    const QString workForWood = QString::number(core::code(core::PaymentMethod::WorkForWood));
+    return {
+        // Hours keep earning once posted, even if the household later leaves the program
+        {"volunteer_hours", "volunteer_hours_id", CreditEntryKind::Earned, "Volunteer hours",
+         "household_id, hours",
+         "%1.day",
+         "CASE WHEN " + participates.arg("%1.household_id")
+             + " OR EXISTS (SELECT 1 FROM credit_ledger WHERE volunteer_hours_id = %1.id"
+               " AND household_id = %1.household_id)"
+             + " THEN round(COALESCE(%1.hours, 0) / " + QString::number(HoursPerCreditCord, 'f', 2)
+             + ", 2) ELSE 0 END"},
+        {"orders", "order_id", CreditEntryKind::Redeemed, "Work-for-Wood order",
+         "household_id, delivered_cords, payment_method",
+         "COALESCE(%1.delivery_day, %1.order_day)",
+         "CASE WHEN %1.payment_code = " + workForWood
+             + " THEN -round(COALESCE(%1.delivered_cords, 0), 2) ELSE 0 END"}
+    };
+}
+
+// Posts the difference between a source row's target and what it already posted
+// for a household. Skipped when the household is gone (its entries are deleted
+// with it) or nothing changed.
+QString postDifference(const CreditSource &source, const QString &row, const QString &householdId,
+                       const QString &target, const QString &condition = QString()) {
+    QString sql = QString("INSERT INTO credit_ledger (household_id, day, kind, cords, %1, memo)\n"
+                          "    SELECT %2, COALESCE(%3, %4), %5, delta, %6.id, '%7' FROM (\n"
+                          "      SELECT round(%8 - COALESCE((SELECT SUM(cords) FROM credit_ledger "
+                          "WHERE %1 = %6.id AND household_id = %2), 0), 2) AS delta)\n"
+                          "    WHERE delta <> 0 AND EXISTS (SELECT 1 FROM households WHERE id = %2)")
+        .arg(source.column, householdId, source.day.arg(row), todayDay, kindCode(source.kind), row,
+             source.memo, target);
+    if (!condition.isEmpty()) {
+        sql += " AND " + condition;
+    }
+    return sql + ";";
+}
+
+QString trigger(const QString &name, const QString &event, const QStringList &body) {
+    return QString("CREATE TRIGGER IF NOT EXISTS %1\n%2\nBEGIN\n  %3\nEND;")
+        .arg(name, event, body.join("\n  "));
+}
+
+QStringList sourceTriggers(const CreditSource &source) {
+    const QString prefix = QString("trg_%1_credit").arg(source.table);
+    return {
+        trigger(prefix + "_insert", QString("AFTER INSERT ON %1").arg(source.table),
+                {postDifference(source, "NEW", "NEW.household_id", source.target.arg("NEW"))}),
+        trigger(prefix + "_update", QString("AFTER UPDATE OF %1 ON %2").arg(source.updateColumns, source.table),
+                {postDifference(source, "OLD", "OLD.household_id", "0", "OLD.household_id IS NOT NEW.household_id"),
+                 postDifference(source, "NEW", "NEW.household_id", source.target.arg("NEW"))}),
+        trigger(prefix + "_delete", QString("AFTER DELETE ON %1").arg(source.table),
+                {postDifference(source, "OLD", "OLD.household_id", "0")})
+    };
+}
+
+// Profile balance: the sum over the user's households; %1 = a user id
+const QString profileBalance =
+    "(SELECT COALESCE(SUM(h.credit_balance), 0) FROM households h "
+    "WHERE h.id IN (SELECT household_id FROM household_user_mapping WHERE user_id = %1))";
+
+QString refreshProfiles(const QString &condition) {
+    return QString("UPDATE client_profiles SET credit_balance = %1 WHERE %2;")
+        .arg(profileBalance.arg("client_profiles.user_id"), condition);
+}
+
+} // namespace
+
+QString toString(CreditEntryKind kind) {
+    switch (kind) {
+    case CreditEntryKind::Earned:
+        return "Earned";
+    case CreditEntryKind::Redeemed:
+        return "Redeemed";
+    case CreditEntryKind::Adjustment:
+    default:
+        return "Adjustment";
+    }
+}
+
+QStringList creditLedgerStatements() {
+    QStringList statements = {
+        "CREATE TABLE IF NOT EXISTS credit_ledger (\n"
+        "  id INTEGER PRIMARY KEY AUTOINCREMENT,\n"
+        "  household_id INTEGER NOT NULL,\n"
+        "  day INTEGER NOT NULL,\n"
+        "  kind INTEGER NOT NULL,\n"
+        "  cords REAL NOT NULL,\n"
+        "  balance REAL,\n"
+        "  volunteer_hours_id INTEGER,\n"
+        "  order_id INTEGER,\n"
+        "  memo TEXT,\n"
+        "  created_by TEXT,\n"
+        "  created_at TEXT DEFAULT CURRENT_TIMESTAMP,\n"
+        "  FOREIGN KEY (household_id) REFERENCES households(id) ON DELETE CASCADE\n"
+        ");",
+        // Statements and the previous balance read this index backwards from the new id
+        "CREATE INDEX IF NOT EXISTS idx_credit_ledger_household ON credit_ledger(household_id, id);",
+        "CREATE INDEX IF NOT EXISTS idx_credit_ledger_volunteer_hours ON credit_ledger(volunteer_hours_id) "
+        "WHERE volunteer_hours_id IS NOT NULL;",
+        "CREATE INDEX IF NOT EXISTS idx_credit_ledger_order ON credit_ledger(order_id) "
+        "WHERE order_id IS NOT NULL;",
+
+        trigger("trg_credit_ledger_balance", "AFTER INSERT ON credit_ledger", {
+            "UPDATE credit_ledger SET balance = round(NEW.cords + COALESCE("
+            "(SELECT p.balance FROM credit_ledger p WHERE p.household_id = NEW.household_id AND p.id < NEW.id "
+            "ORDER BY p.id DESC LIMIT 1), 0), 2) WHERE id = NEW.id;",
+            "UPDATE households SET credit_balance = (SELECT balance FROM credit_ledger WHERE id = NEW.id) "
+            "WHERE id = NEW.household_id;",
+            refreshProfiles("user_id IN (SELECT user_id FROM household_user_mapping "
+                            "WHERE household_id = NEW.household_id)")
+        }),
+        // Entries are permanent once their balance is set; corrections are new entries.
+        // Deletes are only allowed when the household itself is deleted.
+        trigger("trg_credit_ledger_no_update", "BEFORE UPDATE ON credit_ledger\nWHEN OLD.balance IS NOT NULL",
+                {"SELECT RAISE(ABORT, 'Credit ledger entries cannot be changed; record an adjustment');"}),
+        trigger("trg_credit_ledger_no_delete",
+                "BEFORE DELETE ON credit_ledger\n"
+                "WHEN EXISTS (SELECT 1 FROM households WHERE id = OLD.household_id)",
+                {"SELECT RAISE(ABORT, 'Credit ledger entries cannot be deleted; record an adjustment');"}),
+        trigger("trg_households_credit_balance",
+                "BEFORE UPDATE OF credit_balance ON households\n"
+                "WHEN NEW.credit_balance IS NOT OLD.credit_balance AND NEW.credit_balance IS NOT COALESCE("
+                "(SELECT balance FROM credit_ledger WHERE household_id = NEW.id ORDER BY id DESC LIMIT 1), 0)",
+                {"SELECT RAISE(ABORT, 'Credit balances are kept by the credit ledger');"})
+    };
+
+    for (const CreditSource &source : creditSources()) {
+        statements << sourceTriggers(source);
+    }
+
+    // Profiles follow their user's households when the mapping changes
+    statements << trigger("trg_household_user_mapping_credit_insert", "AFTER INSERT ON household_user_mapping",
+                          {refreshProfiles("user_id = NEW.user_id")});
+    statements << trigger("trg_household_user_mapping_credit_delete", "AFTER DELETE ON household_user_mapping",
+                          {refreshProfiles("user_id = OLD.user_id")});
+    statements << trigger("trg_household_user_mapping_credit_update",
+                          "AFTER UPDATE OF household_id, user_id ON household_user_mapping",
+                          {refreshProfiles("user_id = NEW.user_id"), refreshProfiles("user_id = OLD.user_id")});
+    return statements;
+}
+
+QStringList creditOpeningBalanceStatements() {
+    return {
+        QString("INSERT INTO credit_ledger (household_id, day, kind, cords, memo, created_by)\n"
+                "  SELECT id, %1, %2, round(credit_balance, 2), 'Opening balance', 'System' FROM households\n"
+                "  WHERE round(COALESCE(credit_balance, 0), 2) <> 0 ORDER BY id;")
+            .arg(todayDay, kindCode(CreditEntryKind::Adjustment)),
+        "UPDATE households SET credit_balance = 0 WHERE credit_balance IS NULL "
+        "OR id NOT IN (SELECT household_id FROM credit_ledger);",
+        refreshProfiles("1")
+    };
+}
+
+double creditBalance(QSqlDatabase &db, qint64 householdId) {
+    QSqlQuery query(db);
+    query.prepare("SELECT credit_balance FROM households WHERE id = ?");
+    query.addBindValue(householdId);
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to read credit balance:" << query.lastError().text();
+        return 0;
+    }
+    return query.next() ? query.value(0).toDouble() : 0;
+}
+
+double creditPostedForOrder(QSqlDatabase &db, qint64 householdId, qint64 orderId) {
+    QSqlQuery query(db);
+    query.prepare("SELECT COALESCE(SUM(cords), 0) FROM credit_ledger WHERE order_id = ? AND household_id = ?");
+    query.addBindValue(orderId);
+    query.addBindValue(householdId);
+    if (!query.exec() || !query.next()) {
+        qDebug() << "ERROR: Failed to read order credit:" << query.lastError().text();
+        return 0;
+    }
+    return query.value(0).toDouble();
+}
+
+QList<CreditEntry> creditStatement(QSqlDatabase &db, qint64 householdId, const core::DateRange &period) {
+    QList<CreditEntry> entries;
+
+    QString sql = "SELECT id, day, kind, cords, balance, volunteer_hours_id, order_id, memo, created_by "
+                  "FROM credit_ledger WHERE household_id = ?";
+    if (period.isValid()) {
+        sql += " AND day >= ? AND day < ?";
+    }
+    sql += " ORDER BY id";
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.prepare(sql);
+    query.addBindValue(householdId);
+    if (period.isValid()) {
+        query.addBindValue(period.firstDay());
+        query.addBindValue(period.endDay());
+    }
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to load credit statement:" << query.lastError().text();
+        return entries;
+    }
+
+    while (query.next()) {
+        CreditEntry entry;
+        entry.id = query.value(0).toLongLong();
+        entry.date = QDate::fromJulianDay(query.value(1).toLongLong());
+        entry.kind = static_cast<CreditEntryKind>(query.value(2).toInt());
+        entry.cords = query.value(3).toDouble();
+        entry.balance = query.value(4).toDouble();
+        entry.volunteerHoursId = query.value(5).toLongLong();
+        entry.orderId = query.value(6).toLongLong();
+        entry.memo = query.value(7).toString();
+        entry.createdBy = query.value(8).toString();
+        entries << entry;
+    }
+    return entries;
+}
+
+bool addCreditAdjustment(QSqlDatabase &db, qint64 householdId, double cords,
+                         const QString &memo, const QString &createdBy, double *balance) {
+    QSqlQuery query(db);
+    query.prepare("INSERT INTO credit_ledger (household_id, day, kind, cords, memo, created_by) "
+                  "VALUES (?, ?, ?, round(?, 2), ?, ?)");
+    query.addBindValue(householdId);
+    query.addBindValue(QDate::currentDate().toJulianDay());
+    query.addBindValue(static_cast<int>(CreditEntryKind::Adjustment));
+    query.addBindValue(cords);
+    query.addBindValue(memo);
+    query.addBindValue(createdBy);
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to record credit adjustment:" << query.lastError().text();
+        return false;
+    }
+
+    if (balance) {
+        QSqlQuery read(db);
+        read.prepare("SELECT balance FROM credit_ledger WHERE id = ?");
+        read.addBindValue(query.lastInsertId());
+        *balance = read.exec() && read.next() ? read.value(0).toDouble() : 0;
+    }
+    return true;
+}
+
+} // namespace firewood::db
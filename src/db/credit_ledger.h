@@ -0,0 +1,101 @@
+#pragma once
+
+#include "DateRange.h"
+#include <QDate>
+#include <QList>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+
+namespace firewood::db {
+
+/**
+ * @brief Why a credit_ledger entry was made
+ *
+ * Stored in credit_ledger.kind, so never renumber an existing value.
+ */
+enum class CreditEntryKind : int {
+    Earned = 1,         // Volunteer hours by a Work-for-Wood household
+    Redeemed = 2,       // Cords delivered on a Work-for-Wood order
+    Adjustment = 3      // Entered by hand, including opening balances
+};
+
+QString toString(CreditEntryKind kind);
+
+/**
+ * @brief Volunteer hours that earn one cord of Work-for-Wood credit
+ *
+ * Written into the ledger triggers; changing it affects new hours only.
+ */
+constexpr double HoursPerCreditCord = 8.0;
+
+/**
+ * @brief One line of a household's credit statement
+ */
+struct CreditEntry {
+    qint64 id = 0;
+    QDate date;
+    CreditEntryKind kind = CreditEntryKind::Adjustment;
+    double cords = 0;           // Signed; redemptions are negative
+    double balance = 0;         // Running balance after this entry
+    qint64 volunteerHoursId = 0;
+    qint64 orderId = 0;
+    QString memo;
+    QString createdBy;
+};
+
+/**
+ * @brief The credit ledger table, its indexes and the triggers that keep it
+ *
+ * credit_ledger is append-only: every entry stores the household's running
+ * balance after it, computed on insert from the household's previous entry, and
+ * the same trigger copies that balance to households.credit_balance and, through
+ * household_user_mapping, to client_profiles.credit_balance. Both columns are
+ * owned by the ledger; any other change to them is rejected.
+ *
+ * Volunteer hours (for Work-for-Wood households) and Work-for-Wood orders post
+ * their own entries. When hours or an order change or are deleted, the
+ * difference from what was already posted is entered as a new line, so the
+ * ledger stays a full audit trail. Does not start a transaction.
+ */
+QStringList creditLedgerStatements();
+
+/**
+ * @brief Opening Adjustment entries for the credit_balance values already stored
+ *
+ * Run once, after creditLedgerStatements().
+ */
+QStringList creditOpeningBalanceStatements();
+
+/**
+ * @brief Current balance, read from households.credit_balance by primary key
+ * @return 0 for an unknown household or on a query error
+ */
+double creditBalance(QSqlDatabase &db, qint64 householdId);
+
+/**
+ * @brief Net cords an order has posted to a household's ledger so far
+ *
+ * Lets an order form preview the balance after an edit without counting the
+ * order's own redemption twice.
+ */
+double creditPostedForOrder(QSqlDatabase &db, qint64 householdId, qint64 orderId);
+
+/**
+ * @brief A household's entries dated in a period, in posting order
+ *
+ * An invalid period returns the whole history. One range over the ledger's
+ * (household_id, id) index; balances are running totals in posting order.
+ */
+QList<CreditEntry> creditStatement(QSqlDatabase &db, qint64 householdId,
+                                   const core::DateRange &period = core::DateRange());
+
+/**
+ * @brief Records a manual adjustment dated today
+ * @param balance Receives the balance after the adjustment, if not null
+ * @return false if the entry was not recorded
+ */
+bool addCreditAdjustment(QSqlDatabase &db, qint64 householdId, double cords,
+                         const QString &memo, const QString &createdBy, double *balance = nullptr);
+
+} // namespace firewood::db
@@ -0,0 +1,44 @@
+#include "data_version.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+
+namespace firewood::db {
+
+QStringList versionedTables() {
+    return {"orders", "households", "delivery_log", "volunteer_hours", "income"};
+}
+
+QStringList dataVersionStatements() {
+    QStringList statements = {
+        "CREATE TABLE IF NOT EXISTS data_versions (\n"
+        "  table_name TEXT PRIMARY KEY,\n"
+        "  version INTEGER NOT NULL DEFAULT 0\n"
+        ") WITHOUT ROWID;"
+    };
+
+    for (const QString &table : versionedTables()) {
+        const QString bump = QString("UPDATE data_versions SET version = version + 1 WHERE table_name = '%1';").arg(table);
+        statements << QString("INSERT OR IGNORE INTO data_versions (table_name, version) VALUES ('%1', 0);").arg(table);
+        for (const char *event : {"INSERT", "UPDATE", "DELETE"}) {
+            statements << QString("CREATE TRIGGER IF NOT EXISTS trg_%1_version_%2\n"
+                                  "AFTER %3 ON %1\n"
+                                  "BEGIN\n  %4\nEND;")
+                .arg(table, QString::fromLatin1(event).toLower(), QString::fromLatin1(event), bump);
+        }
+    }
+    return statements;
+}
+
+qint64 dataVersion(QSqlDatabase &db, const QString &table) {
+    QSqlQuery query(db);
+    query.prepare("SELECT version FROM data_versions WHERE table_name = ?");
+    query.addBindValue(table);
+    if (!query.exec() || !query.next()) {
+        qDebug() << "ERROR: Failed to read data version for" << table << ":" << query.lastError().text();
+        return -1;
+    }
+    return query.value(0).toLongLong();
+}
+
+} // namespace firewood::db
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+
+namespace firewood::db {
+
+/**
+ * @brief Tables whose changes are counted in data_versions
+ */
+QStringList versionedTables();
+
+/**
+ * @brief The data_versions table, its rows and the triggers that bump them
+ *
+ * Every INSERT, UPDATE or DELETE on a versioned table adds one to that table's
+ * version, whichever connection made it. Caches remember the version they were
+ * filled at and drop their contents when it moves. All statements are
+ * idempotent, so a later migration can run them again after adding a table.
+ */
+QStringList dataVersionStatements();
+
+/**
+ * @brief Current change counter for a versioned table
+ * @return The version, or -1 if it could not be read
+ */
+qint64 dataVersion(QSqlDatabase &db, const QString &table);
+
+} // namespace firewood::db
@@ -1,9 +1,16 @@
 #include "database.h"
+#include "counters.h"
+#include "credit_ledger.h"
+#include "client_matching.h"
+#include "data_version.h"
+#include "shift_signup.h"
+#include "Codes.h"
 #include <QSqlError>
 #include <QSqlQuery>
 #include <QFile>
 #include <QFileInfo>
 #include <QDir>
+#include <QMap>
 #include <QStandardPaths>
 #include <QCoreApplication>
 #include <QDebug>
@@ -23,6 +30,29 @@ static void ensureAppDataPath(QString &dbFilePath) {
     qDebug() << "Database file path:" << dbFilePath;
 }
 
+static QString codeCaseExpression(const QString &column, const QList<core::CodeName> &codes) {
+    QString sql = QString("CASE lower(trim(%1))").arg(column);
+    for (const core::CodeName &entry : codes) {
+        sql += QString(" WHEN '%1' THEN %2").arg(QString::fromLatin1(entry.name).toLower()).arg(entry.code);
+    }
+    return sql + " END";
+}
+
+// Rows written while enforcement was off may point at missing parents. They are
+// left in place (deleting them could lose history) but reported here.
+static void reportForeignKeyViolations(QSqlDatabase &db) {
+    QSqlQuery query(db);
+    QMap<QString, int> orphans;
+    if (query.exec("PRAGMA foreign_key_check;")) {
+        while (query.next()) {
+            orphans[query.value(0).toString() + " -> " + query.value(2).toString()]++;
+        }
+    }
+    for (auto it = orphans.cbegin(); it != orphans.cend(); ++it) {
+        qDebug() << "Warning: Orphaned rows in" << it.key() << ":" << it.value();
+    }
+}
+
 static void runMigrations(QSqlDatabase &db) {
     qDebug() << "Running database migrations...";
     
@@ -1011,7 +1041,991 @@ static void runMigrations(QSqlDatabase &db) {
         version = 12;
         qDebug() << "Migration 12 completed successfully";
     }
-    
+
+    // Migration 13: Trigger-maintained inventory alert state and history
+    if (version < 13) {
+        qDebug() << "Running migration 13: Creating inventory alert state tracking...";
+
+        // Current alert level per item ('ok', 'low' or 'critical'), kept in sync by triggers
+        if (!query.exec("CREATE TABLE IF NOT EXISTS inventory_alert_state (\n"
+                       "  item_id INTEGER PRIMARY KEY,\n"
+                       "  level TEXT NOT NULL DEFAULT 'ok',\n"
+                       "  changed_at TEXT DEFAULT CURRENT_TIMESTAMP,\n"
+                       "  FOREIGN KEY (item_id) REFERENCES inventory_items(id) ON DELETE CASCADE\n"
+                       ");")) {
+            qDebug() << "ERROR: Failed to create inventory_alert_state table:" << query.lastError().text();
+            db.rollback();
+            return;
+        }
+
+        // Every level transition (ok -> low -> critical and back)
+        if (!query.exec("CREATE TABLE IF NOT EXISTS inventory_alert_history (\n"
+                       "  id INTEGER PRIMARY KEY AUTOINCREMENT,\n"
+                       "  item_id INTEGER NOT NULL,\n"
+                       "  old_level TEXT NOT NULL,\n"
+                       "  new_level TEXT NOT NULL,\n"
+                       "  quantity REAL,\n"
+                       "  changed_at TEXT DEFAULT CURRENT_TIMESTAMP\n"
+                       ");")) {
+            qDebug() << "ERROR: Failed to create inventory_alert_history table:" << query.lastError().text();
+            db.rollback();
+            return;
+        }
+
+        query.exec("CREATE INDEX IF NOT EXISTS idx_inventory_alert_active ON inventory_alert_state(level) WHERE level <> 'ok';");
+        query.exec("CREATE INDEX IF NOT EXISTS idx_inventory_alert_history_item ON inventory_alert_history(item_id, changed_at);");
+
+        // Same thresholds the dashboard used to evaluate on every refresh
+        const QString levelExpr =
+            "CASE WHEN %1.emergency_level > 0 AND %1.quantity <= %1.emergency_level THEN 'critical' "
+            "WHEN %1.reorder_level > 0 AND %1.quantity <= %1.reorder_level THEN 'low' "
+            "ELSE 'ok' END";
+
+        QStringList alertTriggers = {
+            QString("CREATE TRIGGER IF NOT EXISTS trg_inventory_alert_insert AFTER INSERT ON inventory_items\n"
+                    "BEGIN\n"
+                    "  INSERT OR REPLACE INTO inventory_alert_state (item_id, level, changed_at)\n"
+                    "    VALUES (NEW.id, %1, CURRENT_TIMESTAMP);\n"
+                    "  INSERT INTO inventory_alert_history (item_id, old_level, new_level, quantity)\n"
+                    "    SELECT NEW.id, 'ok', %1, NEW.quantity WHERE %1 <> 'ok';\n"
+                    "END;").arg(levelExpr.arg("NEW")),
+            QString("CREATE TRIGGER IF NOT EXISTS trg_inventory_alert_update\n"
+                    "AFTER UPDATE OF quantity, reorder_level, emergency_level ON inventory_items\n"
+                    "WHEN %1 IS NOT COALESCE((SELECT level FROM inventory_alert_state WHERE item_id = NEW.id), 'ok')\n"
+                    "BEGIN\n"
+                    "  INSERT INTO inventory_alert_history (item_id, old_level, new_level, quantity)\n"
+                    "    VALUES (NEW.id, COALESCE((SELECT level FROM inventory_alert_state WHERE item_id = NEW.id), 'ok'), %1, NEW.quantity);\n"
+                    "  INSERT OR REPLACE INTO inventory_alert_state (item_id, level, changed_at)\n"
+                    "    VALUES (NEW.id, %1, CURRENT_TIMESTAMP);\n"
+                    "END;").arg(levelExpr.arg("NEW")),
+            "CREATE TRIGGER IF NOT EXISTS trg_inventory_alert_delete AFTER DELETE ON inventory_items\n"
+            "BEGIN\n"
+            "  DELETE FROM inventory_alert_state WHERE item_id = OLD.id;\n"
+            "END;"
+        };
+
+        for (const QString &sql : alertTriggers) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to create inventory alert trigger:" << query.lastError().text();
+                db.rollback();
+                return;
+            }
+        }
+
+        // Seed state for existing items
+        if (!query.exec(QString("INSERT OR REPLACE INTO inventory_alert_state (item_id, level) "
+                                "SELECT i.id, %1 FROM inventory_items i;").arg(levelExpr.arg("i")))) {
+            qDebug() << "ERROR: Failed to seed inventory alert state:" << query.lastError().text();
+            db.rollback();
+            return;
+        }
+
+        query.exec("INSERT INTO inventory_alert_history (item_id, old_level, new_level, quantity) "
+                   "SELECT s.item_id, 'ok', s.level, i.quantity FROM inventory_alert_state s "
+                   "JOIN inventory_items i ON i.id = s.item_id WHERE s.level <> 'ok';");
+
+        qDebug() << "Inventory alert state tracking created successfully";
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 13;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 13;
+        qDebug() << "Migration 13 completed successfully";
+    }
+
+    // Migration 14: Backup log
+    if (version < 14) {
+        qDebug() << "Running migration 14: Creating backup log...";
+
+        if (!query.exec("CREATE TABLE IF NOT EXISTS backup_log (\n"
+                       "  id INTEGER PRIMARY KEY AUTOINCREMENT,\n"
+                       "  file_path TEXT,\n"
+                       "  success INTEGER NOT NULL DEFAULT 0,\n"
+                       "  integrity_ok INTEGER NOT NULL DEFAULT 0,\n"
+                       "  bytes INTEGER DEFAULT 0,\n"
+                       "  page_count INTEGER DEFAULT 0,\n"
+                       "  elapsed_ms INTEGER DEFAULT 0,\n"
+                       "  error TEXT,\n"
+                       "  created_at TEXT DEFAULT CURRENT_TIMESTAMP\n"
+                       ");")) {
+            qDebug() << "ERROR: Failed to create backup_log table:" << query.lastError().text();
+            db.rollback();
+            return;
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 14;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 14;
+        qDebug() << "Migration 14 completed successfully";
+    }
+
+    // Migration 15: Maintenance log
+    if (version < 15) {
+        qDebug() << "Running migration 15: Creating maintenance log...";
+
+        if (!query.exec("CREATE TABLE IF NOT EXISTS maintenance_log (\n"
+                       "  id INTEGER PRIMARY KEY AUTOINCREMENT,\n"
+                       "  task TEXT NOT NULL,\n"        // optimize, quick_check, analyze, incremental_vacuum, enable_auto_vacuum
+                       "  success INTEGER NOT NULL DEFAULT 0,\n"
+                       "  timed_out INTEGER NOT NULL DEFAULT 0,\n"
+                       "  elapsed_ms INTEGER DEFAULT 0,\n"
+                       "  detail TEXT,\n"
+                       "  run_at TEXT DEFAULT CURRENT_TIMESTAMP\n"
+                       ");")) {
+            qDebug() << "ERROR: Failed to create maintenance_log table:" << query.lastError().text();
+            db.rollback();
+            return;
+        }
+
+        query.exec("CREATE INDEX IF NOT EXISTS idx_maintenance_log_task ON maintenance_log(task, success, run_at);");
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 15;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 15;
+        qDebug() << "Migration 15 completed successfully";
+    }
+
+    // Migration 16: Indexes for hot queries (see query_plan.cpp and the index_advisor tool)
+    if (version < 16) {
+        qDebug() << "Running migration 16: Adding indexes for hot queries...";
+
+        QStringList indexStatements = {
+            // Dashboard totals: status + date range, covering the summed columns
+            "CREATE INDEX IF NOT EXISTS idx_orders_status_delivery ON orders(status, delivery_date, delivered_cords, amount_paid);",
+            "CREATE INDEX IF NOT EXISTS idx_orders_status_household ON orders(status, household_id);",
+            // Upcoming orders: only open orders, already in display order
+            "CREATE INDEX IF NOT EXISTS idx_orders_open_delivery ON orders(delivery_date, order_date) "
+            "WHERE status IN ('Pending', 'Scheduled', 'In Progress');",
+            "DROP INDEX IF EXISTS idx_orders_status;",
+
+            // Client pickers list clients and volunteers by name
+            "CREATE INDEX IF NOT EXISTS idx_users_directory_name ON users(full_name) "
+            "WHERE user_type IN ('client', 'volunteer');",
+
+            // Household lookups by name/phone/email (multi-index OR) and duplicate checks
+            "CREATE INDEX IF NOT EXISTS idx_households_name ON households(name);",
+            "CREATE INDEX IF NOT EXISTS idx_households_phone ON households(phone);",
+            "CREATE INDEX IF NOT EXISTS idx_households_email ON households(email);",
+            "CREATE INDEX IF NOT EXISTS idx_households_name_lower ON households(LOWER(name));",
+            "CREATE INDEX IF NOT EXISTS idx_households_address_lower ON households(LOWER(address));",
+
+            // Per-household history lists sorted by date
+            "CREATE INDEX IF NOT EXISTS idx_volunteer_hours_household_date ON volunteer_hours(household_id, date);",
+            "DROP INDEX IF EXISTS idx_volunteer_hours_household;",
+            "CREATE INDEX IF NOT EXISTS idx_certifications_household_expiration ON volunteer_certifications(household_id, expiration_date);",
+            "DROP INDEX IF EXISTS idx_certifications_household;",
+            "CREATE INDEX IF NOT EXISTS idx_work_schedule_date_time ON work_schedule(work_date, start_time);",
+            "DROP INDEX IF EXISTS idx_work_schedule_date;",
+
+            // Delivery log filtered by driver and date range
+            "CREATE INDEX IF NOT EXISTS idx_delivery_log_driver_date ON delivery_log(driver, delivery_date);",
+            "DROP INDEX IF EXISTS idx_delivery_log_driver;",
+
+            // Change requests filtered by status, newest first
+            "CREATE INDEX IF NOT EXISTS idx_change_requests_status_date ON profile_change_requests(status, request_date);",
+            "CREATE INDEX IF NOT EXISTS idx_change_requests_date ON profile_change_requests(request_date);",
+            "DROP INDEX IF EXISTS idx_change_requests_status;"
+        };
+
+        for (const QString &sql : indexStatements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to create hot query index:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 16;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 16;
+        qDebug() << "Migration 16 completed successfully";
+    }
+
+    // Migration 17: Index foreign-key child columns so cascades are index lookups
+    if (version < 17) {
+        qDebug() << "Running migration 17: Indexing foreign-key child columns...";
+
+        QStringList indexStatements = {
+            "CREATE INDEX IF NOT EXISTS idx_delivery_log_order ON delivery_log(order_id);",
+            "CREATE INDEX IF NOT EXISTS idx_household_user_mapping_user ON household_user_mapping(user_id);"
+        };
+
+        for (const QString &sql : indexStatements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to create foreign key index:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        reportForeignKeyViolations(db);
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 17;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 17;
+        qDebug() << "Migration 17 completed successfully";
+    }
+
+    // Migration 18: Split the wide users table into core, credential and profile tables
+    if (version < 18) {
+        qDebug() << "Running migration 18: Splitting users into core and profile tables...";
+
+        // 1:1 side tables keyed by the account id. Logins and lists only read the narrow
+        // user_accounts rows; delivery and volunteer details live in their own pages.
+        QStringList sideTables = {
+            "CREATE TABLE IF NOT EXISTS user_credentials (\n"
+            "  user_id INTEGER PRIMARY KEY,\n"
+            "  password_hash TEXT NOT NULL DEFAULT '',\n"
+            "  last_login TEXT,\n"
+            "  FOREIGN KEY (user_id) REFERENCES user_accounts(id) ON DELETE CASCADE\n"
+            ");",
+            "CREATE TABLE IF NOT EXISTS client_profiles (\n"
+            "  user_id INTEGER PRIMARY KEY,\n"
+            "  address TEXT,\n"
+            "  mailing_address TEXT,\n"
+            "  gate_code TEXT,\n"
+            "  stove_size TEXT,\n"
+            "  wood_credit_received REAL DEFAULT 0,\n"
+            "  credit_balance REAL DEFAULT 0,\n"
+            "  order_count INTEGER DEFAULT 0,\n"
+            "  last_order_date TEXT,\n"
+            "  FOREIGN KEY (user_id) REFERENCES user_accounts(id) ON DELETE CASCADE\n"
+            ");",
+            "CREATE TABLE IF NOT EXISTS volunteer_profiles (\n"
+            "  user_id INTEGER PRIMARY KEY,\n"
+            "  availability TEXT,\n"
+            "  is_volunteer INTEGER DEFAULT 0,\n"
+            "  waiver_signed INTEGER DEFAULT 0,\n"
+            "  has_license INTEGER DEFAULT 0,\n"
+            "  has_working_vehicle INTEGER DEFAULT 0,\n"
+            "  works_for_wood INTEGER DEFAULT 0,\n"
+            "  last_volunteer_date TEXT,\n"
+            "  FOREIGN KEY (user_id) REFERENCES user_accounts(id) ON DELETE CASCADE\n"
+            ");"
+        };
+
+        for (const QString &sql : sideTables) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to create user side table:" << query.lastError().text();
+                db.rollback();
+                return;
+            }
+        }
+
+        // Renaming also repoints the foreign keys in profile_change_requests and
+        // household_user_mapping at user_accounts
+        if (!query.exec("ALTER TABLE users RENAME TO user_accounts;")) {
+            qDebug() << "ERROR: Failed to rename users table:" << query.lastError().text();
+            db.rollback();
+            return;
+        }
+
+        QStringList copyStatements = {
+            "INSERT INTO user_credentials (user_id, password_hash, last_login)\n"
+            "  SELECT id, COALESCE(password_hash, ''), last_login FROM user_accounts;",
+            "INSERT INTO client_profiles (user_id, address, mailing_address, gate_code, stove_size,\n"
+            "                             wood_credit_received, credit_balance, order_count, last_order_date)\n"
+            "  SELECT id, address, mailing_address, gate_code, stove_size,\n"
+            "         wood_credit_received, credit_balance, order_count, last_order_date FROM user_accounts;",
+            "INSERT INTO volunteer_profiles (user_id, availability, is_volunteer, waiver_signed, has_license,\n"
+            "                                has_working_vehicle, works_for_wood, last_volunteer_date)\n"
+            "  SELECT id, availability, is_volunteer, waiver_signed, has_license,\n"
+            "         has_working_vehicle, works_for_wood, last_volunteer_date FROM user_accounts;"
+        };
+
+        for (const QString &sql : copyStatements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to copy user data:" << query.lastError().text();
+                db.rollback();
+                return;
+            }
+        }
+
+        const QStringList movedColumns = {
+            "password_hash", "last_login", "availability", "address", "mailing_address", "gate_code",
+            "stove_size", "is_volunteer", "waiver_signed", "has_license", "has_working_vehicle", "works_for_wood",
+            "wood_credit_received", "credit_balance", "last_volunteer_date", "order_count", "last_order_date"
+        };
+
+        for (const QString &column : movedColumns) {
+            if (!query.exec(QString("ALTER TABLE user_accounts DROP COLUMN %1;").arg(column))) {
+                qDebug() << "ERROR: Failed to drop user column" << column << ":" << query.lastError().text();
+                db.rollback();
+                return;
+            }
+        }
+
+        // Compatibility view with the old column order (the clients model addresses
+        // columns by index); INSTEAD OF triggers route writes to the owning table.
+        // Each side table's user_id is its rowid, so inside the insert trigger
+        // last_insert_rowid() keeps returning the new account id.
+        QStringList compatibility = {
+            "CREATE VIEW IF NOT EXISTS users AS\n"
+            "SELECT a.id, a.username, c.password_hash, a.role, a.full_name, a.email, a.active, a.created_at,\n"
+            "       c.last_login, a.phone, v.availability, p.address, p.mailing_address, p.gate_code, p.stove_size,\n"
+            "       v.is_volunteer, v.waiver_signed, v.has_license, v.has_working_vehicle, v.works_for_wood,\n"
+            "       p.wood_credit_received, p.credit_balance, v.last_volunteer_date, p.order_count, p.last_order_date,\n"
+            "       a.user_type\n"
+            "FROM user_accounts a\n"
+            "LEFT JOIN user_credentials c ON c.user_id = a.id\n"
+            "LEFT JOIN client_profiles p ON p.user_id = a.id\n"
+            "LEFT JOIN volunteer_profiles v ON v.user_id = a.id;",
+            "CREATE TRIGGER IF NOT EXISTS trg_users_insert INSTEAD OF INSERT ON users\n"
+            "BEGIN\n"
+            "  INSERT INTO user_accounts (id, username, role, full_name, email, phone, user_type, active, created_at)\n"
+            "    VALUES (NEW.id, NEW.username, COALESCE(NEW.role, 'volunteer'), NEW.full_name, NEW.email, NEW.phone,\n"
+            "            COALESCE(NEW.user_type, 'client'), COALESCE(NEW.active, 1), COALESCE(NEW.created_at, CURRENT_TIMESTAMP));\n"
+            "  INSERT INTO user_credentials (user_id, password_hash, last_login)\n"
+            "    VALUES (last_insert_rowid(), COALESCE(NEW.password_hash, ''), NEW.last_login);\n"
+            "  INSERT INTO client_profiles (user_id, address, mailing_address, gate_code, stove_size,\n"
+            "                               wood_credit_received, credit_balance, order_count, last_order_date)\n"
+            "    VALUES (last_insert_rowid(), NEW.address, NEW.mailing_address, NEW.gate_code, NEW.stove_size,\n"
+            "            COALESCE(NEW.wood_credit_received, 0), COALESCE(NEW.credit_balance, 0), COALESCE(NEW.order_count, 0), NEW.last_order_date);\n"
+            "  INSERT INTO volunteer_profiles (user_id, availability, is_volunteer, waiver_signed, has_license,\n"
+            "                                  has_working_vehicle, works_for_wood, last_volunteer_date)\n"
+            "    VALUES (last_insert_rowid(), NEW.availability, COALESCE(NEW.is_volunteer, 0), COALESCE(NEW.waiver_signed, 0),\n"
+            "            COALESCE(NEW.has_license, 0), COALESCE(NEW.has_working_vehicle, 0), COALESCE(NEW.works_for_wood, 0),\n"
+            "            NEW.last_volunteer_date);\n"
+            "END;",
+            "CREATE TRIGGER IF NOT EXISTS trg_users_update_account INSTEAD OF UPDATE ON users\n"
+            "WHEN NEW.username IS NOT OLD.username OR NEW.role IS NOT OLD.role OR NEW.full_name IS NOT OLD.full_name\n"
+            "  OR NEW.email IS NOT OLD.email OR NEW.phone IS NOT OLD.phone OR NEW.user_type IS NOT OLD.user_type\n"
+            "  OR NEW.active IS NOT OLD.active OR NEW.created_at IS NOT OLD.created_at\n"
+            "BEGIN\n"
+            "  UPDATE user_accounts SET username = NEW.username, role = NEW.role, full_name = NEW.full_name,\n"
+            "    email = NEW.email, phone = NEW.phone, user_type = NEW.user_type, active = NEW.active,\n"
+            "    created_at = NEW.created_at\n"
+            "  WHERE id = OLD.id;\n"
+            "END;",
+            "CREATE TRIGGER IF NOT EXISTS trg_users_update_credentials INSTEAD OF UPDATE ON users\n"
+            "WHEN NEW.password_hash IS NOT OLD.password_hash OR NEW.last_login IS NOT OLD.last_login\n"
+            "BEGIN\n"
+            "  INSERT INTO user_credentials (user_id, password_hash, last_login)\n"
+            "    VALUES (OLD.id, COALESCE(NEW.password_hash, ''), NEW.last_login)\n"
+            "    ON CONFLICT(user_id) DO UPDATE SET password_hash = excluded.password_hash, last_login = excluded.last_login;\n"
+            "END;",
+            "CREATE TRIGGER IF NOT EXISTS trg_users_update_client INSTEAD OF UPDATE ON users\n"
+            "WHEN NEW.address IS NOT OLD.address OR NEW.mailing_address IS NOT OLD.mailing_address\n"
+            "  OR NEW.gate_code IS NOT OLD.gate_code OR NEW.stove_size IS NOT OLD.stove_size\n"
+            "  OR NEW.wood_credit_received IS NOT OLD.wood_credit_received OR NEW.credit_balance IS NOT OLD.credit_balance\n"
+            "  OR NEW.order_count IS NOT OLD.order_count OR NEW.last_order_date IS NOT OLD.last_order_date\n"
+            "BEGIN\n"
+            "  INSERT INTO client_profiles (user_id, address, mailing_address, gate_code, stove_size,\n"
+            "                               wood_credit_received, credit_balance, order_count, last_order_date)\n"
+            "    VALUES (OLD.id, NEW.address, NEW.mailing_address, NEW.gate_code, NEW.stove_size,\n"
+            "            NEW.wood_credit_received, NEW.credit_balance, NEW.order_count, NEW.last_order_date)\n"
+            "    ON CONFLICT(user_id) DO UPDATE SET address = excluded.address, mailing_address = excluded.mailing_address,\n"
+            "      gate_code = excluded.gate_code, stove_size = excluded.stove_size,\n"
+            "      wood_credit_received = excluded.wood_credit_received, credit_balance = excluded.credit_balance,\n"
+            "      order_count = excluded.order_count, last_order_date = excluded.last_order_date;\n"
+            "END;",
+            "CREATE TRIGGER IF NOT EXISTS trg_users_update_volunteer INSTEAD OF UPDATE ON users\n"
+            "WHEN NEW.availability IS NOT OLD.availability OR NEW.is_volunteer IS NOT OLD.is_volunteer\n"
+            "  OR NEW.waiver_signed IS NOT OLD.waiver_signed OR NEW.has_license IS NOT OLD.has_license\n"
+            "  OR NEW.has_working_vehicle IS NOT OLD.has_working_vehicle OR NEW.works_for_wood IS NOT OLD.works_for_wood\n"
+            "  OR NEW.last_volunteer_date IS NOT OLD.last_volunteer_date\n"
+            "BEGIN\n"
+            "  INSERT INTO volunteer_profiles (user_id, availability, is_volunteer, waiver_signed, has_license,\n"
+            "                                  has_working_vehicle, works_for_wood, last_volunteer_date)\n"
+            "    VALUES (OLD.id, NEW.availability, NEW.is_volunteer, NEW.waiver_signed, NEW.has_license,\n"
+            "            NEW.has_working_vehicle, NEW.works_for_wood, NEW.last_volunteer_date)\n"
+            "    ON CONFLICT(user_id) DO UPDATE SET availability = excluded.availability, is_volunteer = excluded.is_volunteer,\n"
+            "      waiver_signed = excluded.waiver_signed, has_license = excluded.has_license,\n"
+            "      has_working_vehicle = excluded.has_working_vehicle, works_for_wood = excluded.works_for_wood,\n"
+            "      last_volunteer_date = excluded.last_volunteer_date;\n"
+            "END;",
+            "CREATE TRIGGER IF NOT EXISTS trg_users_delete INSTEAD OF DELETE ON users\n"
+            "BEGIN\n"
+            "  DELETE FROM user_credentials WHERE user_id = OLD.id;\n"
+            "  DELETE FROM client_profiles WHERE user_id = OLD.id;\n"
+            "  DELETE FROM volunteer_profiles WHERE user_id = OLD.id;\n"
+            "  DELETE FROM user_accounts WHERE id = OLD.id;\n"
+            "END;"
+        };
+
+        for (const QString &sql : compatibility) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to create users compatibility view:" << query.lastError().text();
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 18;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 18;
+        qDebug() << "Migration 18 completed successfully";
+    }
+
+    // Migration 19: Integer day numbers for date columns
+    if (version < 19) {
+        qDebug() << "Running migration 19: Adding indexed day-number columns...";
+
+        // Julian day number (same as QDate::toJulianDay()) computed from the stored text.
+        // julianday() accepts ISO dates with or without a time; older rows entered as
+        // MM/DD/YYYY are rearranged first. Virtual columns cost no row space and are
+        // hidden from PRAGMA table_info, so table models don't pick them up.
+        const QString dayExpr =
+            "CAST(julianday(CASE WHEN %1 LIKE '__/__/____%' "
+            "THEN substr(%1, 7, 4) || '-' || substr(%1, 1, 2) || '-' || substr(%1, 4, 2) "
+            "ELSE %1 END) + 0.5 AS INTEGER)";
+
+        struct DayColumn {
+            const char *table;
+            const char *dayColumn;
+            const char *textColumn;
+        };
+        const QList<DayColumn> dayColumns = {
+            {"orders", "order_day", "order_date"},
+            {"orders", "delivery_day", "delivery_date"},
+            {"delivery_log", "delivery_day", "delivery_date"},
+            {"expenses", "day", "date"},
+            {"income", "day", "date"},
+            {"volunteer_hours", "day", "date"},
+            {"work_schedule", "work_day", "work_date"}
+        };
+
+        for (const DayColumn &col : dayColumns) {
+            const QString sql = QString("ALTER TABLE %1 ADD COLUMN %2 INTEGER GENERATED ALWAYS AS (%3) VIRTUAL;")
+                .arg(col.table).arg(col.dayColumn).arg(dayExpr.arg(col.textColumn));
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to add day column" << col.table << col.dayColumn << ":"
+                         << query.lastError().text();
+                db.rollback();
+                return;
+            }
+        }
+
+        // Day-number indexes replace the text date indexes for range filters
+        QStringList indexStatements = {
+            "CREATE INDEX IF NOT EXISTS idx_expenses_day ON expenses(day);",
+            "DROP INDEX IF EXISTS idx_expenses_date;",
+            "CREATE INDEX IF NOT EXISTS idx_income_day ON income(day);",
+            "DROP INDEX IF EXISTS idx_income_date;",
+            "CREATE INDEX IF NOT EXISTS idx_volunteer_hours_day ON volunteer_hours(day);",
+            "DROP INDEX IF EXISTS idx_volunteer_hours_date;",
+            "CREATE INDEX IF NOT EXISTS idx_orders_order_day ON orders(order_day);",
+            "DROP INDEX IF EXISTS idx_orders_date;",
+            "CREATE INDEX IF NOT EXISTS idx_orders_status_delivery_day ON orders(status, delivery_day, delivered_cords, amount_paid);",
+            "DROP INDEX IF EXISTS idx_orders_status_delivery;",
+            "CREATE INDEX IF NOT EXISTS idx_delivery_log_day ON delivery_log(delivery_day);",
+            "DROP INDEX IF EXISTS idx_delivery_log_date;",
+            "CREATE INDEX IF NOT EXISTS idx_delivery_log_driver_day ON delivery_log(driver, delivery_day);",
+            "DROP INDEX IF EXISTS idx_delivery_log_driver_date;",
+            "CREATE INDEX IF NOT EXISTS idx_work_schedule_day ON work_schedule(work_day);",
+            // The wider row makes a scan look cheaper than idx_orders_status_household for the
+            // open-cords total; carry the cord columns so the open-orders index covers it
+            "DROP INDEX IF EXISTS idx_orders_open_delivery;",
+            "CREATE INDEX IF NOT EXISTS idx_orders_open_delivery ON orders(delivery_date, order_date, requested_cords, delivered_cords) "
+            "WHERE status IN ('Pending', 'Scheduled', 'In Progress');"
+        };
+
+        for (const QString &sql : indexStatements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to create day-number index:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 19;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 19;
+        qDebug() << "Migration 19 completed successfully";
+    }
+
+    // Migration 20: Integer codes for status, priority, user type and payment method
+    if (version < 20) {
+        qDebug() << "Running migration 20: Adding integer codes for enumerated columns...";
+
+        struct CodeTable {
+            const char *table;
+            QList<core::CodeName> codes;
+        };
+        const QList<CodeTable> codeTables = {
+            {"order_statuses", core::orderStatusCodes()},
+            {"order_priorities", core::orderPriorityCodes()},
+            {"user_types", core::userTypeCodes()},
+            {"payment_methods", core::paymentMethodCodes()}
+        };
+
+        // Lookup tables hold the canonical name for each code (first spelling wins)
+        for (const CodeTable &lookup : codeTables) {
+            if (!query.exec(QString("CREATE TABLE IF NOT EXISTS %1 (code INTEGER PRIMARY KEY, name TEXT NOT NULL UNIQUE);")
+                                .arg(lookup.table))) {
+                qDebug() << "ERROR: Failed to create lookup table" << lookup.table << ":" << query.lastError().text();
+                db.rollback();
+                return;
+            }
+            QSqlQuery insert(db);
+            insert.prepare(QString("INSERT OR IGNORE INTO %1 (code, name) VALUES (?, ?);").arg(lookup.table));
+            for (const core::CodeName &entry : lookup.codes) {
+                insert.addBindValue(entry.code);
+                insert.addBindValue(QString::fromLatin1(entry.name));
+                if (!insert.exec()) {
+                    qDebug() << "ERROR: Failed to fill lookup table" << lookup.table << ":" << insert.lastError().text();
+                    db.rollback();
+                    return;
+                }
+            }
+        }
+
+        // Virtual code columns computed from the text, NULL for unknown values
+        struct CodeColumn {
+            const char *table;
+            const char *codeColumn;
+            const char *textColumn;
+            QList<core::CodeName> codes;
+            const char *error;
+        };
+        const QList<CodeColumn> codeColumns = {
+            {"orders", "status_code", "status", core::orderStatusCodes(), "Invalid order status"},
+            {"orders", "priority_code", "priority", core::orderPriorityCodes(), "Invalid order priority"},
+            {"orders", "payment_code", "payment_method", core::paymentMethodCodes(), "Invalid payment method"},
+            {"expenses", "payment_code", "payment_method", core::paymentMethodCodes(), "Invalid payment method"},
+            {"user_accounts", "user_type_code", "user_type", core::userTypeCodes(), "Invalid user type"},
+            {"user_accounts", "role_code", "role", core::userTypeCodes(), "Invalid role"}
+        };
+
+        for (const CodeColumn &col : codeColumns) {
+            const QString sql = QString("ALTER TABLE %1 ADD COLUMN %2 INTEGER GENERATED ALWAYS AS (%3) VIRTUAL;")
+                .arg(col.table).arg(col.codeColumn).arg(codeCaseExpression(col.textColumn, col.codes));
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to add code column" << col.table << col.codeColumn << ":"
+                         << query.lastError().text();
+                db.rollback();
+                return;
+            }
+
+            // Existing rows are left alone; report the values that have no code
+            if (query.exec(QString("SELECT COUNT(*) FROM %1 WHERE %2 IS NULL AND COALESCE(trim(%3), '') <> '';")
+                               .arg(col.table).arg(col.codeColumn).arg(col.textColumn))
+                && query.next() && query.value(0).toInt() > 0) {
+                qDebug() << "WARNING:" << query.value(0).toInt() << "rows in" << col.table
+                         << "have an unknown" << col.textColumn;
+            }
+
+            // Constraint checks: SQLite cannot add CHECK constraints to an existing table,
+            // so new and changed values are validated by triggers instead
+            for (const bool isUpdate : {false, true}) {
+                const QString trigger = QString(
+                    "CREATE TRIGGER IF NOT EXISTS trg_%1_%2_%3\n"
+                    "BEFORE %4 ON %1\n"
+                    "WHEN NEW.%5 IS NULL AND COALESCE(trim(NEW.%6), '') <> ''\n"
+                    "BEGIN\n"
+                    "  SELECT RAISE(ABORT, '%7');\n"
+                    "END;")
+                    .arg(col.table)
+                    .arg(col.codeColumn)
+                    .arg(isUpdate ? "update" : "insert")
+                    .arg(isUpdate ? QString("UPDATE OF %1").arg(col.textColumn) : QString("INSERT"))
+                    .arg(col.codeColumn)
+                    .arg(col.textColumn)
+                    .arg(col.error);
+                if (!query.exec(trigger)) {
+                    qDebug() << "ERROR: Failed to create code check trigger:" << query.lastError().text();
+                    qDebug() << "SQL:" << trigger;
+                    db.rollback();
+                    return;
+                }
+            }
+        }
+
+        // Order indexes on the integer status code replace the text ones
+        QStringList indexStatements = {
+            "CREATE INDEX IF NOT EXISTS idx_orders_status_code_delivery_day ON orders(status_code, delivery_day, delivered_cords, amount_paid);",
+            "DROP INDEX IF EXISTS idx_orders_status_delivery_day;",
+            "CREATE INDEX IF NOT EXISTS idx_orders_status_code_household ON orders(status_code, household_id);",
+            "DROP INDEX IF EXISTS idx_orders_status_household;",
+            "DROP INDEX IF EXISTS idx_orders_open_delivery;",
+            QString("CREATE INDEX IF NOT EXISTS idx_orders_open_delivery ON orders(delivery_date, order_date, requested_cords, delivered_cords) "
+                    "WHERE status_code IN (%1);").arg(core::openOrderStatusCodeList())
+        };
+
+        for (const QString &sql : indexStatements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to create code index:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 20;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 20;
+        qDebug() << "Migration 20 completed successfully";
+    }
+
+    // Migration 21: Exact integer cents for money columns
+    if (version < 21) {
+        qDebug() << "Running migration 21: Adding integer cents columns...";
+
+        // The REAL columns stay editable through the models; the cents columns round each
+        // value to the cent once, so SUM() over them is exact (see core::Money)
+        QStringList statements = {
+            "ALTER TABLE orders ADD COLUMN amount_paid_cents INTEGER "
+            "GENERATED ALWAYS AS (CAST(round(amount_paid * 100) AS INTEGER)) VIRTUAL;",
+            "ALTER TABLE expenses ADD COLUMN amount_cents INTEGER "
+            "GENERATED ALWAYS AS (CAST(round(amount * 100) AS INTEGER)) VIRTUAL;",
+            "ALTER TABLE income ADD COLUMN amount_cents INTEGER "
+            "GENERATED ALWAYS AS (CAST(round(amount * 100) AS INTEGER)) VIRTUAL;",
+            "ALTER TABLE client_profiles ADD COLUMN credit_balance_cents INTEGER "
+            "GENERATED ALWAYS AS (CAST(round(credit_balance * 100) AS INTEGER)) VIRTUAL;"
+        };
+
+        for (const QString &sql : statements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to add cents column:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 21;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 21;
+        qDebug() << "Migration 21 completed successfully";
+    }
+
+    // Migration 22: Trigger-maintained client counters
+    if (version < 22) {
+        qDebug() << "Running migration 22: Adding client counter triggers...";
+
+        // Triggers keep order_count, last_order_date, wood_credit_received and
+        // last_volunteer_date current; the rebuild fills in values for existing rows
+        const QStringList statements = counterTriggerStatements() + counterRebuildStatements();
+
+        for (const QString &sql : statements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to set up client counters:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 22;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 22;
+        qDebug() << "Migration 22 completed successfully";
+    }
+
+    // Migration 23: Open orders by delivery day for the dashboard schedule
+    if (version < 23) {
+        qDebug() << "Running migration 23: Adding open-order delivery day index...";
+
+        // The two-week schedule counts open orders and their cords per delivery day;
+        // a range over this index comes back in day order, so grouping needs no sort
+        const QString sql = QString("CREATE INDEX IF NOT EXISTS idx_orders_open_delivery_day "
+                                    "ON orders(delivery_day, requested_cords) WHERE status_code IN (%1);")
+                                .arg(core::openOrderStatusCodeList());
+        if (!query.exec(sql)) {
+            qDebug() << "ERROR: Failed to create open-order delivery day index:" << query.lastError().text();
+            db.rollback();
+            return;
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 23;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 23;
+        qDebug() << "Migration 23 completed successfully";
+    }
+
+    // Migration 24: Change counters for caches, orders by delivery day
+    if (version < 24) {
+        qDebug() << "Running migration 24: Adding data versions and delivery day index...";
+
+        // The monthly calendar groups every non-cancelled order by delivery day
+        const QStringList statements = dataVersionStatements() + QStringList{
+            "CREATE INDEX IF NOT EXISTS idx_orders_delivery_day ON orders(delivery_day, status_code);"
+        };
+
+        for (const QString &sql : statements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to add data versions:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 24;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 24;
+        qDebug() << "Migration 24 completed successfully";
+    }
+
+    // Migration 25: Category and source indexes for the bookkeeping tabs
+    if (version < 25) {
+        qDebug() << "Running migration 25: Adding category and source day indexes...";
+
+        // The bookkeeping tabs filter by one category (or income source) and a
+        // date range, newest first; the equality column leads so the range and
+        // the order both come from the index
+        const QStringList statements = {
+            "CREATE INDEX IF NOT EXISTS idx_expenses_category_day ON expenses(category, day);",
+            "DROP INDEX IF EXISTS idx_expenses_category;",
+            "CREATE INDEX IF NOT EXISTS idx_income_source_day ON income(source, day);",
+            "DROP INDEX IF EXISTS idx_income_source;"
+        };
+
+        for (const QString &sql : statements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to add bookkeeping filter indexes:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 25;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 25;
+        qDebug() << "Migration 25 completed successfully";
+    }
+
+    // Migration 26: Regions and data versions for the report engine
+    if (version < 26) {
+        qDebug() << "Running migration 26: Adding household regions and report data versions...";
+
+        // Reports group by region, taken from the ZIP code (or ZIP+4) that ends the
+        // address; addresses without one fall under 'Unknown' in the reports. The
+        // report cache also needs change counters for every table it reads.
+        const QStringList statements = QStringList{
+            "ALTER TABLE households ADD COLUMN region TEXT GENERATED ALWAYS AS ("
+            "CASE WHEN rtrim(address) GLOB '*[0-9][0-9][0-9][0-9][0-9]-[0-9][0-9][0-9][0-9]' "
+            "THEN substr(rtrim(address), -10, 5) "
+            "WHEN rtrim(address) GLOB '*[0-9][0-9][0-9][0-9][0-9]' "
+            "THEN substr(rtrim(address), -5) END) VIRTUAL;"
+        } + dataVersionStatements();
+
+        for (const QString &sql : statements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to add report support:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 26;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 26;
+        qDebug() << "Migration 26 completed successfully";
+    }
+
+    // Migration 27: Work-for-Wood credit ledger
+    if (version < 27) {
+        qDebug() << "Running migration 27: Adding the credit ledger...";
+
+        // Balances entered by hand so far become opening adjustments; earlier hours
+        // and orders are assumed to be reflected in them and are not posted again
+        const QStringList statements = creditLedgerStatements() + creditOpeningBalanceStatements();
+
+        for (const QString &sql : statements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to create credit ledger:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 27;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 27;
+        qDebug() << "Migration 27 completed successfully";
+    }
+
+    // Migration 28: Shift waitlists and repaired slot counts
+    if (version < 28) {
+        qDebug() << "Running migration 28: Adding shift waitlists...";
+
+        const QStringList statements = shiftSignupStatements();
+
+        for (const QString &sql : statements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to add shift waitlists:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 28;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 28;
+        qDebug() << "Migration 28 completed successfully";
+    }
+
+    // Migration 29: Normalized match keys and trigram index for duplicate clients
+    if (version < 29) {
+        qDebug() << "Running migration 29: Adding client match keys...";
+
+        // The LOWER() indexes only served the exact-match duplicate check
+        QStringList statements = clientMatchStatements();
+        statements << "DROP INDEX IF EXISTS idx_households_name_lower;"
+                   << "DROP INDEX IF EXISTS idx_households_address_lower;";
+
+        for (const QString &sql : statements) {
+            if (!query.exec(sql)) {
+                qDebug() << "ERROR: Failed to add client match keys:" << query.lastError().text();
+                qDebug() << "SQL:" << sql;
+                db.rollback();
+                return;
+            }
+        }
+
+        if (!refreshClientMatchKeys(db)) {
+            qDebug() << "ERROR: Failed to compute client match keys";
+            db.rollback();
+            return;
+        }
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 29;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 29;
+        qDebug() << "Migration 29 completed successfully";
+    }
+
+    // Migration 30: Repoint orders saved with a users.id at the client's household
+    if (version < 30) {
+        qDebug() << "Running migration 30: Repointing orders at households...";
+
+        // The order form listed users and stored users.id in orders.household_id;
+        // its rows are the ones created by "System". Clients it was used for that
+        // have no household get one, as migration 12 did for the others.
+        QSqlQuery unmapped(db);
+        if (!unmapped.exec("SELECT DISTINCT a.id, a.full_name, a.phone, p.address FROM orders o\n"
+                           "JOIN user_accounts a ON a.id = o.household_id\n"
+                           "LEFT JOIN client_profiles p ON p.user_id = a.id\n"
+                           "WHERE o.created_by = 'System'\n"
+                           "  AND NOT EXISTS (SELECT 1 FROM household_user_mapping m WHERE m.user_id = a.id);")) {
+            qDebug() << "ERROR: Failed to find clients without a household:" << unmapped.lastError().text();
+            db.rollback();
+            return;
+        }
+
+        while (unmapped.next()) {
+            QSqlQuery insertHousehold(db);
+            insertHousehold.prepare("INSERT INTO households (name, phone, address) VALUES (:name, :phone, :address)");
+            insertHousehold.bindValue(":name", unmapped.value(1));
+            insertHousehold.bindValue(":phone", unmapped.value(2));
+            insertHousehold.bindValue(":address", unmapped.value(3));
+            if (!insertHousehold.exec()) {
+                qDebug() << "ERROR: Failed to create household for client:" << insertHousehold.lastError().text();
+                db.rollback();
+                return;
+            }
+
+            QSqlQuery insertMapping(db);
+            insertMapping.prepare("INSERT INTO household_user_mapping (household_id, user_id) VALUES (:household_id, :user_id)");
+            insertMapping.bindValue(":household_id", insertHousehold.lastInsertId());
+            insertMapping.bindValue(":user_id", unmapped.value(0));
+            if (!insertMapping.exec()) {
+                qDebug() << "ERROR: Failed to map household to client:" << insertMapping.lastError().text();
+                db.rollback();
+                return;
+            }
+        }
+
+        // The counter and credit ledger triggers move the orders' totals and
+        // Work-for-Wood redemptions to the household as the rows are repointed
+        if (!query.exec("UPDATE orders SET household_id =\n"
+                        "  (SELECT MIN(m.household_id) FROM household_user_mapping m WHERE m.user_id = orders.household_id)\n"
+                        "WHERE created_by = 'System'\n"
+                        "  AND EXISTS (SELECT 1 FROM household_user_mapping m WHERE m.user_id = orders.household_id);")) {
+            qDebug() << "ERROR: Failed to repoint orders:" << query.lastError().text();
+            db.rollback();
+            return;
+        }
+        qDebug() << "Repointed" << query.numRowsAffected() << "orders";
+
+        // Foreign keys are enforced from here on (see openConnection)
+        reportForeignKeyViolations(db);
+
+        QSqlQuery up(db);
+        if (!up.exec("UPDATE schema_version SET version = 30;")) {
+            qDebug() << "ERROR: Failed to update schema version:" << up.lastError().text();
+            db.rollback();
+            return;
+        }
+        version = 30;
+        qDebug() << "Migration 30 completed successfully";
+    }
+
     if (!db.commit()) {
         qDebug() << "ERROR: Failed to commit transaction:" << db.lastError().text();
         return;
@@ -1020,6 +2034,40 @@ static void runMigrations(QSqlDatabase &db) {
     qDebug() << "All migrations completed successfully";
 }
 
+QSqlDatabase openConnection(const QString &filePath, const QString &connectionName) {
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+    db.setDatabaseName(filePath);
+    
+    if (!db.open()) {
+        qDebug() << "ERROR: Failed to open database:" << db.lastError().text();
+        qDebug() << "Database path:" << filePath;
+        return QSqlDatabase();
+    }
+    
+    qDebug() << "Database opened successfully";
+    
+    // Only takes effect on a brand-new file; existing files are converted by the
+    // maintenance scheduler during idle time
+    QSqlQuery pragma(db);
+    pragma.exec("PRAGMA auto_vacuum = INCREMENTAL;");
+    
+    runMigrations(db);
+    
+    if (!db.isOpen()) {
+        qDebug() << "ERROR: Database connection lost after migrations!";
+        return QSqlDatabase();
+    }
+    
+    // Foreign keys are off by default on every SQLite connection; the schema's
+    // ON DELETE CASCADE clauses only take effect once this is set (outside a transaction).
+    // Set only after the migrations, which repair rows that would violate them.
+    if (!pragma.exec("PRAGMA foreign_keys = ON;")) {
+        qDebug() << "WARNING: Could not enable foreign keys:" << pragma.lastError().text();
+    }
+    
+    return db;
+}
+
 QSqlDatabase openDefaultConnection() {
     qDebug() << "Opening default database connection...";
     
@@ -1031,20 +2079,8 @@ QSqlDatabase openDefaultConnection() {
         return QSqlDatabase();
     }
     
-    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE");
-    db.setDatabaseName(dbPath);
-    
-    if (!db.open()) {
-        qDebug() << "ERROR: Failed to open database:" << db.lastError().text();
-        qDebug() << "Database path:" << dbPath;
-        return QSqlDatabase();
-    }
-    
-    qDebug() << "Database opened successfully";
-    runMigrations(db);
-    
+    QSqlDatabase db = openConnection(dbPath);
     if (!db.isOpen()) {
-        qDebug() << "ERROR: Database connection lost after migrations!";
         return QSqlDatabase();
     }
     
@@ -12,6 +12,15 @@ namespace firewood::db {
  */
 QSqlDatabase openDefaultConnection();
 
+/**
+ * @brief Opens a database file on a named connection and runs migrations
+ * @param filePath SQLite file to open (created if it does not exist)
+ * @param connectionName Qt connection name; defaults to the default connection
+ * @return QSqlDatabase instance (check isOpen() to verify success)
+ */
+QSqlDatabase openConnection(const QString &filePath,
+                            const QString &connectionName = QLatin1String(QSqlDatabase::defaultConnection));
+
 /**
  * @brief Loads SQL script from a file and executes it
  * @param filePath Path to the SQL script file
@@ -0,0 +1,475 @@
+#include "maintenance.h"
+#ifdef FIREWOOD_USE_SYSTEM_SQLITE
+#include <sqlite3.h>
+#endif
+#include <QCoreApplication>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QThread>
+#include <QEvent>
+#include <QFileInfo>
+#include <QStringList>
+#include <QDebug>
+
+namespace firewood::db {
+
+namespace {
+
+// Wall-clock deadline for the running tasks
+struct Budget {
+    QElapsedTimer clock;
+    qint64 limitMs = 0;
+
+    qint64 remainingMs() const { return limitMs - clock.elapsed(); }
+};
+
+// Whether a running statement can be stopped when the budget runs out. Without
+// it, statements whose run time grows with the file (quick_check and the full
+// VACUUM of the auto_vacuum conversion) are not run at all.
+#ifdef FIREWOOD_USE_SYSTEM_SQLITE
+constexpr bool CanInterrupt = true;
+#else
+constexpr bool CanInterrupt = false;
+#endif
+
+// Tasks whose statements are bounded by the file size, not by the policy
+bool needsInterrupt(MaintenanceTask task) {
+    return task == MaintenanceTask::QuickCheck || task == MaintenanceTask::EnableAutoVacuum;
+}
+
+enum class Status {
+    Ok,
+    Interrupted,    // Time budget exhausted
+    Corrupt,        // quick_check found problems
+    Failed
+};
+
+// A private connection for one maintenance run. With the system SQLite a
+// progress handler interrupts a statement that overruns the budget; through
+// Qt SQL statements cannot be interrupted, so the budget is only checked
+// before each one.
+class Connection {
+public:
+    Connection(const QString &path, const Budget &budget) : m_budget(budget) {
+#ifdef FIREWOOD_USE_SYSTEM_SQLITE
+        if (sqlite3_open_v2(path.toUtf8().constData(), &m_handle, SQLITE_OPEN_READWRITE, nullptr) != SQLITE_OK) {
+            m_error = m_handle ? QString::fromUtf8(sqlite3_errmsg(m_handle)) : QString("out of memory");
+            sqlite3_close(m_handle);
+            m_handle = nullptr;
+            return;
+        }
+        sqlite3_busy_timeout(m_handle, 1000);
+        sqlite3_progress_handler(m_handle, 1000, progressHandler, const_cast<Budget *>(&m_budget));
+#else
+        m_name = QString("firewood_maintenance_%1").arg(reinterpret_cast<quintptr>(this), 0, 16);
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", m_name);
+        db.setDatabaseName(path);
+        db.setConnectOptions("QSQLITE_BUSY_TIMEOUT=1000");
+        if (!db.open()) {
+            m_error = db.lastError().text();
+        }
+#endif
+    }
+
+    ~Connection() {
+#ifdef FIREWOOD_USE_SYSTEM_SQLITE
+        if (m_handle) {
+            sqlite3_progress_handler(m_handle, 0, nullptr, nullptr);
+            sqlite3_close(m_handle);
+        }
+#else
+        QSqlDatabase::database(m_name, false).close();
+        QSqlDatabase::removeDatabase(m_name);
+#endif
+    }
+
+    Connection(const Connection &) = delete;
+    Connection &operator=(const Connection &) = delete;
+
+    bool isOpen() const {
+#ifdef FIREWOOD_USE_SYSTEM_SQLITE
+        return m_handle != nullptr;
+#else
+        return QSqlDatabase::database(m_name, false).isOpen();
+#endif
+    }
+
+    QString error() const { return m_error; }
+
+    // Runs a statement to completion, collecting the first column of each row
+    Status exec(const QString &sql, QStringList *rows = nullptr) {
+#ifdef FIREWOOD_USE_SYSTEM_SQLITE
+        sqlite3_stmt *stmt = nullptr;
+        int rc = sqlite3_prepare_v2(m_handle, sql.toUtf8().constData(), -1, &stmt, nullptr);
+        if (rc == SQLITE_OK) {
+            while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+                if (rows) {
+                    const auto *text = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+                    rows->append(QString::fromUtf8(text ? text : ""));
+                }
+            }
+            sqlite3_finalize(stmt);
+        }
+        if (rc == SQLITE_DONE) {
+            return Status::Ok;
+        }
+        m_error = QString::fromUtf8(sqlite3_errmsg(m_handle));
+        return rc == SQLITE_INTERRUPT ? Status::Interrupted : Status::Failed;
+#else
+        if (m_budget.remainingMs() <= 0) {
+            return Status::Interrupted;
+        }
+        QSqlQuery query(QSqlDatabase::database(m_name, false));
+        query.setForwardOnly(true);
+        if (!query.exec(sql)) {
+            m_error = query.lastError().text();
+            return Status::Failed;
+        }
+        while (query.next()) {
+            if (rows) {
+                rows->append(query.value(0).toString());
+            }
+        }
+        return Status::Ok;
+#endif
+    }
+
+    qint64 pragmaInt(const QString &sql) {
+        QStringList rows;
+        if (exec(sql, &rows) != Status::Ok || rows.isEmpty()) {
+            return -1;
+        }
+        return rows.first().toLongLong();
+    }
+
+private:
+#ifdef FIREWOOD_USE_SYSTEM_SQLITE
+    // A nonzero return interrupts the running statement with SQLITE_INTERRUPT
+    static int progressHandler(void *context) {
+        const auto *budget = static_cast<const Budget *>(context);
+        return budget->remainingMs() <= 0 ? 1 : 0;
+    }
+
+    sqlite3 *m_handle = nullptr;
+#else
+    QString m_name;
+#endif
+    const Budget &m_budget;
+    QString m_error;
+};
+
+void finishTask(MaintenanceTaskResult &task, const Connection &connection, Status status,
+                const QElapsedTimer &taskClock) {
+    task.elapsedMs = taskClock.elapsed();
+    task.timedOut = (status == Status::Interrupted);
+    task.success = (status == Status::Ok);
+    if (task.timedOut) {
+        task.detail = "Interrupted: time budget exhausted";
+    } else if (!task.success && task.detail.isEmpty()) {
+        task.detail = connection.error();
+    }
+}
+
+} // namespace
+
+QString maintenanceTaskName(MaintenanceTask task) {
+    switch (task) {
+        case MaintenanceTask::Optimize: return "optimize";
+        case MaintenanceTask::QuickCheck: return "quick_check";
+        case MaintenanceTask::Analyze: return "analyze";
+        case MaintenanceTask::IncrementalVacuum: return "incremental_vacuum";
+        case MaintenanceTask::EnableAutoVacuum: return "enable_auto_vacuum";
+        default: return "none";
+    }
+}
+
+MaintenanceResult runMaintenance(const QString &databasePath, MaintenanceTasks tasks,
+                                 const MaintenancePolicy &policy) {
+    MaintenanceResult result;
+
+    Budget budget;
+    budget.limitMs = policy.timeBudgetMs;
+    budget.clock.start();
+
+    Connection connection(databasePath, budget);
+    if (!connection.isOpen()) {
+        MaintenanceTaskResult failed;
+        failed.detail = "Could not open database: " + connection.error();
+        result.tasks << failed;
+        return result;
+    }
+
+    // Cheapest and most valuable first, so a tight budget still gets the basics done
+    const MaintenanceTask order[] = {
+        MaintenanceTask::Optimize,
+        MaintenanceTask::QuickCheck,
+        MaintenanceTask::Analyze,
+        MaintenanceTask::IncrementalVacuum,
+        MaintenanceTask::EnableAutoVacuum
+    };
+
+    for (MaintenanceTask which : order) {
+        if (!tasks.testFlag(which)) {
+            continue;
+        }
+        if (!CanInterrupt && needsInterrupt(which)) {
+            qDebug() << "Maintenance cannot be interrupted in this build, skipping" << maintenanceTaskName(which);
+            continue;
+        }
+        // The conversion has its own budget and does not depend on what is left
+        if (which != MaintenanceTask::EnableAutoVacuum && budget.remainingMs() <= 0) {
+            qDebug() << "Maintenance budget exhausted, deferring" << maintenanceTaskName(which);
+            continue;
+        }
+
+        MaintenanceTaskResult task;
+        task.task = which;
+        QElapsedTimer taskClock;
+        taskClock.start();
+        Status status = Status::Ok;
+
+        switch (which) {
+            case MaintenanceTask::Optimize:
+                status = connection.exec("PRAGMA optimize;");
+                break;
+
+            case MaintenanceTask::QuickCheck: {
+                QStringList rows;
+                status = connection.exec("PRAGMA quick_check;", &rows);
+                if (status == Status::Ok && !(rows.size() == 1 && rows.first() == "ok")) {
+                    task.detail = rows.mid(0, 5).join("; ");
+                    status = Status::Corrupt;
+                } else if (status == Status::Ok) {
+                    task.detail = "ok";
+                }
+                break;
+            }
+
+            case MaintenanceTask::Analyze:
+                connection.exec(QString("PRAGMA analysis_limit = %1;").arg(policy.analysisLimit));
+                status = connection.exec("ANALYZE;");
+                task.detail = QString("analysis_limit=%1").arg(policy.analysisLimit);
+                break;
+
+            case MaintenanceTask::IncrementalVacuum: {
+                if (connection.pragmaInt("PRAGMA auto_vacuum;") != 2) {
+                    continue;  // Needs the one-time auto_vacuum conversion first
+                }
+                const qint64 freeBefore = connection.pragmaInt("PRAGMA freelist_count;");
+                if (freeBefore < policy.minFreePages) {
+                    continue;  // Nothing worth reclaiming
+                }
+                status = connection.exec(QString("PRAGMA incremental_vacuum(%1);").arg(policy.vacuumPagesPerRun));
+                const qint64 freeAfter = connection.pragmaInt("PRAGMA freelist_count;");
+                task.detail = QString("freed %1 pages, %2 free pages remain").arg(freeBefore - freeAfter).arg(freeAfter);
+                break;
+            }
+
+            case MaintenanceTask::EnableAutoVacuum: {
+                if (connection.pragmaInt("PRAGMA auto_vacuum;") != 0) {
+                    continue;
+                }
+                const qint64 bytes = QFileInfo(databasePath).size();
+                if (bytes > policy.autoVacuumMaxBytes) {
+                    task.detail = QString("Skipped: %1 MB is too large for an idle-time VACUUM").arg(bytes / (1024 * 1024));
+                    status = Status::Ok;
+                    break;
+                }
+                // A full VACUUM of a file near autoVacuumMaxBytes cannot finish
+                // within the idle budget, so the one-time conversion gets its own
+                budget.limitMs = budget.clock.elapsed() + policy.autoVacuumBudgetMs;
+                // auto_vacuum only changes on an existing file through a full VACUUM
+                status = connection.exec("PRAGMA auto_vacuum = INCREMENTAL;");
+                if (status == Status::Ok) {
+                    status = connection.exec("VACUUM;");
+                }
+                if (status == Status::Ok) {
+                    task.detail = QString("Converted %1 KB file to incremental auto_vacuum").arg(bytes / 1024);
+                } else {
+                    qDebug() << "ERROR: auto_vacuum conversion failed:" << connection.error();
+                }
+                break;
+            }
+
+            default:
+                continue;
+        }
+
+        finishTask(task, connection, status, taskClock);
+        result.tasks << task;
+    }
+
+    result.elapsedMs = budget.clock.elapsed();
+    return result;
+}
+
+MaintenanceScheduler::MaintenanceScheduler(const QString &databasePath, const MaintenancePolicy &policy,
+                                           QObject *parent)
+    : QObject(parent), m_databasePath(databasePath), m_policy(policy)
+{
+    qRegisterMetaType<firewood::db::MaintenanceResult>();
+
+    m_sinceActivity.start();
+    connect(&m_timer, &QTimer::timeout, this, &MaintenanceScheduler::checkIdle);
+}
+
+MaintenanceScheduler::~MaintenanceScheduler()
+{
+    stop();
+    if (m_worker) {
+        m_worker->wait();
+    }
+}
+
+void MaintenanceScheduler::start()
+{
+    if (QCoreApplication::instance()) {
+        QCoreApplication::instance()->installEventFilter(this);
+    }
+    m_timer.start(m_policy.checkIntervalMinutes * 60 * 1000);
+    qDebug() << "Maintenance scheduler started, idle threshold" << m_policy.idleMinutes << "minutes";
+}
+
+void MaintenanceScheduler::stop()
+{
+    m_timer.stop();
+    if (QCoreApplication::instance()) {
+        QCoreApplication::instance()->removeEventFilter(this);
+    }
+}
+
+bool MaintenanceScheduler::eventFilter(QObject *watched, QEvent *event)
+{
+    switch (event->type()) {
+        case QEvent::KeyPress:
+        case QEvent::MouseButtonPress:
+        case QEvent::MouseMove:
+        case QEvent::Wheel:
+            m_sinceActivity.restart();
+            break;
+        default:
+            break;
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+double MaintenanceScheduler::daysSinceLastRun(MaintenanceTask task, bool successOnly) const
+{
+    QSqlQuery query(QSqlDatabase::database());
+    query.prepare(QString("SELECT julianday('now') - julianday(MAX(run_at)) FROM maintenance_log "
+                          "WHERE task = :task%1").arg(successOnly ? " AND success = 1" : ""));
+    query.bindValue(":task", maintenanceTaskName(task));
+    if (query.exec() && query.next() && !query.value(0).isNull()) {
+        return query.value(0).toDouble();
+    }
+    return -1.0;  // Never run
+}
+
+MaintenanceTasks MaintenanceScheduler::dueTasks() const
+{
+    MaintenanceTasks tasks;
+
+    auto overdue = [this](MaintenanceTask task, double days, bool successOnly = true) {
+        const double since = daysSinceLastRun(task, successOnly);
+        return since < 0 || since >= days;
+    };
+
+    if (overdue(MaintenanceTask::Optimize, m_policy.optimizeEveryHours / 24.0)) {
+        tasks |= MaintenanceTask::Optimize;
+    }
+    if (CanInterrupt && overdue(MaintenanceTask::QuickCheck, m_policy.quickCheckEveryDays)) {
+        tasks |= MaintenanceTask::QuickCheck;
+    }
+    if (overdue(MaintenanceTask::Analyze, m_policy.analyzeEveryDays)) {
+        tasks |= MaintenanceTask::Analyze;
+    }
+
+    QSqlQuery pragma(QSqlDatabase::database());
+    qint64 autoVacuum = -1;
+    if (pragma.exec("PRAGMA auto_vacuum;") && pragma.next()) {
+        autoVacuum = pragma.value(0).toLongLong();
+    }
+    if (CanInterrupt && autoVacuum == 0 && overdue(MaintenanceTask::EnableAutoVacuum, m_policy.analyzeEveryDays, false)) {
+        tasks |= MaintenanceTask::EnableAutoVacuum;
+    }
+    if (autoVacuum == 2 && pragma.exec("PRAGMA freelist_count;") && pragma.next() &&
+        pragma.value(0).toLongLong() >= m_policy.minFreePages) {
+        tasks |= MaintenanceTask::IncrementalVacuum;
+    }
+
+    return tasks;
+}
+
+void MaintenanceScheduler::checkIdle()
+{
+    if (m_running || m_sinceActivity.elapsed() < qint64(m_policy.idleMinutes) * 60 * 1000) {
+        return;
+    }
+
+    const MaintenanceTasks tasks = dueTasks();
+    if (!tasks) {
+        return;
+    }
+    runNow(tasks);
+}
+
+bool MaintenanceScheduler::runNow(MaintenanceTasks tasks)
+{
+    if (m_running || !tasks) {
+        return false;
+    }
+    m_running = true;
+
+    const QString path = m_databasePath;
+    const MaintenancePolicy policy = m_policy;
+
+    qDebug() << "Starting database maintenance, tasks:" << static_cast<unsigned>(tasks.toInt());
+
+    m_worker = QThread::create([this, path, tasks, policy]() {
+        MaintenanceResult result = runMaintenance(path, tasks, policy);
+        result.finishedAt = QDateTime::currentDateTime();
+        QMetaObject::invokeMethod(this, [this, result]() { onWorkerFinished(result); }, Qt::QueuedConnection);
+    });
+    connect(m_worker, &QThread::finished, m_worker, &QObject::deleteLater);
+    m_worker->start(QThread::LowestPriority);
+    return true;
+}
+
+void MaintenanceScheduler::onWorkerFinished(const MaintenanceResult &result)
+{
+    m_running = false;
+    m_worker = nullptr;
+
+    for (const MaintenanceTaskResult &task : result.tasks) {
+        qDebug() << "Maintenance" << maintenanceTaskName(task.task) << (task.success ? "ok" : "FAILED")
+                 << "in" << task.elapsedMs << "ms" << task.detail;
+    }
+
+    recordResult(result);
+    emit maintenanceFinished(result);
+}
+
+void MaintenanceScheduler::recordResult(const MaintenanceResult &result)
+{
+    QSqlDatabase db = QSqlDatabase::database();
+    if (!db.isValid() || !db.isOpen()) {
+        return;
+    }
+
+    QSqlQuery query(db);
+    query.prepare("INSERT INTO maintenance_log (task, success, timed_out, elapsed_ms, detail) "
+                  "VALUES (:task, :success, :timed_out, :elapsed, :detail)");
+    for (const MaintenanceTaskResult &task : result.tasks) {
+        query.bindValue(":task", maintenanceTaskName(task.task));
+        query.bindValue(":success", task.success ? 1 : 0);
+        query.bindValue(":timed_out", task.timedOut ? 1 : 0);
+        query.bindValue(":elapsed", task.elapsedMs);
+        query.bindValue(":detail", task.detail);
+        if (!query.exec()) {
+            qDebug() << "WARNING: Could not record maintenance result:" << query.lastError().text();
+        }
+    }
+}
+
+} // namespace firewood::db
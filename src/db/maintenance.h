@@ -0,0 +1,135 @@
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QList>
+#include <QDateTime>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QMetaType>
+
+class QThread;
+
+namespace firewood::db {
+
+/**
+ * @brief Individual maintenance tasks (combine as flags)
+ */
+enum class MaintenanceTask : unsigned {
+    None = 0,
+    Optimize = 1 << 0,           // PRAGMA optimize
+    QuickCheck = 1 << 1,         // PRAGMA quick_check
+    Analyze = 1 << 2,            // ANALYZE with analysis_limit
+    IncrementalVacuum = 1 << 3,  // PRAGMA incremental_vacuum(N)
+    EnableAutoVacuum = 1 << 4    // One-time switch of older files to auto_vacuum=INCREMENTAL
+};
+Q_DECLARE_FLAGS(MaintenanceTasks, MaintenanceTask)
+Q_DECLARE_OPERATORS_FOR_FLAGS(MaintenanceTasks)
+
+/**
+ * @brief Cadence and time budget for idle-time maintenance
+ */
+struct MaintenancePolicy {
+    int checkIntervalMinutes = 5;    // How often to look for an idle window
+    int idleMinutes = 10;            // No keyboard/mouse input for this long counts as idle
+    int timeBudgetMs = 3000;         // Wall-clock budget for one maintenance run
+    int autoVacuumBudgetMs = 60000;  // Separate budget for the one-time auto_vacuum conversion VACUUM
+    int optimizeEveryHours = 6;
+    int analyzeEveryDays = 7;
+    int quickCheckEveryDays = 1;
+    int analysisLimit = 1000;        // Rows sampled per index by ANALYZE
+    int minFreePages = 64;           // Freelist size that triggers an incremental vacuum
+    int vacuumPagesPerRun = 512;     // Pages released per incremental vacuum
+    qint64 autoVacuumMaxBytes = 64ll * 1024 * 1024;  // Largest file converted with a full VACUUM
+};
+
+/**
+ * @brief Outcome of one task within a maintenance run
+ */
+struct MaintenanceTaskResult {
+    MaintenanceTask task = MaintenanceTask::None;
+    bool success = false;
+    bool timedOut = false;
+    qint64 elapsedMs = 0;
+    QString detail;
+};
+
+/**
+ * @brief Outcome of a full maintenance run
+ */
+struct MaintenanceResult {
+    QList<MaintenanceTaskResult> tasks;
+    qint64 elapsedMs = 0;
+    QDateTime finishedAt;
+};
+
+/**
+ * @brief Short name stored in maintenance_log.task
+ */
+QString maintenanceTaskName(MaintenanceTask task);
+
+/**
+ * @brief Runs the requested tasks on a private connection within the policy's time budget
+ *
+ * Blocking; run it on a worker thread. Statements that overrun the remaining budget
+ * are interrupted and reported as timed out rather than blocking the application.
+ * Interrupting needs the build option FIREWOOD_USE_SYSTEM_SQLITE (on by default).
+ * Without it the budget is only checked between statements, so QuickCheck and
+ * EnableAutoVacuum, whose run time grows with the file, are skipped.
+ */
+MaintenanceResult runMaintenance(const QString &databasePath, MaintenanceTasks tasks,
+                                 const MaintenancePolicy &policy);
+
+/**
+ * @brief Runs database maintenance in the background while the application is idle
+ *
+ * Watches application input events to detect idle periods, decides which tasks are
+ * due from the maintenance_log table and records every task result there.
+ */
+class MaintenanceScheduler : public QObject {
+    Q_OBJECT
+
+public:
+    explicit MaintenanceScheduler(const QString &databasePath,
+                                  const MaintenancePolicy &policy = MaintenancePolicy(),
+                                  QObject *parent = nullptr);
+    ~MaintenanceScheduler() override;
+
+    void start();
+    void stop();
+    bool isRunning() const { return m_running; }
+
+    /**
+     * @brief Tasks that are due now based on the last successful runs
+     */
+    MaintenanceTasks dueTasks() const;
+
+public slots:
+    /**
+     * @brief Runs the given tasks immediately (ignores the idle check)
+     */
+    bool runNow(firewood::db::MaintenanceTasks tasks);
+
+signals:
+    void maintenanceFinished(const firewood::db::MaintenanceResult &result);
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    void checkIdle();
+    void onWorkerFinished(const MaintenanceResult &result);
+    void recordResult(const MaintenanceResult &result);
+    double daysSinceLastRun(MaintenanceTask task, bool successOnly) const;
+
+    QString m_databasePath;
+    MaintenancePolicy m_policy;
+    QTimer m_timer;
+    QElapsedTimer m_sinceActivity;
+    QThread *m_worker = nullptr;
+    bool m_running = false;
+};
+
+} // namespace firewood::db
+
+Q_DECLARE_METATYPE(firewood::db::MaintenanceResult)
@@ -0,0 +1,385 @@
+#include "query_plan.h"
+#include "client_matching.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDate>
+#include <QDebug>
+
+namespace firewood::db {
+
+QList<HotQuery> hotQueries() {
+    // Day numbers as stored in the *_day columns (Julian day, see core::DateRange)
+    const QDate currentDate = QDate::currentDate();
+    const qint64 tomorrow = currentDate.toJulianDay() + 1;
+    const qint64 monthStart = currentDate.addDays(1 - currentDate.day()).toJulianDay();
+    const qint64 nextMonthStart = currentDate.addDays(1 - currentDate.day()).addMonths(1).toJulianDay();
+    const qint64 yearAgo = currentDate.addYears(-1).toJulianDay();
+
+    // Status codes are written out as the call sites produce them (core::OrderStatus)
+    return {
+        // DashboardWidget::loadStatistics
+        {"dashboard.completed_cords_since",
+         "SELECT COALESCE(SUM(delivered_cords), 0) FROM orders WHERE status_code = 4 AND delivery_day >= ? AND delivery_day < ?",
+         {monthStart, nextMonthStart}},
+        {"dashboard.completed_paid_since",
+         "SELECT COALESCE(SUM(amount_paid_cents), 0) FROM orders WHERE status_code = 4 AND delivery_day >= ? AND delivery_day < ?",
+         {monthStart, nextMonthStart}},
+        {"dashboard.households_served",
+         "SELECT COUNT(DISTINCT household_id) FROM orders WHERE status_code = 4",
+         {}},
+        {"dashboard.open_requested_cords",
+         "SELECT COALESCE(SUM(requested_cords - delivered_cords), 0) FROM orders "
+         "WHERE status_code IN (1, 2, 3)",
+         {}},
+
+        // DashboardWidget::loadUpcomingOrders
+        {"dashboard.upcoming_orders",
+         "SELECT o.order_date, h.name, h.phone "
+         "FROM orders o "
+         "JOIN households h ON o.household_id = h.id "
+         "WHERE o.status_code IN (1, 2, 3) "
+         "ORDER BY o.delivery_date, o.order_date "
+         "LIMIT 10",
+         {}},
+
+        // TwoWeekScheduleWidget::reload
+        {"dashboard.two_week_schedule",
+         "SELECT 0, delivery_day, COUNT(*), COALESCE(SUM(requested_cords), 0), 0 FROM orders "
+         "WHERE status_code IN (1, 2, 3) AND delivery_day >= ? AND delivery_day < ? "
+         "GROUP BY delivery_day "
+         "UNION ALL "
+         "SELECT 1, work_day, COUNT(*), COALESCE(SUM(slots_filled), 0), COALESCE(SUM(volunteer_slots), 0) "
+         "FROM work_schedule WHERE work_day >= ? AND work_day < ? "
+         "GROUP BY work_day",
+         {tomorrow - 1, tomorrow + 13, tomorrow - 1, tomorrow + 13}},
+
+        // DashboardWidget::ordersPerDay
+        {"dashboard.orders_per_day",
+         "SELECT delivery_day, COUNT(*) FROM orders "
+         "WHERE delivery_day >= ? AND delivery_day < ? AND status_code <> 5 "
+         "GROUP BY delivery_day",
+         {monthStart, nextMonthStart}},
+
+        // LoginDialog::authenticate
+        {"login.credentials",
+         "SELECT a.username, a.role FROM user_accounts a "
+         "JOIN user_credentials c ON c.user_id = a.id "
+         "WHERE a.username = ? AND c.password_hash = ? AND a.active = 1",
+         {"user1", ""}},
+
+        // WorkOrderDialog::loadClients
+        {"work_order.client_list",
+         "SELECT m.household_id, u.full_name FROM users u "
+         "JOIN household_user_mapping m ON m.user_id = u.id "
+         "WHERE u.user_type IN ('client', 'volunteer') ORDER BY u.full_name",
+         {}},
+
+        // WorkOrderDialog::loadCredit (creditBalance, creditPostedForOrder)
+        {"work_order.credit_balance",
+         "SELECT credit_balance FROM households WHERE id = ?",
+         {1}},
+        {"work_order.order_credit",
+         "SELECT COALESCE(SUM(cords), 0) FROM credit_ledger WHERE order_id = ? AND household_id = ?",
+         {1, 1}},
+
+        // creditStatement
+        {"credit.statement",
+         "SELECT id, day, kind, cords, balance, volunteer_hours_id, order_id, memo, created_by "
+         "FROM credit_ledger WHERE household_id = ? AND day >= ? AND day < ? ORDER BY id",
+         {1, yearAgo, tomorrow}},
+
+        // VolunteerProfileWidget
+        {"volunteer.household_lookup",
+         "SELECT id FROM households WHERE name = ? OR phone = ? OR email = ?",
+         {"Household 1", "Household 1", "Household 1"}},
+        {"volunteer.hours",
+         "WITH recent AS ("
+         "SELECT date, hours, activity FROM volunteer_hours "
+         "WHERE household_id = ? ORDER BY date DESC LIMIT 20) "
+         "SELECT date, hours, activity, 0 AS is_total FROM recent "
+         "UNION ALL "
+         "SELECT NULL, SUM(hours), NULL, 1 FROM recent HAVING COUNT(*) > 0",
+         {1}},
+        {"volunteer.certifications",
+         "SELECT certification_name, issue_date, expiration_date "
+         "FROM volunteer_certifications WHERE household_id = ? "
+         "ORDER BY expiration_date DESC",
+         {1}},
+        {"volunteer.available_work_days",
+         "SELECT ws.work_date, ws.start_time, ws.activity_type, ws.location, ws.slots_filled, "
+         "(SELECT CASE WHEN s.status = 'Waitlisted' THEN "
+         "(SELECT COUNT(*) FROM work_schedule_signups w "
+         "WHERE w.schedule_id = s.schedule_id AND w.status = 'Waitlisted' AND w.id <= s.id) ELSE 0 END "
+         "FROM work_schedule_signups s WHERE s.schedule_id = ws.id AND s.household_id = ?) as signup_state, "
+         "ws.id, ws.end_time, ws.volunteer_slots, "
+         "(SELECT COUNT(*) FROM work_schedule_signups w WHERE w.schedule_id = ws.id AND w.status = 'Waitlisted') as waitlisted "
+         "FROM work_schedule ws "
+         "WHERE ws.work_date >= date('now') "
+         "ORDER BY ws.work_date, ws.start_time",
+         {1}},
+
+        // signUpForShift, cancelShiftSignup
+        {"shift_signup.waitlist_position",
+         "SELECT COUNT(*) FROM work_schedule_signups WHERE schedule_id = ? AND status = ? AND id <= ?",
+         {1, "Waitlisted", 100}},
+        {"shift_signup.next_waitlisted",
+         "SELECT id, household_id FROM work_schedule_signups "
+         "WHERE schedule_id = ? AND status = ? ORDER BY id LIMIT 1",
+         {1, "Waitlisted"}},
+
+        // ClientDialog
+        {"client.volunteer_hours",
+         "SELECT date, hours, activity, notes FROM volunteer_hours "
+         "WHERE household_id = ? ORDER BY date DESC",
+         {1}},
+
+        // client_matching findClientMatches (ClientDialog duplicate check)
+        {"client_match.dirty_households",
+         "SELECT d.household_id, h.name, h.phone, h.address, h.id "
+         "FROM household_match_dirty d LEFT JOIN households h ON h.id = d.household_id "
+         "WHERE d.household_id > ? ORDER BY d.household_id LIMIT ?",
+         {0, 500}},
+        {"client_match.key_candidates",
+         "SELECT household_id FROM household_match_keys "
+         "WHERE (phonetic_key = ? AND ? <> '') OR (phone_key = ? AND ? <> '') "
+         "OR (address_key = ? AND ? <> '') LIMIT ?",
+         {"1 H432", "1 H432", "5550001", "5550001", "1 co rd 1", "1 co rd 1", 200}},
+        {"client_match.trigram_candidates",
+         "SELECT household_id FROM household_trigrams WHERE field = ? AND trigram IN (?, ?, ?, ?)",
+         {1, " 1 ", " ho", "hou", "ous"}},
+
+        // UserManagementDialog
+        {"user_management.household_by_name",
+         "SELECT id FROM households WHERE name = ?",
+         {"Household 1"}},
+
+        // DeliveryLogModel::loadPage (a continued page; the first omits the row value)
+        {"delivery_log.page",
+         "SELECT id, delivery_day, driver, delivery_date, delivery_time, "
+         "start_mileage, end_mileage, total_miles, delivered_cords, client_name "
+         "FROM delivery_log WHERE delivery_day >= ? AND delivery_day < ? "
+         "AND (delivery_day, id) < (?, ?) "
+         "ORDER BY delivery_day DESC, id DESC LIMIT 200",
+         {yearAgo, tomorrow, currentDate.toJulianDay(), 1000000}},
+        {"delivery_log.page_by_driver",
+         "SELECT id, delivery_day, driver, delivery_date, delivery_time, "
+         "start_mileage, end_mileage, total_miles, delivered_cords, client_name "
+         "FROM delivery_log WHERE driver = ? AND delivery_day >= ? AND delivery_day < ? "
+         "AND (delivery_day, id) < (?, ?) "
+         "ORDER BY delivery_day DESC, id DESC LIMIT 200",
+         {"Driver 1", yearAgo, tomorrow, currentDate.toJulianDay(), 1000000}},
+
+        // DeliveryLogModel::totals
+        {"delivery_log.totals",
+         "SELECT COUNT(*), COALESCE(SUM(total_miles), 0), COALESCE(SUM(delivered_cords), 0) "
+         "FROM delivery_log WHERE delivery_day >= ? AND delivery_day < ?",
+         {yearAgo, tomorrow}},
+        {"delivery_log.totals_by_driver",
+         "SELECT COUNT(*), COALESCE(SUM(total_miles), 0), COALESCE(SUM(delivered_cords), 0) "
+         "FROM delivery_log WHERE driver = ? AND delivery_day >= ? AND delivery_day < ?",
+         {"Driver 1", yearAgo, tomorrow}},
+
+        // loadBookkeepingPivot (BookkeepingWidget::loadBreakdown)
+        {"bookkeeping.pivot_rows",
+         "SELECT 0, source, day, amount_cents FROM income WHERE day >= ? AND day < ? "
+         "UNION ALL "
+         "SELECT 1, category, day, amount_cents FROM expenses WHERE day >= ? AND day < ?",
+         {yearAgo, nextMonthStart, yearAgo, nextMonthStart}},
+        {"bookkeeping.pivot_budgets",
+         "SELECT category_name, category_type, COALESCE(annual_budget, 0) FROM budget_categories "
+         "WHERE active = 1 ORDER BY category_type DESC, category_name",
+         {}},
+
+        // LedgerTableModel::select (BookkeepingWidget::filterByDateRange)
+        {"bookkeeping.expenses_filtered",
+         "SELECT id, date, category, amount, description, vendor, receipt_path, payment_method, created_by "
+         "FROM expenses WHERE category = ? AND day >= ? AND day < ? ORDER BY day DESC",
+         {"fuel", monthStart, nextMonthStart}},
+        {"bookkeeping.expenses_in_range",
+         "SELECT id, date, category, amount, description, vendor, receipt_path, payment_method, created_by "
+         "FROM expenses WHERE day >= ? AND day < ? ORDER BY day DESC",
+         {monthStart, nextMonthStart}},
+        {"bookkeeping.income_filtered",
+         "SELECT id, date, source, amount, description, donor_name, tax_deductible, receipt_issued, created_by "
+         "FROM income WHERE source = ? AND day >= ? AND day < ? ORDER BY day DESC",
+         {"donation", monthStart, nextMonthStart}},
+        {"bookkeeping.income_in_range",
+         "SELECT id, date, source, amount, description, donor_name, tax_deductible, receipt_issued, created_by "
+         "FROM income WHERE day >= ? AND day < ? ORDER BY day DESC",
+         {monthStart, nextMonthStart}},
+
+        // loadAllTimeTotals (BookkeepingWidget::updateFinancialSummary)
+        {"bookkeeping.all_time_totals",
+         "SELECT (SELECT COALESCE(SUM(amount_cents), 0) FROM income), "
+         "(SELECT COALESCE(SUM(amount_cents), 0) FROM expenses)",
+         {}},
+
+        // ProfileChangeRequestDialog::loadRequests
+        {"change_requests.by_status",
+         "SELECT pr.id, pr.requested_by, pr.field_name, pr.old_value, pr.new_value, "
+         "pr.request_date, pr.status, pr.reviewed_by "
+         "FROM profile_change_requests pr "
+         "WHERE pr.status = ? "
+         "ORDER BY pr.request_date DESC",
+         {"pending"}},
+        {"change_requests.all",
+         "SELECT pr.id, pr.requested_by, pr.field_name, pr.old_value, pr.new_value, "
+         "pr.request_date, pr.status, pr.reviewed_by "
+         "FROM profile_change_requests pr "
+         "ORDER BY pr.request_date DESC",
+         {}},
+    };
+}
+
+QueryPlanReport explainQueryPlan(QSqlDatabase &db, const HotQuery &hot) {
+    QueryPlanReport report;
+    report.name = hot.name;
+    report.sql = hot.sql;
+
+    QSqlQuery query(db);
+    if (!query.prepare("EXPLAIN QUERY PLAN " + hot.sql)) {
+        report.error = query.lastError().text();
+        return report;
+    }
+    for (const QVariant &value : hot.bindValues) {
+        query.addBindValue(value);
+    }
+    if (!query.exec()) {
+        report.error = query.lastError().text();
+        return report;
+    }
+
+    // Columns: id, parent, notused, detail
+    while (query.next()) {
+        const QString detail = query.value(3).toString();
+        report.planLines << detail;
+
+        if (hot.allowFullScan) {
+            continue;
+        }
+        // "SCAN t USING [COVERING] INDEX ..." walks an index in order and is fine;
+        // a bare "SCAN t" reads every row of the table
+        if (detail.startsWith("SCAN ") && !detail.contains(" INDEX ")) {
+            report.problems << "Full table scan: " + detail;
+        }
+        if (detail.contains("USE TEMP B-TREE")) {
+            report.problems << "Temporary B-tree: " + detail;
+        }
+    }
+
+    return report;
+}
+
+QList<QueryPlanReport> checkHotQueries(QSqlDatabase &db) {
+    QList<QueryPlanReport> reports;
+    for (const HotQuery &hot : hotQueries()) {
+        reports << explainQueryPlan(db, hot);
+    }
+    return reports;
+}
+
+bool generateLoadTestData(QSqlDatabase &db, int households) {
+    if (households <= 0) {
+        return false;
+    }
+
+    // Each statement counts 1..:rows with a recursive CTE; :households spreads
+    // child rows across the generated households. Dates cover the last four years.
+    const QString seq = "WITH RECURSIVE seq(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < :rows) ";
+
+    struct Generator {
+        const char *table;
+        int rows;
+        QString sql;
+    };
+
+    const QList<Generator> generators = {
+        {"households", households,
+         seq + "INSERT INTO households (name, address, phone, email) "
+               "SELECT 'Household ' || n, n || ' County Road ' || (n % 97), "
+               "'555' || substr('0000000' || n, -7), 'household' || n || '@example.org' FROM seq"},
+        {"users", households,
+         seq + "INSERT INTO users (username, password_hash, role, full_name, email, phone, user_type, active) "
+               "SELECT 'user' || n, '', CASE WHEN n % 50 = 0 THEN 'employee' ELSE 'volunteer' END, "
+               "'Household ' || n, 'household' || n || '@example.org', '555' || substr('0000000' || n, -7), "
+               "CASE WHEN n % 50 = 0 THEN 'employee' WHEN n % 5 = 0 THEN 'volunteer' ELSE 'client' END, 1 "
+               "FROM seq"},
+        {"household_user_mapping", households,
+         seq + "INSERT INTO household_user_mapping (household_id, user_id) SELECT n, n FROM seq"},
+        {"orders", households * 5,
+         seq + "INSERT INTO orders (household_id, order_date, requested_cords, delivered_cords, status, "
+               "priority, delivery_date, amount_paid) "
+               "SELECT 1 + (n * 7919) % :households, date('now', '-' || (n % 1460) || ' days'), 1 + n % 3, "
+               "CASE WHEN n % 10 < 7 THEN 1 + n % 3 ELSE 0 END, "
+               "CASE n % 10 WHEN 7 THEN 'Pending' WHEN 8 THEN 'Scheduled' WHEN 9 THEN 'In Progress' ELSE 'Completed' END, "
+               "'Normal', date('now', '-' || (n % 1460) || ' days', '+7 days'), (n % 4) * 25 FROM seq"},
+        {"delivery_log", households * 3,
+         seq + "INSERT INTO delivery_log (order_id, driver, delivery_date, start_mileage, end_mileage, "
+               "delivered_cords, client_name) "
+               "SELECT n, 'Driver ' || (n % 12), date('now', '-' || (n % 1460) || ' days'), 1000 + n, "
+               "1010 + n + n % 40, 1 + n % 3, 'Household ' || (1 + (n * 7919) % :households) FROM seq"},
+        {"volunteer_hours", households * 2,
+         seq + "INSERT INTO volunteer_hours (household_id, date, hours, activity) "
+               "SELECT 1 + (n * 31) % :households, date('now', '-' || (n % 1460) || ' days'), 1 + n % 6, "
+               "'Splitting' FROM seq"},
+        {"volunteer_certifications", households,
+         seq + "INSERT INTO volunteer_certifications (household_id, certification_name, issue_date, expiration_date) "
+               "SELECT 1 + (n * 17) % :households, 'Chainsaw Safety', date('now', '-' || (n % 700) || ' days'), "
+               "date('now', '+' || (n % 700) || ' days') FROM seq"},
+        {"work_schedule", qMax(1, households / 4),
+         seq + "INSERT INTO work_schedule (work_date, start_time, end_time, activity_type, volunteer_slots) "
+               "SELECT date('now', '-' || (n % 1460) || ' days', '+60 days'), "
+               "substr('0' || (8 + n % 4), -2) || ':00', (12 + n % 4) || ':00', 'Splitting', 6 FROM seq"},
+        {"work_schedule_signups", households,
+         seq + "INSERT OR IGNORE INTO work_schedule_signups (schedule_id, household_id) "
+               "SELECT 1 + n % (SELECT COUNT(*) FROM work_schedule), 1 + (n * 13) % :households FROM seq"},
+        {"profile_change_requests", households,
+         seq + "INSERT INTO profile_change_requests (user_id, requested_by, field_name, old_value, new_value, "
+               "status, request_date) "
+               "SELECT 1 + n % :households, 'user' || (1 + n % :households), 'phone', '', '', "
+               "CASE n % 5 WHEN 0 THEN 'pending' WHEN 1 THEN 'rejected' ELSE 'approved' END, "
+               "datetime('now', '-' || (n % 1460) || ' days') FROM seq"},
+        {"expenses", households * 2,
+         seq + "INSERT INTO expenses (date, category, amount, description) "
+               "SELECT date('now', '-' || (n % 1460) || ' days'), 'Category ' || (n % 15), 10 + n % 500, "
+               "'Generated' FROM seq"},
+        {"income", households * 2,
+         seq + "INSERT INTO income (date, source, amount, description) "
+               "SELECT date('now', '-' || (n % 1460) || ' days'), 'Source ' || (n % 15), 10 + n % 500, "
+               "'Generated' FROM seq"},
+    };
+
+    if (!db.transaction()) {
+        qDebug() << "ERROR: Failed to start transaction:" << db.lastError().text();
+        return false;
+    }
+
+    for (const Generator &gen : generators) {
+        QSqlQuery query(db);
+        query.prepare(gen.sql);
+        query.bindValue(":rows", gen.rows);
+        if (gen.sql.contains(":households")) {
+            query.bindValue(":households", households);
+        }
+        if (!query.exec()) {
+            qDebug() << "ERROR: Failed to generate" << gen.table << "rows:" << query.lastError().text();
+            db.rollback();
+            return false;
+        }
+        qDebug() << "Generated" << query.numRowsAffected() << gen.table << "rows";
+    }
+
+    // Match keys are computed in C++, not by the generators
+    if (!refreshClientMatchKeys(db)) {
+        db.rollback();
+        return false;
+    }
+
+    if (!db.commit()) {
+        qDebug() << "ERROR: Failed to commit generated data:" << db.lastError().text();
+        return false;
+    }
+    return true;
+}
+
+} // namespace firewood::db
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QVariantList>
+#include <QList>
+
+namespace firewood::db {
+
+/**
+ * @brief A query the application runs on a hot path, with sample bind values
+ *
+ * The SQL must stay identical (apart from literal formatting) to the statement at
+ * the call site so the plan checked here is the plan the application gets.
+ */
+struct HotQuery {
+    QString name;                 // "<area>.<purpose>", e.g. "dashboard.completed_since"
+    QString sql;
+    QVariantList bindValues;      // Positional values for '?' placeholders
+    bool allowFullScan = false;   // Whole-table reads that are expected (e.g. exports)
+};
+
+/**
+ * @brief EXPLAIN QUERY PLAN output for one hot query and the problems found in it
+ */
+struct QueryPlanReport {
+    QString name;
+    QString sql;
+    QStringList planLines;
+    QStringList problems;         // Full table scans and temp B-trees
+    QString error;                // Set if the query could not be explained
+
+    bool ok() const { return error.isEmpty() && problems.isEmpty(); }
+};
+
+/**
+ * @brief The canonical list of hot queries used by the dashboard, dialogs and login
+ */
+QList<HotQuery> hotQueries();
+
+/**
+ * @brief Runs EXPLAIN QUERY PLAN for a query and flags scans without an index
+ *        and temporary B-trees used for sorting, grouping or DISTINCT
+ */
+QueryPlanReport explainQueryPlan(QSqlDatabase &db, const HotQuery &query);
+
+/**
+ * @brief Explains every hot query against the given database
+ */
+QList<QueryPlanReport> checkHotQueries(QSqlDatabase &db);
+
+/**
+ * @brief Fills a freshly migrated database with synthetic rows for plan checks
+ * @param households Number of households/users; other tables scale from this
+ * @return true if successful, false otherwise
+ *
+ * Run ANALYZE afterwards so the planner sees realistic statistics.
+ */
+bool generateLoadTestData(QSqlDatabase &db, int households);
+
+} // namespace firewood::db
@@ -0,0 +1,247 @@
+#include "report_engine.h"
+#include "Codes.h"
+#include <QtConcurrent>
+#include <QFuture>
+#include <QMutexLocker>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QThread>
+#include <QDebug>
+#include <algorithm>
+
+namespace firewood::db {
+
+namespace {
+
+using core::ReportColumn;
+
+struct SectionSpec {
+    QString title;
+    QStringList tables;     // Tables read, for the cache's data versions
+    QString sql;            // Binds :first_day and :end_day
+    QList<ReportColumn> columns;
+};
+
+// Rows by month and group (region or source), then one total row per group
+// ("Total" sorts after the months). The CTE is read twice but materialized once, so the day range
+// is searched a single time.
+QString byMonthAndGroup(const QString &cte, const QString &aggregates) {
+    return QString("WITH picked AS (%1) "
+                   "SELECT month, grp, %2 FROM picked GROUP BY month, grp "
+                   "UNION ALL "
+                   "SELECT 'Total', grp, %2 FROM picked GROUP BY grp "
+                   "ORDER BY month, grp")
+        .arg(cte, aggregates);
+}
+
+SectionSpec sectionSpec(ReportSectionKind kind) {
+    // Day numbers are Julian days at noon, which strftime() reads directly
+    const QString completed = QString::number(core::code(core::OrderStatus::Completed));
+    const QString completedOrders =
+        "SELECT strftime('%Y-%m', o.delivery_day) AS month, COALESCE(h.region, 'Unknown') AS grp, "
+        "o.household_id, o.delivered_cords "
+        "FROM orders o JOIN households h ON h.id = o.household_id "
+        "WHERE o.delivery_day >= :first_day AND o.delivery_day < :end_day AND o.status_code = " + completed;
+
+    switch (kind) {
+    case ReportSectionKind::HouseholdsServed:
+        return {"Households Served", {"orders", "households"},
+                byMonthAndGroup(completedOrders, "COUNT(DISTINCT household_id), COUNT(*)"),
+                {{"Month"}, {"Region"}, {"Households", ReportColumn::Kind::Integer},
+                 {"Deliveries", ReportColumn::Kind::Integer}}};
+    case ReportSectionKind::CordsDelivered:
+        return {"Cords Delivered", {"orders", "households"},
+                byMonthAndGroup(completedOrders, "COUNT(*), COALESCE(SUM(delivered_cords), 0)"),
+                {{"Month"}, {"Region"}, {"Deliveries", ReportColumn::Kind::Integer},
+                 {"Cords", ReportColumn::Kind::Decimal, 2}}};
+    case ReportSectionKind::VolunteerHours:
+        return {"Volunteer Hours", {"volunteer_hours", "households"},
+                byMonthAndGroup("SELECT strftime('%Y-%m', v.day) AS month, COALESCE(h.region, 'Unknown') AS grp, "
+                                "v.household_id, v.hours "
+                                "FROM volunteer_hours v LEFT JOIN households h ON h.id = v.household_id "
+                                "WHERE v.day >= :first_day AND v.day < :end_day",
+                                "COUNT(DISTINCT household_id), COALESCE(SUM(hours), 0)"),
+                {{"Month"}, {"Region"}, {"Volunteers", ReportColumn::Kind::Integer},
+                 {"Hours", ReportColumn::Kind::Decimal, 1}}};
+    case ReportSectionKind::MilesDriven:
+        return {"Miles Driven", {"delivery_log", "orders", "households"},
+                byMonthAndGroup("SELECT strftime('%Y-%m', d.delivery_day) AS month, COALESCE(h.region, 'Unknown') AS grp, "
+                                "d.total_miles, d.delivered_cords "
+                                "FROM delivery_log d "
+                                "LEFT JOIN orders o ON o.id = d.order_id "
+                                "LEFT JOIN households h ON h.id = o.household_id "
+                                "WHERE d.delivery_day >= :first_day AND d.delivery_day < :end_day",
+                                "COUNT(*), COALESCE(SUM(total_miles), 0), COALESCE(SUM(delivered_cords), 0)"),
+                {{"Month"}, {"Region"}, {"Trips", ReportColumn::Kind::Integer},
+                 {"Miles", ReportColumn::Kind::Decimal, 1}, {"Cords", ReportColumn::Kind::Decimal, 2}}};
+    case ReportSectionKind::FundsBySource:
+    default:
+        return {"Funds by Source", {"income"},
+                byMonthAndGroup("SELECT strftime('%Y-%m', day) AS month, source AS grp, amount_cents "
+                                "FROM income WHERE day >= :first_day AND day < :end_day",
+                                "COUNT(*), COALESCE(SUM(amount_cents), 0)"),
+                {{"Month"}, {"Source"}, {"Entries", ReportColumn::Kind::Integer},
+                 {"Amount", ReportColumn::Kind::Money}}};
+    }
+}
+
+QString cacheKey(ReportSectionKind kind, const core::DateRange &period) {
+    return QString("%1:%2:%3").arg(static_cast<int>(kind)).arg(period.firstDay()).arg(period.endDay());
+}
+
+// Empty if any version could not be read, which disables caching for the section
+QString versionKey(const QStringList &tables, const QHash<QString, qint64> &versions) {
+    QString key;
+    for (const QString &table : tables) {
+        const qint64 version = versions.value(table, -1);
+        if (version < 0) {
+            return QString();
+        }
+        key += QString("%1=%2;").arg(table).arg(version);
+    }
+    return key;
+}
+
+} // namespace
+
+QList<ReportSectionKind> allReportSections() {
+    return {ReportSectionKind::HouseholdsServed, ReportSectionKind::CordsDelivered,
+            ReportSectionKind::VolunteerHours, ReportSectionKind::MilesDriven,
+            ReportSectionKind::FundsBySource};
+}
+
+ReportEngine::ReportEngine(const QString &databasePath)
+    : m_databasePath(databasePath.isEmpty() ? QSqlDatabase::database().databaseName() : databasePath) {
+    // Threads never expire, so each keeps its connection for the engine's lifetime
+    m_pool.setExpiryTimeout(-1);
+    m_pool.setMaxThreadCount(std::max(1, std::min(QThread::idealThreadCount(),
+                                                  static_cast<int>(allReportSections().size()))));
+}
+
+ReportEngine::~ReportEngine() {
+    m_pool.waitForDone();
+
+    QMutexLocker locker(&m_connectionsMutex);
+    for (const QString &name : std::as_const(m_connectionNames)) {
+        QSqlDatabase::removeDatabase(name);
+    }
+}
+
+QSqlDatabase ReportEngine::threadConnection() {
+    // Qt connections may only be used by the thread that opened them
+    const QString name = QString("firewood_report_%1_%2")
+        .arg(reinterpret_cast<quintptr>(this), 0, 16)
+        .arg(reinterpret_cast<quintptr>(QThread::currentThread()), 0, 16);
+    if (QSqlDatabase::contains(name)) {
+        return QSqlDatabase::database(name);
+    }
+
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", name);
+    db.setDatabaseName(m_databasePath);
+    db.setConnectOptions("QSQLITE_OPEN_READONLY;QSQLITE_BUSY_TIMEOUT=5000");
+    if (!db.open()) {
+        qDebug() << "ERROR: Failed to open report connection:" << db.lastError().text();
+    }
+
+    QMutexLocker locker(&m_connectionsMutex);
+    m_connectionNames << name;
+    return db;
+}
+
+QHash<QString, qint64> ReportEngine::readVersions() {
+    QHash<QString, qint64> versions;
+    QSqlDatabase db = threadConnection();
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    if (!query.exec("SELECT table_name, version FROM data_versions")) {
+        qDebug() << "ERROR: Failed to read data versions:" << query.lastError().text();
+        return versions;
+    }
+    while (query.next()) {
+        versions.insert(query.value(0).toString(), query.value(1).toLongLong());
+    }
+    return versions;
+}
+
+core::ReportSection ReportEngine::runSection(ReportSectionKind kind, const core::DateRange &period) {
+    const SectionSpec spec = sectionSpec(kind);
+    core::ReportSection section;
+    section.title = spec.title;
+    section.columns = spec.columns;
+
+    QSqlDatabase db = threadConnection();
+    if (!db.isOpen()) {
+        section.error = "Could not open the database";
+        return section;
+    }
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.prepare(spec.sql);
+    query.bindValue(":first_day", period.firstDay());
+    query.bindValue(":end_day", period.endDay());
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to build report section" << spec.title << ":" << query.lastError().text();
+        section.error = query.lastError().text();
+        return section;
+    }
+
+    const int columns = spec.columns.size();
+    while (query.next()) {
+        QVariantList row;
+        row.reserve(columns);
+        for (int column = 0; column < columns; ++column) {
+            row << query.value(column);
+        }
+        section.rows << row;
+    }
+    return section;
+}
+
+core::Report ReportEngine::build(const QString &title, const core::DateRange &period,
+                                 const QList<ReportSectionKind> &sections) {
+    core::Report report(title, period);
+    if (!period.isValid()) {
+        return report;
+    }
+
+    const QHash<QString, qint64> versions = readVersions();
+
+    QList<core::ReportSection> results(sections.size());
+    QList<QString> versionKeys(sections.size());
+    QList<int> pending;
+    QList<QFuture<core::ReportSection>> futures;
+
+    for (int i = 0; i < sections.size(); ++i) {
+        const ReportSectionKind kind = sections[i];
+        versionKeys[i] = versionKey(sectionSpec(kind).tables, versions);
+
+        const auto cached = m_cache.constFind(cacheKey(kind, period));
+        if (!versionKeys[i].isEmpty() && cached != m_cache.constEnd() && cached->versions == versionKeys[i]) {
+            results[i] = cached->section;
+            continue;
+        }
+        pending << i;
+        futures << QtConcurrent::run(&m_pool, [this, kind, period]() {
+            return runSection(kind, period);
+        });
+    }
+
+    for (int n = 0; n < pending.size(); ++n) {
+        const int i = pending[n];
+        results[i] = futures[n].result();
+        const QString key = cacheKey(sections[i], period);
+        if (results[i].isValid() && !versionKeys[i].isEmpty()) {
+            m_cache.insert(key, {versionKeys[i], results[i]});
+        } else {
+            m_cache.remove(key);
+        }
+    }
+
+    for (const core::ReportSection &section : std::as_const(results)) {
+        report.addSection(section);
+    }
+    return report;
+}
+
+} // namespace firewood::db
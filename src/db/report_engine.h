@@ -0,0 +1,82 @@
+#pragma once
+
+#include "DateRange.h"
+#include "Report.h"
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QThreadPool>
+
+namespace firewood::db {
+
+/**
+ * @brief Independent sections of the grant and annual reports
+ */
+enum class ReportSectionKind {
+    HouseholdsServed,   // Households with a completed order, by month and region
+    CordsDelivered,     // Cords on completed orders, by month and region
+    VolunteerHours,     // Volunteers and hours, by month and region
+    MilesDriven,        // Delivery trips, miles and cords from the delivery log, by month and region
+    FundsBySource       // Income by month and source
+};
+
+QList<ReportSectionKind> allReportSections();
+
+/**
+ * @brief Builds reports by running their sections in parallel
+ *
+ * Each section is one aggregate statement over a day-number index, grouped by
+ * month and region (the ZIP code ending the household address) or income
+ * source, with a total row per region or source. Sections run on the engine's
+ * own thread pool; every pool thread reads through its own read-only connection
+ * to the database file, opened on first use and closed with the engine.
+ *
+ * Finished sections are cached by kind and period together with the data
+ * versions of the tables they read, so building the report again, or building
+ * another report over the same period, only reruns sections whose tables have
+ * changed. The cache is only touched by the thread calling build().
+ */
+class ReportEngine {
+public:
+    /**
+     * @param databasePath SQLite file to read; the default connection's file if empty
+     */
+    explicit ReportEngine(const QString &databasePath = QString());
+    ~ReportEngine();
+
+    ReportEngine(const ReportEngine &) = delete;
+    ReportEngine &operator=(const ReportEngine &) = delete;
+
+    /**
+     * @brief Builds a report, returning once every section has finished
+     *
+     * A section whose query fails is returned with its error and not cached.
+     */
+    core::Report build(const QString &title, const core::DateRange &period,
+                       const QList<ReportSectionKind> &sections = allReportSections());
+
+    void clearCache() { m_cache.clear(); }
+
+private:
+    struct CachedSection {
+        QString versions;               // "<table>=<version>;..." when it was built
+        core::ReportSection section;
+    };
+
+    core::ReportSection runSection(ReportSectionKind kind, const core::DateRange &period);
+    QSqlDatabase threadConnection();
+    QHash<QString, qint64> readVersions();
+
+    QString m_databasePath;
+    QThreadPool m_pool;
+
+    QMutex m_connectionsMutex;
+    QStringList m_connectionNames;
+
+    QHash<QString, CachedSection> m_cache; // "<kind>:<first day>:<end day>"
+};
+
+} // namespace firewood::db
@@ -0,0 +1,228 @@
+#include "shift_signup.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+
+namespace firewood::db {
+
+namespace {
+
+const QString ConfirmedStatus = "Confirmed";
+const QString WaitlistedStatus = "Waitlisted";
+
+// BEGIN IMMEDIATE takes the write lock before anything is read, so two
+// connections can never both see the same free slot. Rolls back unless committed.
+class ImmediateTransaction {
+public:
+    explicit ImmediateTransaction(QSqlDatabase &db) : m_db(db) {
+        QSqlQuery query(m_db);
+        m_active = query.exec("BEGIN IMMEDIATE");
+        if (!m_active) {
+            m_error = query.lastError().text();
+        }
+    }
+
+    ~ImmediateTransaction() {
+        if (m_active) {
+            QSqlQuery(m_db).exec("ROLLBACK");
+        }
+    }
+
+    ImmediateTransaction(const ImmediateTransaction &) = delete;
+    ImmediateTransaction &operator=(const ImmediateTransaction &) = delete;
+
+    bool isActive() const { return m_active; }
+    QString error() const { return m_error; }
+
+    bool commit() {
+        QSqlQuery query(m_db);
+        if (!query.exec("COMMIT")) {
+            m_error = query.lastError().text();
+            return false;
+        }
+        m_active = false;
+        return true;
+    }
+
+private:
+    QSqlDatabase &m_db;
+    bool m_active = false;
+    QString m_error;
+};
+
+SignupOutcome failed(const QString &what, const QString &error) {
+    qDebug() << "ERROR:" << what << error;
+    SignupOutcome outcome;
+    outcome.error = error;
+    return outcome;
+}
+
+// Position among the shift's waitlisted sign-ups, which queue in id order
+int waitlistPosition(QSqlDatabase &db, qint64 scheduleId, qint64 signupId) {
+    QSqlQuery query(db);
+    query.prepare("SELECT COUNT(*) FROM work_schedule_signups "
+                  "WHERE schedule_id = ? AND status = ? AND id <= ?");
+    query.addBindValue(scheduleId);
+    query.addBindValue(WaitlistedStatus);
+    query.addBindValue(signupId);
+    return query.exec() && query.next() ? query.value(0).toInt() : 0;
+}
+
+// Takes one slot if the shift has a free one
+bool takeSlot(QSqlQuery &query, qint64 scheduleId) {
+    query.prepare("UPDATE work_schedule SET slots_filled = COALESCE(slots_filled, 0) + 1, "
+                  "updated_at = CURRENT_TIMESTAMP "
+                  "WHERE id = ? AND COALESCE(slots_filled, 0) < COALESCE(volunteer_slots, 0)");
+    query.addBindValue(scheduleId);
+    return query.exec() && query.numRowsAffected() == 1;
+}
+
+} // namespace
+
+QStringList shiftSignupStatements() {
+    return {
+        "UPDATE work_schedule_signups SET status = 'Confirmed' WHERE status IS NULL OR status <> 'Waitlisted';",
+        "UPDATE work_schedule SET slots_filled = (SELECT COUNT(*) FROM work_schedule_signups s "
+        "WHERE s.schedule_id = work_schedule.id AND s.status = 'Confirmed');",
+        // Waitlist positions and the next household to promote; the UNIQUE
+        // (schedule_id, household_id) index already serves per-shift lookups
+        "CREATE INDEX IF NOT EXISTS idx_work_signups_schedule_status ON work_schedule_signups(schedule_id, status, id);",
+        "DROP INDEX IF EXISTS idx_work_signups_schedule;"
+    };
+}
+
+SignupOutcome signUpForShift(QSqlDatabase &db, qint64 scheduleId, qint64 householdId) {
+    ImmediateTransaction transaction(db);
+    if (!transaction.isActive()) {
+        return failed("Failed to start sign-up transaction:", transaction.error());
+    }
+
+    SignupOutcome outcome;
+    QSqlQuery query(db);
+
+    // A second click (or a second screen) must not take another slot or queue twice
+    query.prepare("SELECT id, status FROM work_schedule_signups WHERE schedule_id = ? AND household_id = ?");
+    query.addBindValue(scheduleId);
+    query.addBindValue(householdId);
+    if (!query.exec()) {
+        return failed("Failed to check sign-up:", query.lastError().text());
+    }
+    if (query.next()) {
+        const qint64 signupId = query.value(0).toLongLong();
+        const bool waitlisted = query.value(1).toString() == WaitlistedStatus;
+        query.finish();
+        outcome.result = SignupResult::AlreadySignedUp;
+        outcome.waitlistPosition = waitlisted ? waitlistPosition(db, scheduleId, signupId) : 0;
+        return outcome;
+    }
+    query.finish();
+
+    const bool confirmed = takeSlot(query, scheduleId);
+    if (query.lastError().isValid()) {
+        return failed("Failed to take a slot:", query.lastError().text());
+    }
+    if (!confirmed) {
+        query.prepare("SELECT 1 FROM work_schedule WHERE id = ?");
+        query.addBindValue(scheduleId);
+        if (!query.exec()) {
+            return failed("Failed to find shift:", query.lastError().text());
+        }
+        if (!query.next()) {
+            outcome.result = SignupResult::ShiftNotFound;
+            return outcome;
+        }
+        query.finish();
+    }
+
+    query.prepare("INSERT INTO work_schedule_signups (schedule_id, household_id, status) VALUES (?, ?, ?)");
+    query.addBindValue(scheduleId);
+    query.addBindValue(householdId);
+    query.addBindValue(confirmed ? ConfirmedStatus : WaitlistedStatus);
+    if (!query.exec()) {
+        return failed("Failed to record sign-up:", query.lastError().text());
+    }
+
+    outcome.result = confirmed ? SignupResult::Confirmed : SignupResult::Waitlisted;
+    if (!confirmed) {
+        outcome.waitlistPosition = waitlistPosition(db, scheduleId, query.lastInsertId().toLongLong());
+    }
+
+    if (!transaction.commit()) {
+        return failed("Failed to commit sign-up:", transaction.error());
+    }
+    return outcome;
+}
+
+SignupOutcome cancelShiftSignup(QSqlDatabase &db, qint64 scheduleId, qint64 householdId) {
+    ImmediateTransaction transaction(db);
+    if (!transaction.isActive()) {
+        return failed("Failed to start cancellation transaction:", transaction.error());
+    }
+
+    SignupOutcome outcome;
+    QSqlQuery query(db);
+
+    query.prepare("SELECT id, status FROM work_schedule_signups WHERE schedule_id = ? AND household_id = ?");
+    query.addBindValue(scheduleId);
+    query.addBindValue(householdId);
+    if (!query.exec()) {
+        return failed("Failed to check sign-up:", query.lastError().text());
+    }
+    if (!query.next()) {
+        outcome.result = SignupResult::NotSignedUp;
+        return outcome;
+    }
+    const qint64 signupId = query.value(0).toLongLong();
+    const bool wasConfirmed = query.value(1).toString() != WaitlistedStatus;
+    query.finish();
+
+    query.prepare("DELETE FROM work_schedule_signups WHERE id = ?");
+    query.addBindValue(signupId);
+    if (!query.exec()) {
+        return failed("Failed to cancel sign-up:", query.lastError().text());
+    }
+
+    if (wasConfirmed) {
+        query.prepare("UPDATE work_schedule SET slots_filled = MAX(COALESCE(slots_filled, 0) - 1, 0), "
+                      "updated_at = CURRENT_TIMESTAMP WHERE id = ?");
+        query.addBindValue(scheduleId);
+        if (!query.exec()) {
+            return failed("Failed to free slot:", query.lastError().text());
+        }
+
+        // The freed slot goes to the longest waiting household, unless the shift
+        // was cut below its sign-ups and is still full
+        query.prepare("SELECT id, household_id FROM work_schedule_signups "
+                      "WHERE schedule_id = ? AND status = ? ORDER BY id LIMIT 1");
+        query.addBindValue(scheduleId);
+        query.addBindValue(WaitlistedStatus);
+        if (!query.exec()) {
+            return failed("Failed to read waitlist:", query.lastError().text());
+        }
+        if (query.next()) {
+            const qint64 nextId = query.value(0).toLongLong();
+            const qint64 nextHouseholdId = query.value(1).toLongLong();
+            query.finish();
+
+            if (takeSlot(query, scheduleId)) {
+                query.prepare("UPDATE work_schedule_signups SET status = ? WHERE id = ?");
+                query.addBindValue(ConfirmedStatus);
+                query.addBindValue(nextId);
+                if (!query.exec()) {
+                    return failed("Failed to promote waitlisted sign-up:", query.lastError().text());
+                }
+                outcome.promotedHouseholdId = nextHouseholdId;
+            } else if (query.lastError().isValid()) {
+                return failed("Failed to take a slot:", query.lastError().text());
+            }
+        }
+    }
+
+    if (!transaction.commit()) {
+        return failed("Failed to commit cancellation:", transaction.error());
+    }
+    outcome.result = SignupResult::Cancelled;
+    return outcome;
+}
+
+} // namespace firewood::db
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+
+namespace firewood::db {
+
+/**
+ * @brief What a sign-up or cancellation did
+ */
+enum class SignupResult {
+    Confirmed,          // Took a free slot
+    Waitlisted,         // The shift was full; queued in sign-up order
+    AlreadySignedUp,    // Already confirmed or waitlisted for the shift
+    Cancelled,          // Removed; a confirmed slot went to the first waitlisted household
+    NotSignedUp,        // Nothing to cancel
+    ShiftNotFound,
+    Failed              // Database error, including a lock held past the busy timeout
+};
+
+struct SignupOutcome {
+    SignupResult result = SignupResult::Failed;
+    int waitlistPosition = 0;       // 1-based, for Waitlisted and AlreadySignedUp on the waitlist
+    qint64 promotedHouseholdId = 0; // Cancelled: the household moved off the waitlist, if any
+    QString error;
+};
+
+/**
+ * @brief Statements adding the waitlist to existing sign-ups
+ *
+ * work_schedule_signups.status is 'Confirmed' or 'Waitlisted';
+ * work_schedule.slots_filled counts the confirmed rows and is recomputed here
+ * to repair counts left by the old unchecked increments. Does not start a
+ * transaction.
+ */
+QStringList shiftSignupStatements();
+
+/**
+ * @brief Signs a household up for a shift, or waitlists it when the shift is full
+ *
+ * Runs in one BEGIN IMMEDIATE transaction, so sign-ups from other connections
+ * and processes (a kiosk and the office sharing the file) are serialized: the
+ * slot is taken by a single UPDATE that only matches while
+ * slots_filled < volunteer_slots, and the sign-up row is inserted with it.
+ * Must not be called inside another transaction on the same connection.
+ */
+SignupOutcome signUpForShift(QSqlDatabase &db, qint64 scheduleId, qint64 householdId);
+
+/**
+ * @brief Cancels a household's sign-up or waitlist place
+ *
+ * A freed confirmed slot goes to the first waitlisted household in the same
+ * transaction; slots_filled only drops when nobody is waiting.
+ */
+SignupOutcome cancelShiftSignup(QSqlDatabase &db, qint64 scheduleId, qint64 householdId);
+
+} // namespace firewood::db
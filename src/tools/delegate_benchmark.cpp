@@ -0,0 +1,221 @@
+/*
+ * Table paint benchmark
+ *
+ * Loads the orders and clients tables into the same QSqlTableModel views the
+ * main window uses, then scrolls each one a few rows per frame and times a
+ * full repaint of the viewport at every step: once with the default delegate
+ * on every column and once with the status, priority, money and yes/no
+ * delegates the main window installs. A frame has 16.7 ms at 60 fps.
+ *
+ * Runs on the offscreen platform unless QT_QPA_PLATFORM is set.
+ *
+ *   delegate_benchmark                        # generated database, 10000 orders
+ *   delegate_benchmark --frames 600
+ *   delegate_benchmark --database firewood_bank.sqlite
+ */
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QTemporaryDir>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlTableModel>
+#include <QTableView>
+#include <QScrollBar>
+#include <QHeaderView>
+#include <QTextStream>
+#include <QElapsedTimer>
+#include <QPixmap>
+#include <algorithm>
+#include <functional>
+#include "database.h"
+#include "query_plan.h"
+#include "StyleSheet.h"
+#include "ItemDelegates.h"
+
+static bool s_verbose = false;
+
+static void messageHandler(QtMsgType type, const QMessageLogContext &, const QString &message) {
+    if (s_verbose || type >= QtWarningMsg) {
+        QTextStream(stderr) << message << Qt::endl;
+    }
+}
+
+static double percentile(QList<double> values, double fraction) {
+    if (values.isEmpty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    const int index = std::min<int>(values.size() - 1, static_cast<int>(values.size() * fraction));
+    return values[index];
+}
+
+struct Subject {
+    QString name;
+    QString table;
+    QString filter;
+    QList<int> hiddenColumns;
+    std::function<void(QTableView *, const QSqlTableModel &)> installDelegates;
+};
+
+// Milliseconds for each full viewport repaint while scrolling top to bottom
+static QList<double> scrollFrames(QTableView *view, int frames, int rowsPerFrame) {
+    QList<double> times;
+    QPixmap target(view->viewport()->size());
+    QScrollBar *scrollBar = view->verticalScrollBar();
+    QElapsedTimer timer;
+
+    for (int frame = 0; frame < frames; ++frame) {
+        const int range = std::max(1, scrollBar->maximum() + 1);
+        scrollBar->setValue((frame * rowsPerFrame) % range);
+        QCoreApplication::processEvents();
+
+        timer.start();
+        view->viewport()->render(&target);
+        times << timer.nsecsElapsed() / 1e6;
+    }
+    return times;
+}
+
+int main(int argc, char *argv[]) {
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    app.setApplicationName("delegate_benchmark");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Times repainting the orders and clients tables while scrolling.");
+    parser.addHelpOption();
+    QCommandLineOption databaseOption("database", "Use an existing database instead of a generated one.", "path");
+    QCommandLineOption householdsOption("households", "Households to generate, five orders each (default 2000).", "count", "2000");
+    QCommandLineOption framesOption("frames", "Frames to paint per table (default 300).", "count", "300");
+    QCommandLineOption rowsOption("rows-per-frame", "Rows scrolled between frames (default 3).", "count", "3");
+    QCommandLineOption noStyleOption("no-app-style", "Do not install the application stylesheet.");
+    QCommandLineOption verboseOption("verbose", "Show migration and generator output.");
+    parser.addOptions({databaseOption, householdsOption, framesOption, rowsOption, noStyleOption, verboseOption});
+    parser.process(app);
+
+    s_verbose = parser.isSet(verboseOption);
+    qInstallMessageHandler(messageHandler);
+
+    QTextStream out(stdout);
+
+    bool ok = false;
+    const int frames = parser.value(framesOption).toInt(&ok);
+    if (!ok || frames <= 0) {
+        out << "Invalid --frames value" << Qt::endl;
+        return 2;
+    }
+    const int rowsPerFrame = parser.value(rowsOption).toInt(&ok);
+    if (!ok || rowsPerFrame <= 0) {
+        out << "Invalid --rows-per-frame value" << Qt::endl;
+        return 2;
+    }
+
+    QTemporaryDir tempDir;
+    QString dbPath = parser.value(databaseOption);
+    const bool generate = dbPath.isEmpty();
+    if (generate) {
+        if (!tempDir.isValid()) {
+            out << "Could not create a temporary directory" << Qt::endl;
+            return 2;
+        }
+        dbPath = tempDir.filePath("delegate_benchmark.sqlite");
+    }
+
+    QSqlDatabase db = firewood::db::openConnection(dbPath);
+    if (!db.isOpen()) {
+        out << "Could not open database: " << dbPath << Qt::endl;
+        return 2;
+    }
+
+    if (generate) {
+        const int households = parser.value(householdsOption).toInt(&ok);
+        if (!ok || households <= 0) {
+            out << "Invalid --households value" << Qt::endl;
+            return 2;
+        }
+        if (!firewood::db::generateLoadTestData(db, households)) {
+            out << "Could not generate test data" << Qt::endl;
+            return 2;
+        }
+    }
+
+    if (!parser.isSet(noStyleOption)) {
+        app.setStyleSheet(AdobeStyles::applicationStyleSheet());
+    }
+
+    // Columns and delegates as MainWindow::buildOrdersTab and buildClientsTab set them
+    const QList<Subject> subjects = {
+        {"orders", "orders", QString(),
+         {0, 8, 9, 13, 14, 15, 16, 17, 18, 19, 20},
+         [](QTableView *view, const QSqlTableModel &) {
+             view->setItemDelegateForColumn(5, new StatusBadgeDelegate(view));
+             view->setItemDelegateForColumn(6, new PriorityDelegate(view));
+             view->setItemDelegateForColumn(12, new MoneyDelegate(MoneyDelegate::Unit::Dollars, view));
+         }},
+        {"clients", "users", "user_type IN ('client', 'volunteer')",
+         {0, 1, 3, 8, 9, 10, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 24, 25},
+         [](QTableView *view, const QSqlTableModel &model) {
+             view->setItemDelegateForColumn(model.fieldIndex("is_volunteer"), new YesNoDelegate(view));
+         }}
+    };
+
+    out << QString("%1 %2 %3 %4 %5 %6")
+               .arg("table", -10).arg("delegates", -10).arg("rows", 8)
+               .arg("median ms", 11).arg("p95 ms", 9).arg("median fps", 12)
+        << Qt::endl;
+
+    for (const Subject &subject : subjects) {
+        for (const bool delegates : {false, true}) {
+            QSqlTableModel model(nullptr, db);
+            model.setTable(subject.table);
+            model.setFilter(subject.filter);
+            if (!model.select()) {
+                out << "Could not load " << subject.table << Qt::endl;
+                return 2;
+            }
+            while (model.canFetchMore()) {
+                model.fetchMore();
+            }
+
+            QTableView view;
+            view.setModel(&model);
+            view.setSelectionBehavior(QAbstractItemView::SelectRows);
+            view.setAlternatingRowColors(true);
+            view.setEditTriggers(QAbstractItemView::NoEditTriggers);
+            for (const int column : subject.hiddenColumns) {
+                view.hideColumn(column);
+            }
+            if (delegates) {
+                subject.installDelegates(&view, model);
+            }
+            view.resize(1280, 800);
+            view.show();
+            view.selectRow(0);
+            QCoreApplication::processEvents();
+
+            // First pass warms font and glyph caches and is not counted
+            scrollFrames(&view, std::min(frames, 30), rowsPerFrame);
+            const QList<double> times = scrollFrames(&view, frames, rowsPerFrame);
+
+            const double median = percentile(times, 0.5);
+            out << QString("%1 %2 %3 %4 %5 %6")
+                       .arg(subject.name, -10)
+                       .arg(delegates ? "yes" : "no", -10)
+                       .arg(model.rowCount(), 8)
+                       .arg(median, 11, 'f', 2)
+                       .arg(percentile(times, 0.95), 9, 'f', 2)
+                       .arg(median > 0 ? 1000.0 / median : 0.0, 12, 'f', 0)
+                << Qt::endl;
+        }
+    }
+    out << Qt::endl << frames << " frames per run, " << rowsPerFrame << " rows scrolled per frame" << Qt::endl;
+
+    db.close();
+    db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(QLatin1String(QSqlDatabase::defaultConnection));
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Index advisor
+ *
+ * Runs EXPLAIN QUERY PLAN for every hot query (see query_plan.cpp) and reports
+ * full table scans and temporary B-trees. By default it builds a throwaway
+ * database with the current migrations and a few hundred thousand generated
+ * rows so the planner sees realistic statistics.
+ *
+ * It also recomputes the trigger-maintained client counters (see counters.cpp)
+ * and reports any that are out of date; --repair rewrites them from the source
+ * tables and checks them again.
+ *
+ * Exits with status 1 if any hot query regressed or a counter is stale, so it
+ * can gate a build:
+ *
+ *   index_advisor                         # generated database, 20000 households
+ *   index_advisor --households 50000
+ *   index_advisor --database firewood_bank.sqlite
+ *   index_advisor --database firewood_bank.sqlite --repair
+ */
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTemporaryDir>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QTextStream>
+#include <QElapsedTimer>
+#include "database.h"
+#include "query_plan.h"
+#include "counters.h"
+
+static bool s_verbose = false;
+
+static void messageHandler(QtMsgType type, const QMessageLogContext &, const QString &message) {
+    // Migrations log every step; only show that when asked
+    if (s_verbose || type >= QtWarningMsg) {
+        QTextStream(stderr) << message << Qt::endl;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("index_advisor");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Checks the query plans of Firewood Bank's hot queries.");
+    parser.addHelpOption();
+    QCommandLineOption databaseOption("database", "Check an existing database instead of a generated one.", "path");
+    QCommandLineOption householdsOption("households", "Households to generate (default 20000).", "count", "20000");
+    QCommandLineOption keepOption("keep", "Keep the generated database and print its path.");
+    QCommandLineOption verboseOption("verbose", "Show migration and generator output.");
+    QCommandLineOption repairOption("repair", "Rebuild stale client counters from the source tables.");
+    parser.addOptions({databaseOption, householdsOption, keepOption, verboseOption, repairOption});
+    parser.process(app);
+
+    s_verbose = parser.isSet(verboseOption);
+    qInstallMessageHandler(messageHandler);
+
+    QTextStream out(stdout);
+
+    QTemporaryDir tempDir;
+    tempDir.setAutoRemove(!parser.isSet(keepOption));
+
+    QString dbPath = parser.value(databaseOption);
+    const bool generate = dbPath.isEmpty();
+    if (generate) {
+        if (!tempDir.isValid()) {
+            out << "Could not create a temporary directory" << Qt::endl;
+            return 2;
+        }
+        dbPath = tempDir.filePath("index_advisor.sqlite");
+    }
+
+    QSqlDatabase db = firewood::db::openConnection(dbPath, "index_advisor");
+    if (!db.isOpen()) {
+        out << "Could not open database: " << dbPath << Qt::endl;
+        return 2;
+    }
+
+    if (generate) {
+        bool ok = false;
+        const int households = parser.value(householdsOption).toInt(&ok);
+        if (!ok || households <= 0) {
+            out << "Invalid --households value" << Qt::endl;
+            return 2;
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        if (!firewood::db::generateLoadTestData(db, households)) {
+            out << "Could not generate test data" << Qt::endl;
+            return 2;
+        }
+        QSqlQuery analyze(db);
+        analyze.exec("ANALYZE;");
+        out << "Generated " << households << " households in " << timer.elapsed() << " ms" << Qt::endl;
+        if (parser.isSet(keepOption)) {
+            out << "Database kept at " << dbPath << Qt::endl;
+        }
+    }
+    out << Qt::endl;
+
+    const QList<firewood::db::QueryPlanReport> reports = firewood::db::checkHotQueries(db);
+    int failures = 0;
+
+    for (const firewood::db::QueryPlanReport &report : reports) {
+        out << (report.ok() ? "ok    " : "FAIL  ") << report.name << Qt::endl;
+        for (const QString &line : report.planLines) {
+            out << "        " << line << Qt::endl;
+        }
+        if (!report.error.isEmpty()) {
+            out << "        error: " << report.error << Qt::endl;
+        }
+        for (const QString &problem : report.problems) {
+            out << "        !! " << problem << Qt::endl;
+        }
+        if (!report.ok()) {
+            failures++;
+        }
+    }
+
+    out << Qt::endl << reports.size() << " hot queries, " << failures << " with scans or temp B-trees" << Qt::endl;
+
+    QList<firewood::db::CounterMismatch> mismatches = firewood::db::verifyClientCounters(db);
+    for (const firewood::db::CounterMismatch &mismatch : mismatches.mid(0, 20)) {
+        out << "STALE " << mismatch.table << " " << mismatch.id << " " << mismatch.column
+            << ": stored " << mismatch.stored.toString() << ", expected " << mismatch.expected.toString() << Qt::endl;
+    }
+    out << mismatches.size() << " stale client counters" << Qt::endl;
+
+    if (!mismatches.isEmpty() && parser.isSet(repairOption)) {
+        if (!firewood::db::rebuildClientCounters(db)) {
+            out << "Could not rebuild client counters" << Qt::endl;
+        } else {
+            mismatches = firewood::db::verifyClientCounters(db);
+            out << "Rebuilt client counters, " << mismatches.size() << " still stale" << Qt::endl;
+        }
+    }
+    if (!mismatches.isEmpty()) {
+        failures++;
+    }
+
+    db.close();
+    db = QSqlDatabase();
+    QSqlDatabase::removeDatabase("index_advisor");
+
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+/*
+ * UI construction benchmark
+ *
+ * Builds the dashboard, the bookkeeping page and the common dialogs over and
+ * over against a generated database and reports how long each takes to
+ * construct and polish, and to paint the first frame. The application
+ * stylesheet is installed once up front, exactly as main() does.
+ *
+ * Runs on the offscreen platform unless QT_QPA_PLATFORM is set. To compare
+ * with another revision, build this file there and run both with the same
+ * arguments; --no-app-style shows what the widgets cost without any theme.
+ *
+ *   ui_benchmark                          # generated database, 2000 households
+ *   ui_benchmark --iterations 50
+ *   ui_benchmark --database firewood_bank.sqlite
+ */
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QTemporaryDir>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QTextStream>
+#include <QElapsedTimer>
+#include <QPixmap>
+#include <algorithm>
+#include <functional>
+#include "database.h"
+#include "query_plan.h"
+#include "StyleSheet.h"
+#include "DashboardWidget.h"
+#include "BookkeepingWidget.h"
+#include "ExpenseDialog.h"
+#include "IncomeDialog.h"
+#include "ClientDialog.h"
+#include "WorkOrderDialog.h"
+#include "DeliveryLogDialog.h"
+
+static bool s_verbose = false;
+
+static void messageHandler(QtMsgType type, const QMessageLogContext &, const QString &message) {
+    // The widgets log every query they run; only show that when asked
+    if (s_verbose || type >= QtWarningMsg) {
+        QTextStream(stderr) << message << Qt::endl;
+    }
+}
+
+struct Sample {
+    double constructMs = 0;
+    double paintMs = 0;
+};
+
+static double median(QList<double> values) {
+    if (values.isEmpty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+// Construct + polish, then the first paint, for one widget
+static Sample measure(const std::function<QWidget *()> &create) {
+    Sample sample;
+    QElapsedTimer timer;
+
+    timer.start();
+    QWidget *widget = create();
+    widget->ensurePolished();
+    sample.constructMs = timer.nsecsElapsed() / 1e6;
+
+    timer.restart();
+    widget->grab();
+    sample.paintMs = timer.nsecsElapsed() / 1e6;
+
+    delete widget;
+    QCoreApplication::processEvents();
+    return sample;
+}
+
+int main(int argc, char *argv[]) {
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    app.setApplicationName("ui_benchmark");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Times construction and first paint of Firewood Bank's main widgets.");
+    parser.addHelpOption();
+    QCommandLineOption databaseOption("database", "Use an existing database instead of a generated one.", "path");
+    QCommandLineOption householdsOption("households", "Households to generate (default 2000).", "count", "2000");
+    QCommandLineOption iterationsOption("iterations", "Times to build each widget (default 20).", "count", "20");
+    QCommandLineOption noStyleOption("no-app-style", "Do not install the application stylesheet.");
+    QCommandLineOption verboseOption("verbose", "Show migration, generator and widget output.");
+    parser.addOptions({databaseOption, householdsOption, iterationsOption, noStyleOption, verboseOption});
+    parser.process(app);
+
+    s_verbose = parser.isSet(verboseOption);
+    qInstallMessageHandler(messageHandler);
+
+    QTextStream out(stdout);
+
+    bool ok = false;
+    const int iterations = parser.value(iterationsOption).toInt(&ok);
+    if (!ok || iterations <= 0) {
+        out << "Invalid --iterations value" << Qt::endl;
+        return 2;
+    }
+
+    QTemporaryDir tempDir;
+    QString dbPath = parser.value(databaseOption);
+    const bool generate = dbPath.isEmpty();
+    if (generate) {
+        if (!tempDir.isValid()) {
+            out << "Could not create a temporary directory" << Qt::endl;
+            return 2;
+        }
+        dbPath = tempDir.filePath("ui_benchmark.sqlite");
+    }
+
+    // The widgets use the default connection
+    QSqlDatabase db = firewood::db::openConnection(dbPath);
+    if (!db.isOpen()) {
+        out << "Could not open database: " << dbPath << Qt::endl;
+        return 2;
+    }
+
+    if (generate) {
+        const int households = parser.value(householdsOption).toInt(&ok);
+        if (!ok || households <= 0) {
+            out << "Invalid --households value" << Qt::endl;
+            return 2;
+        }
+        if (!firewood::db::generateLoadTestData(db, households)) {
+            out << "Could not generate test data" << Qt::endl;
+            return 2;
+        }
+        QSqlQuery analyze(db);
+        analyze.exec("ANALYZE;");
+    }
+
+    QElapsedTimer styleTimer;
+    styleTimer.start();
+    if (!parser.isSet(noStyleOption)) {
+        app.setStyleSheet(AdobeStyles::applicationStyleSheet());
+    }
+    out << "Application stylesheet installed in " << styleTimer.nsecsElapsed() / 1e6 << " ms" << Qt::endl << Qt::endl;
+
+    UserInfo admin;
+    admin.username = "benchmark";
+    admin.fullName = "Benchmark Admin";
+    admin.role = "admin";
+
+    const QList<QPair<QString, std::function<QWidget *()>>> subjects = {
+        {"DashboardWidget", [&admin]() { return new DashboardWidget(admin); }},
+        {"BookkeepingWidget", []() { return new BookkeepingWidget("benchmark"); }},
+        {"ExpenseDialog", []() { return new ExpenseDialog(); }},
+        {"IncomeDialog", []() { return new IncomeDialog(); }},
+        {"ClientDialog", []() { return new ClientDialog(); }},
+        {"WorkOrderDialog", []() { return new WorkOrderDialog(); }},
+        {"DeliveryLogDialog", []() { return new DeliveryLogDialog(); }}
+    };
+
+    out << QString("%1 %2 %3 %4").arg("widget", -20).arg("construct ms", 14).arg("first paint ms", 16).arg("total ms", 10)
+        << Qt::endl;
+
+    for (const auto &subject : subjects) {
+        // First build warms caches (fonts, prepared queries) and is not counted
+        measure(subject.second);
+
+        QList<double> construct;
+        QList<double> paint;
+        QList<double> total;
+        for (int i = 0; i < iterations; ++i) {
+            const Sample sample = measure(subject.second);
+            construct << sample.constructMs;
+            paint << sample.paintMs;
+            total << sample.constructMs + sample.paintMs;
+        }
+
+        out << QString("%1 %2 %3 %4")
+                   .arg(subject.first, -20)
+                   .arg(median(construct), 14, 'f', 2)
+                   .arg(median(paint), 16, 'f', 2)
+                   .arg(median(total), 10, 'f', 2)
+            << Qt::endl;
+    }
+    out << Qt::endl << "Medians of " << iterations << " builds each" << Qt::endl;
+
+    db.close();
+    db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(QLatin1String(QSqlDatabase::defaultConnection));
+
+    return 0;
+}
@@ -1,7 +1,11 @@
 #include "BookkeepingWidget.h"
 #include "StyleSheet.h"
+#include "DateRange.h"
+#include "bookkeeping.h"
 #include "ExpenseDialog.h"
 #include "IncomeDialog.h"
+#include "LedgerTableModel.h"
+#include <QApplication>
 #include <QSqlDatabase>
 #include <QSqlQuery>
 #include <QSqlError>
@@ -14,6 +18,18 @@
 #include <QSplitter>
 #include <QGridLayout>
 
+namespace {
+
+// Rows of the breakdown view combo
+enum BreakdownView {
+    MonthlyAmountsView,
+    YearToDateView,
+    MonthOverMonthView,
+    BudgetVarianceView
+};
+
+} // namespace
+
 BookkeepingWidget::BookkeepingWidget(const QString &username, QWidget *parent)
     : QWidget(parent), m_username(username)
 {
@@ -24,25 +40,18 @@ BookkeepingWidget::BookkeepingWidget(const QString &username, QWidget *parent)
 
 void BookkeepingWidget::setupUI()
 {
-    setStyleSheet(AdobeStyles::MAIN_WINDOW);
-    
     auto *mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(15);
     mainLayout->setContentsMargins(20, 20, 20, 20);
     
     // Header with firewood theme
     auto *headerLabel = new QLabel(AdobeStyles::ICON_MONEY + " Financial Management", this);
-    headerLabel->setStyleSheet(
-        "font-size: 18pt; font-weight: bold; color: white; "
-        "padding: 15px; background: " + AdobeStyles::GRADIENT_PRIMARY + "; "
-        "border-radius: 10px; margin-bottom: 10px;"
-    );
+    AdobeStyles::setVariant(headerLabel, "banner");
     headerLabel->setAlignment(Qt::AlignCenter);
     mainLayout->addWidget(headerLabel);
     
     // Create tab widget
     m_tabs = new QTabWidget(this);
-    m_tabs->setStyleSheet(AdobeStyles::TAB_WIDGET);
     
     setupExpensesTab();
     setupIncomeTab();
@@ -55,10 +64,17 @@ void BookkeepingWidget::setupUI()
     buttonLayout->addStretch();
     
     m_exportBtn = new QPushButton("📊 Export Financial Report", this);
-    m_exportBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+    AdobeStyles::setVariant(m_exportBtn, "primary");
     m_exportBtn->setMinimumHeight(40);
     connect(m_exportBtn, &QPushButton::clicked, this, &BookkeepingWidget::exportFinancialReport);
+
+    m_grantReportBtn = new QPushButton("📑 Export Grant Report", this);
+    m_grantReportBtn->setToolTip("Households, cords, volunteer hours, miles and funds for the fiscal year "
+                                 "selected in the summary breakdown, by month and region");
+    m_grantReportBtn->setMinimumHeight(40);
+    connect(m_grantReportBtn, &QPushButton::clicked, this, &BookkeepingWidget::exportGrantReport);
     
+    buttonLayout->addWidget(m_grantReportBtn);
     buttonLayout->addWidget(m_exportBtn);
     mainLayout->addLayout(buttonLayout);
 }
@@ -88,9 +104,14 @@ void BookkeepingWidget::setupExpensesTab()
     m_expenseCategoryFilter->addItem("All Categories", "");
     filterLayout->addWidget(m_expenseCategoryFilter);
     
+    // Filtering only re-binds a prepared statement, so apply it as the dates change
+    connect(m_expenseFromDate, &QDateEdit::dateChanged, this, &BookkeepingWidget::filterExpenses);
+    connect(m_expenseToDate, &QDateEdit::dateChanged, this, &BookkeepingWidget::filterExpenses);
+    connect(m_expenseCategoryFilter, &QComboBox::currentIndexChanged, this, &BookkeepingWidget::filterExpenses);
+    
     auto *filterBtn = new QPushButton("🔍 Filter", filterGroup);
-    filterBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
-    connect(filterBtn, &QPushButton::clicked, this, &BookkeepingWidget::filterByDateRange);
+    AdobeStyles::setVariant(filterBtn, "primary");
+    connect(filterBtn, &QPushButton::clicked, this, &BookkeepingWidget::filterExpenses);
     filterLayout->addWidget(filterBtn);
     
     filterLayout->addStretch();
@@ -98,7 +119,6 @@ void BookkeepingWidget::setupExpensesTab()
     
     // Expenses table
     m_expensesView = new QTableView(m_expensesTab);
-    m_expensesView->setStyleSheet(AdobeStyles::TABLE_VIEW);
     m_expensesView->setAlternatingRowColors(true);
     m_expensesView->setSelectionBehavior(QAbstractItemView::SelectRows);
     m_expensesView->setSortingEnabled(true);
@@ -110,17 +130,17 @@ void BookkeepingWidget::setupExpensesTab()
     auto *expenseButtonLayout = new QHBoxLayout();
     
     m_addExpenseBtn = new QPushButton("➕ Add Expense", m_expensesTab);
-    m_addExpenseBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+    AdobeStyles::setVariant(m_addExpenseBtn, "primary");
     connect(m_addExpenseBtn, &QPushButton::clicked, this, &BookkeepingWidget::addExpense);
     expenseButtonLayout->addWidget(m_addExpenseBtn);
     
     m_editExpenseBtn = new QPushButton("✏️ Edit Expense", m_expensesTab);
-    m_editExpenseBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+    AdobeStyles::setVariant(m_editExpenseBtn, "primary");
     connect(m_editExpenseBtn, &QPushButton::clicked, this, &BookkeepingWidget::editExpense);
     expenseButtonLayout->addWidget(m_editExpenseBtn);
     
     m_deleteExpenseBtn = new QPushButton("🗑️ Delete Expense", m_expensesTab);
-    m_deleteExpenseBtn->setStyleSheet(AdobeStyles::CANCEL_BUTTON);
+    AdobeStyles::setVariant(m_deleteExpenseBtn, "cancel");
     connect(m_deleteExpenseBtn, &QPushButton::clicked, this, &BookkeepingWidget::deleteExpense);
     expenseButtonLayout->addWidget(m_deleteExpenseBtn);
     
@@ -154,10 +174,13 @@ void BookkeepingWidget::setupIncomeTab()
     m_incomeSourceFilter = new QComboBox(filterGroup);
     m_incomeSourceFilter->addItem("All Sources", "");
     filterLayout->addWidget(m_incomeSourceFilter);
+    connect(m_incomeFromDate, &QDateEdit::dateChanged, this, &BookkeepingWidget::filterIncome);
+    connect(m_incomeToDate, &QDateEdit::dateChanged, this, &BookkeepingWidget::filterIncome);
+    connect(m_incomeSourceFilter, &QComboBox::currentIndexChanged, this, &BookkeepingWidget::filterIncome);
     
     auto *filterBtn = new QPushButton("🔍 Filter", filterGroup);
-    filterBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
-    connect(filterBtn, &QPushButton::clicked, this, &BookkeepingWidget::filterByDateRange);
+    AdobeStyles::setVariant(filterBtn, "primary");
+    connect(filterBtn, &QPushButton::clicked, this, &BookkeepingWidget::filterIncome);
     filterLayout->addWidget(filterBtn);
     
     filterLayout->addStretch();
@@ -165,7 +188,6 @@ void BookkeepingWidget::setupIncomeTab()
     
     // Income table
     m_incomeView = new QTableView(m_incomeTab);
-    m_incomeView->setStyleSheet(AdobeStyles::TABLE_VIEW);
     m_incomeView->setAlternatingRowColors(true);
     m_incomeView->setSelectionBehavior(QAbstractItemView::SelectRows);
     m_incomeView->setSortingEnabled(true);
@@ -177,17 +199,17 @@ void BookkeepingWidget::setupIncomeTab()
     auto *incomeButtonLayout = new QHBoxLayout();
     
     m_addIncomeBtn = new QPushButton("➕ Add Income", m_incomeTab);
-    m_addIncomeBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+    AdobeStyles::setVariant(m_addIncomeBtn, "primary");
     connect(m_addIncomeBtn, &QPushButton::clicked, this, &BookkeepingWidget::addIncome);
     incomeButtonLayout->addWidget(m_addIncomeBtn);
     
     m_editIncomeBtn = new QPushButton("✏️ Edit Income", m_incomeTab);
-    m_editIncomeBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+    AdobeStyles::setVariant(m_editIncomeBtn, "primary");
     connect(m_editIncomeBtn, &QPushButton::clicked, this, &BookkeepingWidget::editIncome);
     incomeButtonLayout->addWidget(m_editIncomeBtn);
     
     m_deleteIncomeBtn = new QPushButton("🗑️ Delete Income", m_incomeTab);
-    m_deleteIncomeBtn->setStyleSheet(AdobeStyles::CANCEL_BUTTON);
+    AdobeStyles::setVariant(m_deleteIncomeBtn, "cancel");
     connect(m_deleteIncomeBtn, &QPushButton::clicked, this, &BookkeepingWidget::deleteIncome);
     incomeButtonLayout->addWidget(m_deleteIncomeBtn);
     
@@ -205,10 +227,8 @@ void BookkeepingWidget::setupSummaryTab()
     
     // Financial Summary Header
     auto *summaryHeader = new QLabel("📊 Financial Summary", m_summaryTab);
-    summaryHeader->setStyleSheet(
-        "font-size: 16pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + "; "
-        "padding: 10px; text-align: center;"
-    );
+    AdobeStyles::setVariant(summaryHeader, "subheader");
+    AdobeStyles::setTone(summaryHeader, "success");
     summaryHeader->setAlignment(Qt::AlignCenter);
     layout->addWidget(summaryHeader);
     
@@ -221,15 +241,18 @@ void BookkeepingWidget::setupSummaryTab()
     auto *totalLayout = new QGridLayout(totalGroup);
     
     m_totalIncomeLabel = new QLabel("$0.00", totalGroup);
-    m_totalIncomeLabel->setStyleSheet("font-size: 24pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + ";");
+    AdobeStyles::setVariant(m_totalIncomeLabel, "total");
+    AdobeStyles::setTone(m_totalIncomeLabel, "success");
     m_totalIncomeLabel->setAlignment(Qt::AlignCenter);
     
     m_totalExpensesLabel = new QLabel("$0.00", totalGroup);
-    m_totalExpensesLabel->setStyleSheet("font-size: 24pt; font-weight: bold; color: " + AdobeStyles::ERROR_RED + ";");
+    AdobeStyles::setVariant(m_totalExpensesLabel, "total");
+    AdobeStyles::setTone(m_totalExpensesLabel, "error");
     m_totalExpensesLabel->setAlignment(Qt::AlignCenter);
     
     m_netIncomeLabel = new QLabel("$0.00", totalGroup);
-    m_netIncomeLabel->setStyleSheet("font-size: 24pt; font-weight: bold; color: " + AdobeStyles::TEXT_PRIMARY + ";");
+    AdobeStyles::setVariant(m_netIncomeLabel, "total");
+    AdobeStyles::setTone(m_netIncomeLabel, "primary");
     m_netIncomeLabel->setAlignment(Qt::AlignCenter);
     
     totalLayout->addWidget(new QLabel("Total Income:"), 0, 0);
@@ -246,11 +269,13 @@ void BookkeepingWidget::setupSummaryTab()
     auto *monthlyLayout = new QGridLayout(monthlyGroup);
     
     m_monthlyIncomeLabel = new QLabel("$0.00", monthlyGroup);
-    m_monthlyIncomeLabel->setStyleSheet("font-size: 18pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + ";");
+    AdobeStyles::setVariant(m_monthlyIncomeLabel, "figure");
+    AdobeStyles::setTone(m_monthlyIncomeLabel, "success");
     m_monthlyIncomeLabel->setAlignment(Qt::AlignCenter);
     
     m_monthlyExpensesLabel = new QLabel("$0.00", monthlyGroup);
-    m_monthlyExpensesLabel->setStyleSheet("font-size: 18pt; font-weight: bold; color: " + AdobeStyles::ERROR_RED + ";");
+    AdobeStyles::setVariant(m_monthlyExpensesLabel, "figure");
+    AdobeStyles::setTone(m_monthlyExpensesLabel, "error");
     m_monthlyExpensesLabel->setAlignment(Qt::AlignCenter);
     
     monthlyLayout->addWidget(new QLabel("Income:"), 0, 0);
@@ -261,15 +286,17 @@ void BookkeepingWidget::setupSummaryTab()
     summaryGrid->addWidget(monthlyGroup, 1, 0);
     
     // Yearly Summary
-    auto *yearlyGroup = new QGroupBox("This Year", m_summaryTab);
+    auto *yearlyGroup = new QGroupBox("Fiscal Year to Date", m_summaryTab);
     auto *yearlyLayout = new QGridLayout(yearlyGroup);
     
     m_yearlyIncomeLabel = new QLabel("$0.00", yearlyGroup);
-    m_yearlyIncomeLabel->setStyleSheet("font-size: 18pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + ";");
+    AdobeStyles::setVariant(m_yearlyIncomeLabel, "figure");
+    AdobeStyles::setTone(m_yearlyIncomeLabel, "success");
     m_yearlyIncomeLabel->setAlignment(Qt::AlignCenter);
     
     m_yearlyExpensesLabel = new QLabel("$0.00", yearlyGroup);
-    m_yearlyExpensesLabel->setStyleSheet("font-size: 18pt; font-weight: bold; color: " + AdobeStyles::ERROR_RED + ";");
+    AdobeStyles::setVariant(m_yearlyExpensesLabel, "figure");
+    AdobeStyles::setTone(m_yearlyExpensesLabel, "error");
     m_yearlyExpensesLabel->setAlignment(Qt::AlignCenter);
     
     yearlyLayout->addWidget(new QLabel("Income:"), 0, 0);
@@ -280,7 +307,44 @@ void BookkeepingWidget::setupSummaryTab()
     summaryGrid->addWidget(yearlyGroup, 1, 1);
     
     layout->addLayout(summaryGrid);
-    layout->addStretch();
+    
+    // Category x month breakdown for a fiscal year
+    auto *breakdownGroup = new QGroupBox("Breakdown by Category", m_summaryTab);
+    auto *breakdownLayout = new QVBoxLayout(breakdownGroup);
+    auto *breakdownControls = new QHBoxLayout();
+    
+    m_fiscalYearCombo = new QComboBox(breakdownGroup);
+    const QDate currentStart = firewood::core::DateRange::fiscalYear(QDate::currentDate()).first();
+    for (int years = 0; years < 5; ++years) {
+        const QDate start = currentStart.addYears(-years);
+        m_fiscalYearCombo->addItem(QString("FY %1-%2").arg(start.year()).arg(start.year() + 1), start);
+    }
+    
+    m_breakdownViewCombo = new QComboBox(breakdownGroup);
+    m_breakdownViewCombo->addItem("Monthly amounts");
+    m_breakdownViewCombo->addItem("Year to date");
+    m_breakdownViewCombo->addItem("Change from previous month");
+    m_breakdownViewCombo->addItem("Budget variance");
+    
+    breakdownControls->addWidget(new QLabel("Fiscal year:"));
+    breakdownControls->addWidget(m_fiscalYearCombo);
+    breakdownControls->addSpacing(15);
+    breakdownControls->addWidget(new QLabel("Show:"));
+    breakdownControls->addWidget(m_breakdownViewCombo);
+    breakdownControls->addStretch();
+    breakdownLayout->addLayout(breakdownControls);
+    
+    m_breakdownTable = new QTableWidget(breakdownGroup);
+    m_breakdownTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_breakdownTable->setSelectionMode(QAbstractItemView::NoSelection);
+    m_breakdownTable->verticalHeader()->setVisible(false);
+    breakdownLayout->addWidget(m_breakdownTable);
+    
+    layout->addWidget(breakdownGroup, 1);
+    
+    // A different year needs its rows loaded; a different view only re-renders
+    connect(m_fiscalYearCombo, &QComboBox::currentIndexChanged, this, &BookkeepingWidget::loadBreakdown);
+    connect(m_breakdownViewCombo, &QComboBox::currentIndexChanged, this, &BookkeepingWidget::renderBreakdown);
     
     m_tabs->addTab(m_summaryTab, "📊 Summary");
 }
@@ -288,10 +352,9 @@ void BookkeepingWidget::setupSummaryTab()
 void BookkeepingWidget::setupModels()
 {
     // Expenses model
-    m_expensesModel = new QSqlTableModel(this);
-    m_expensesModel->setTable("expenses");
-    m_expensesModel->setEditStrategy(QSqlTableModel::OnManualSubmit);
-    m_expensesModel->setSort(1, Qt::DescendingOrder); // Sort by date descending
+    m_expensesModel = new LedgerTableModel("expenses", "category",
+        {"id", "date", "category", "amount", "description", "vendor", "receipt_path", "payment_method", "created_by"},
+        this);
     
     // Set column headers
     m_expensesModel->setHeaderData(0, Qt::Horizontal, "ID");
@@ -306,14 +369,12 @@ void BookkeepingWidget::setupModels()
     
     m_expensesView->setModel(m_expensesModel);
     m_expensesView->hideColumn(0); // Hide ID column
-    m_expensesView->hideColumn(9); // Hide created_at
-    m_expensesView->hideColumn(10); // Hide updated_at
+    m_expensesView->sortByColumn(1, Qt::DescendingOrder); // Sort by date descending
     
     // Income model
-    m_incomeModel = new QSqlTableModel(this);
-    m_incomeModel->setTable("income");
-    m_incomeModel->setEditStrategy(QSqlTableModel::OnManualSubmit);
-    m_incomeModel->setSort(1, Qt::DescendingOrder); // Sort by date descending
+    m_incomeModel = new LedgerTableModel("income", "source",
+        {"id", "date", "source", "amount", "description", "donor_name", "tax_deductible", "receipt_issued", "created_by"},
+        this);
     
     // Set column headers
     m_incomeModel->setHeaderData(0, Qt::Horizontal, "ID");
@@ -328,8 +389,7 @@ void BookkeepingWidget::setupModels()
     
     m_incomeView->setModel(m_incomeModel);
     m_incomeView->hideColumn(0); // Hide ID column
-    m_incomeView->hideColumn(9); // Hide created_at
-    m_incomeView->hideColumn(10); // Hide updated_at
+    m_incomeView->sortByColumn(1, Qt::DescendingOrder); // Sort by date descending
     
     // Load category filters
     QSqlQuery query;
@@ -357,73 +417,200 @@ void BookkeepingWidget::refreshData()
 
 void BookkeepingWidget::updateFinancialSummary()
 {
-    QSqlQuery query;
+    using firewood::core::BookkeepingPivot;
+    using firewood::core::DateRange;
+    using firewood::core::Money;
+
+    QSqlDatabase db = QSqlDatabase::database();
+
+    // Total income and expenses (all time), summed as exact cents
+    m_totalIncome = Money();
+    m_totalExpenses = Money();
+    firewood::db::loadAllTimeTotals(db, m_totalIncome, m_totalExpenses);
+
+    // This month and the fiscal year to date are read from the current year's pivot;
+    // the breakdown usually shows that year already
+    loadBreakdown();
+    const QDate today = QDate::currentDate();
+    const DateRange fiscalYear = DateRange::fiscalYear(today);
+    const BookkeepingPivot current = m_pivot.period() == fiscalYear
+        ? m_pivot
+        : firewood::db::loadBookkeepingPivot(db, fiscalYear);
+    const int month = current.monthIndex(today);
+
+    // Update labels
+    const Money netIncome = m_totalIncome - m_totalExpenses;
+    m_totalIncomeLabel->setText(m_totalIncome.format());
+    m_totalExpensesLabel->setText(m_totalExpenses.format());
+    m_netIncomeLabel->setText(netIncome.format());
     
-    // Total income and expenses (all time)
-    double totalIncome = 0.0, totalExpenses = 0.0;
+    m_monthlyIncomeLabel->setText(current.monthTotal(BookkeepingPivot::Kind::Income, month).format());
+    m_monthlyExpensesLabel->setText(current.monthTotal(BookkeepingPivot::Kind::Expense, month).format());
     
-    if (query.exec("SELECT SUM(amount) FROM income")) {
-        if (query.next()) {
-            totalIncome = query.value(0).toDouble();
-        }
-    }
+    m_yearlyIncomeLabel->setText(current.yearToDateTotal(BookkeepingPivot::Kind::Income, month).format());
+    m_yearlyExpensesLabel->setText(current.yearToDateTotal(BookkeepingPivot::Kind::Expense, month).format());
     
-    if (query.exec("SELECT SUM(amount) FROM expenses")) {
-        if (query.next()) {
-            totalExpenses = query.value(0).toDouble();
-        }
+    // Update net income color based on positive/negative
+    AdobeStyles::setTone(m_netIncomeLabel, netIncome.isNegative() ? "error" : "success");
+}
+
+void BookkeepingWidget::loadBreakdown()
+{
+    const QDate start = m_fiscalYearCombo->currentData().toDate();
+    QSqlDatabase db = QSqlDatabase::database();
+    m_pivot = firewood::db::loadBookkeepingPivot(db, firewood::core::DateRange::fiscalYear(start));
+    renderBreakdown();
+}
+
+int BookkeepingWidget::elapsedMonths(const firewood::core::BookkeepingPivot &pivot) const
+{
+    const QDate today = QDate::currentDate();
+    if (today > pivot.period().last()) {
+        return pivot.monthCount();
     }
-    
-    // Monthly totals
-    QString currentMonth = QDate::currentDate().toString("yyyy-MM");
-    double monthlyIncome = 0.0, monthlyExpenses = 0.0;
-    
-    query.prepare("SELECT SUM(amount) FROM income WHERE date LIKE :month");
-    query.bindValue(":month", currentMonth + "%");
-    if (query.exec() && query.next()) {
-        monthlyIncome = query.value(0).toDouble();
+    // -1 before the period starts, so nothing has elapsed
+    return pivot.monthIndex(today) + 1;
+}
+
+firewood::core::Money BookkeepingWidget::breakdownValue(int row, int month, int view) const
+{
+    switch (view) {
+    case YearToDateView:
+        return m_pivot.yearToDate(row, month);
+    case MonthOverMonthView:
+        return m_pivot.monthOverMonth(row, month);
+    case BudgetVarianceView:
+        return m_pivot.budgetVariance(row, month);
+    default:
+        return m_pivot.amount(row, month);
     }
-    
-    query.prepare("SELECT SUM(amount) FROM expenses WHERE date LIKE :month");
-    query.bindValue(":month", currentMonth + "%");
-    if (query.exec() && query.next()) {
-        monthlyExpenses = query.value(0).toDouble();
+}
+
+firewood::core::Money BookkeepingWidget::breakdownTotal(firewood::core::BookkeepingPivot::Kind kind, int month, int view) const
+{
+    using firewood::core::Money;
+
+    switch (view) {
+    case YearToDateView:
+        return m_pivot.yearToDateTotal(kind, month);
+    case MonthOverMonthView:
+        return m_pivot.monthOverMonthTotal(kind, month);
+    case BudgetVarianceView: {
+        Money variance;
+        for (int row = 0; row < m_pivot.categoryCount(); ++row) {
+            if (m_pivot.category(row).kind == kind) {
+                variance += m_pivot.budgetVariance(row, month);
+            }
+        }
+        return variance;
     }
-    
-    // Yearly totals
-    QString currentYear = QDate::currentDate().toString("yyyy");
-    double yearlyIncome = 0.0, yearlyExpenses = 0.0;
-    
-    query.prepare("SELECT SUM(amount) FROM income WHERE date LIKE :year");
-    query.bindValue(":year", currentYear + "%");
-    if (query.exec() && query.next()) {
-        yearlyIncome = query.value(0).toDouble();
+    default:
+        return m_pivot.monthTotal(kind, month);
     }
-    
-    query.prepare("SELECT SUM(amount) FROM expenses WHERE date LIKE :year");
-    query.bindValue(":year", currentYear + "%");
-    if (query.exec() && query.next()) {
-        yearlyExpenses = query.value(0).toDouble();
+}
+
+void BookkeepingWidget::renderBreakdown()
+{
+    using firewood::core::BookkeepingPivot;
+    using firewood::core::Money;
+    using Kind = BookkeepingPivot::Kind;
+
+    const int view = m_breakdownViewCombo->currentIndex();
+    const int months = m_pivot.monthCount();
+    const int shown = elapsedMonths(m_pivot);
+    const int lastShown = shown - 1;
+    const int totalColumn = months + 1;
+    const int budgetColumn = months + 2;
+    const int varianceColumn = months + 3;
+
+    QStringList headers{"Category"};
+    for (int month = 0; month < months; ++month) {
+        headers << m_pivot.monthStart(month).toString("MMM yy");
     }
-    
-    // Update labels
-    m_totalIncomeLabel->setText(QString("$%1").arg(totalIncome, 0, 'f', 2));
-    m_totalExpensesLabel->setText(QString("$%1").arg(totalExpenses, 0, 'f', 2));
-    m_netIncomeLabel->setText(QString("$%1").arg(totalIncome - totalExpenses, 0, 'f', 2));
-    
-    m_monthlyIncomeLabel->setText(QString("$%1").arg(monthlyIncome, 0, 'f', 2));
-    m_monthlyExpensesLabel->setText(QString("$%1").arg(monthlyExpenses, 0, 'f', 2));
-    
-    m_yearlyIncomeLabel->setText(QString("$%1").arg(yearlyIncome, 0, 'f', 2));
-    m_yearlyExpensesLabel->setText(QString("$%1").arg(yearlyExpenses, 0, 'f', 2));
-    
-    // Update net income color based on positive/negative
-    double netIncome = totalIncome - totalExpenses;
-    if (netIncome >= 0) {
-        m_netIncomeLabel->setStyleSheet("font-size: 24pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + ";");
-    } else {
-        m_netIncomeLabel->setStyleSheet("font-size: 24pt; font-weight: bold; color: " + AdobeStyles::ERROR_RED + ";");
+    headers << "Total" << "Budget" << "Variance";
+
+    m_breakdownTable->setUpdatesEnabled(false);
+    m_breakdownTable->clearContents();
+    m_breakdownTable->setColumnCount(headers.size());
+    m_breakdownTable->setHorizontalHeaderLabels(headers);
+
+    // Income categories and their total, expense categories and theirs, then net
+    m_breakdownTable->setRowCount(m_pivot.categoryCount() + 3);
+
+    QFont totalFont = m_breakdownTable->font();
+    totalFont.setBold(true);
+    const QColor negativeColor(AdobeStyles::ERROR_RED);
+
+    int tableRow = 0;
+    const auto setLabel = [&](const QString &text, bool total) {
+        auto *item = new QTableWidgetItem(text);
+        if (total) {
+            item->setFont(totalFont);
+        }
+        m_breakdownTable->setItem(tableRow, 0, item);
+    };
+    const auto setMoney = [&](int column, Money value, bool total) {
+        auto *item = new QTableWidgetItem(value.format());
+        item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+        if (value.isNegative()) {
+            item->setForeground(negativeColor);
+        }
+        if (total) {
+            item->setFont(totalFont);
+        }
+        m_breakdownTable->setItem(tableRow, column, item);
+    };
+
+    Money budgets[2];
+    Money variances[2];
+    Money totals[2];
+
+    for (const Kind kind : {Kind::Income, Kind::Expense}) {
+        const int k = kind == Kind::Income ? 0 : 1;
+        for (int row = 0; row < m_pivot.categoryCount(); ++row) {
+            const BookkeepingPivot::Category &entry = m_pivot.category(row);
+            if (entry.kind != kind) {
+                continue;
+            }
+            setLabel(entry.name, false);
+            for (int month = 0; month < shown; ++month) {
+                setMoney(month + 1, breakdownValue(row, month, view), false);
+            }
+            setMoney(totalColumn, m_pivot.categoryTotal(row), false);
+            if (!entry.annualBudget.isZero()) {
+                const Money variance = m_pivot.budgetVariance(row, lastShown);
+                setMoney(budgetColumn, entry.annualBudget, false);
+                setMoney(varianceColumn, variance, false);
+                budgets[k] += entry.annualBudget;
+                variances[k] += variance;
+            }
+            ++tableRow;
+        }
+
+        totals[k] = m_pivot.total(kind);
+        setLabel(kind == Kind::Income ? "Total income" : "Total expenses", true);
+        for (int month = 0; month < shown; ++month) {
+            setMoney(month + 1, breakdownTotal(kind, month, view), true);
+        }
+        setMoney(totalColumn, totals[k], true);
+        setMoney(budgetColumn, budgets[k], true);
+        setMoney(varianceColumn, variances[k], true);
+        ++tableRow;
     }
+
+    // Variances are already signed so that positive is favourable; they add up
+    setLabel("Net", true);
+    for (int month = 0; month < shown; ++month) {
+        const Money income = breakdownTotal(Kind::Income, month, view);
+        const Money expenses = breakdownTotal(Kind::Expense, month, view);
+        setMoney(month + 1, view == BudgetVarianceView ? income + expenses : income - expenses, true);
+    }
+    setMoney(totalColumn, totals[0] - totals[1], true);
+    setMoney(budgetColumn, budgets[0] - budgets[1], true);
+    setMoney(varianceColumn, variances[0] + variances[1], true);
+
+    m_breakdownTable->resizeColumnsToContents();
+    m_breakdownTable->setUpdatesEnabled(true);
 }
 
 void BookkeepingWidget::addExpense()
@@ -444,7 +631,7 @@ void BookkeepingWidget::editExpense()
         return;
     }
     
-    int expenseId = m_expensesModel->data(m_expensesModel->index(index.row(), 0)).toInt();
+    int expenseId = m_expensesModel->idAt(index.row());
     ExpenseDialog *dialog = new ExpenseDialog(expenseId, this);
     dialog->setUsername(m_username);
     if (dialog->exec() == QDialog::Accepted) {
@@ -466,8 +653,13 @@ void BookkeepingWidget::deleteExpense()
                                    QMessageBox::Yes | QMessageBox::No);
     
     if (ret == QMessageBox::Yes) {
-        m_expensesModel->removeRow(index.row());
-        m_expensesModel->submitAll();
+        QSqlQuery query;
+        query.prepare("DELETE FROM expenses WHERE id = ?");
+        query.addBindValue(m_expensesModel->idAt(index.row()));
+        if (!query.exec()) {
+            QMessageBox::critical(this, "Database Error", "Failed to delete expense: " + query.lastError().text());
+            return;
+        }
         refreshData();
     }
 }
@@ -490,7 +682,7 @@ void BookkeepingWidget::editIncome()
         return;
     }
     
-    int incomeId = m_incomeModel->data(m_incomeModel->index(index.row(), 0)).toInt();
+    int incomeId = m_incomeModel->idAt(index.row());
     IncomeDialog *dialog = new IncomeDialog(incomeId, this);
     dialog->setUsername(m_username);
     if (dialog->exec() == QDialog::Accepted) {
@@ -512,8 +704,13 @@ void BookkeepingWidget::deleteIncome()
                                    QMessageBox::Yes | QMessageBox::No);
     
     if (ret == QMessageBox::Yes) {
-        m_incomeModel->removeRow(index.row());
-        m_incomeModel->submitAll();
+        QSqlQuery query;
+        query.prepare("DELETE FROM income WHERE id = ?");
+        query.addBindValue(m_incomeModel->idAt(index.row()));
+        if (!query.exec()) {
+            QMessageBox::critical(this, "Database Error", "Failed to delete income entry: " + query.lastError().text());
+            return;
+        }
         refreshData();
     }
 }
@@ -541,19 +738,19 @@ void BookkeepingWidget::exportFinancialReport()
     
     // Write summary
     out << "FINANCIAL SUMMARY\n";
-    out << "Total Income," << m_totalIncomeLabel->text().remove('$') << "\n";
-    out << "Total Expenses," << m_totalExpensesLabel->text().remove('$') << "\n";
-    out << "Net Income," << m_netIncomeLabel->text().remove('$') << "\n\n";
+    out << "Total Income," << m_totalIncome.toPlainString() << "\n";
+    out << "Total Expenses," << m_totalExpenses.toPlainString() << "\n";
+    out << "Net Income," << (m_totalIncome - m_totalExpenses).toPlainString() << "\n\n";
     
     // Write expenses
     out << "EXPENSES\n";
     out << "Date,Category,Amount,Description,Vendor,Payment Method\n";
     
-    QSqlQuery expenseQuery("SELECT date, category, amount, description, vendor, payment_method FROM expenses ORDER BY date DESC");
+    QSqlQuery expenseQuery("SELECT date, category, amount_cents, description, vendor, payment_method FROM expenses ORDER BY date DESC");
     while (expenseQuery.next()) {
         out << expenseQuery.value(0).toString() << ","
             << expenseQuery.value(1).toString() << ","
-            << expenseQuery.value(2).toString() << ","
+            << firewood::core::Money::fromCents(expenseQuery.value(2).toLongLong()).toPlainString() << ","
             << "\"" << expenseQuery.value(3).toString() << "\","
             << expenseQuery.value(4).toString() << ","
             << expenseQuery.value(5).toString() << "\n";
@@ -562,11 +759,11 @@ void BookkeepingWidget::exportFinancialReport()
     out << "\nINCOME\n";
     out << "Date,Source,Amount,Description,Donor,Tax Deductible\n";
     
-    QSqlQuery incomeQuery("SELECT date, source, amount, description, donor_name, tax_deductible FROM income ORDER BY date DESC");
+    QSqlQuery incomeQuery("SELECT date, source, amount_cents, description, donor_name, tax_deductible FROM income ORDER BY date DESC");
     while (incomeQuery.next()) {
         out << incomeQuery.value(0).toString() << ","
             << incomeQuery.value(1).toString() << ","
-            << incomeQuery.value(2).toString() << ","
+            << firewood::core::Money::fromCents(incomeQuery.value(2).toLongLong()).toPlainString() << ","
             << "\"" << incomeQuery.value(3).toString() << "\","
             << incomeQuery.value(4).toString() << ","
             << (incomeQuery.value(5).toBool() ? "Yes" : "No") << "\n";
@@ -578,6 +775,51 @@ void BookkeepingWidget::exportFinancialReport()
                             QString("Financial report exported to:\n%1").arg(fileName));
 }
 
+void BookkeepingWidget::exportGrantReport()
+{
+    const firewood::core::DateRange period =
+        firewood::core::DateRange::fiscalYear(m_fiscalYearCombo->currentData().toDate());
+    const QString csvFilter = "CSV Files (*.csv)";
+    const QString htmlFilter = "HTML Files (*.html)";
+
+    QString selectedFilter = csvFilter;
+    QString fileName = QFileDialog::getSaveFileName(this,
+        "Export Grant Report",
+        QString("grant_report_%1.csv").arg(period.first().toString("yyyy")),
+        csvFilter + ";;" + htmlFilter, &selectedFilter);
+
+    if (fileName.isEmpty()) return;
+
+    if (!m_reportEngine) {
+        m_reportEngine = std::make_unique<firewood::db::ReportEngine>();
+    }
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    const firewood::core::Report report =
+        m_reportEngine->build("NMERA Firewood Bank - " + m_fiscalYearCombo->currentText() + " Report", period);
+    QApplication::restoreOverrideCursor();
+
+    const bool html = selectedFilter == htmlFilter || fileName.endsWith(".html", Qt::CaseInsensitive);
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        QMessageBox::critical(this, "Export Error", "Could not open file for writing.");
+        return;
+    }
+    QTextStream out(&file);
+    out << (html ? report.toHtml() : report.toCsv());
+    file.close();
+
+    if (!report.isComplete()) {
+        QMessageBox::warning(this, "Export Incomplete",
+                             QString("Grant report exported to:\n%1\n\nSome sections could not be loaded "
+                                     "and are marked as not available.").arg(fileName));
+        return;
+    }
+    QMessageBox::information(this, "Export Complete",
+                            QString("Grant report exported to:\n%1").arg(fileName));
+}
+
 void BookkeepingWidget::onExpenseDoubleClicked(const QModelIndex &index)
 {
     Q_UNUSED(index)
@@ -590,33 +832,18 @@ void BookkeepingWidget::onIncomeDoubleClicked(const QModelIndex &index)
     editIncome();
 }
 
-void BookkeepingWidget::filterByDateRange()
+// Each tab's controls only re-query its own model. Values are bound to the
+// models' prepared statements, never spliced into SQL.
+void BookkeepingWidget::filterExpenses()
 {
-    QString fromDate = m_expenseFromDate->date().toString("yyyy-MM-dd");
-    QString toDate = m_expenseToDate->date().toString("yyyy-MM-dd");
-    QString category = m_expenseCategoryFilter->currentData().toString();
-    
-    QString filter = QString("date BETWEEN '%1' AND '%2'").arg(fromDate).arg(toDate);
-    if (!category.isEmpty()) {
-        filter += QString(" AND category = '%1'").arg(category);
-    }
-    
-    m_expensesModel->setFilter(filter);
-    
-    // Apply similar filter to income
-    QString incomeFromDate = m_incomeFromDate->date().toString("yyyy-MM-dd");
-    QString incomeToDate = m_incomeToDate->date().toString("yyyy-MM-dd");
-    QString source = m_incomeSourceFilter->currentData().toString();
-    
-    QString incomeFilter = QString("date BETWEEN '%1' AND '%2'").arg(incomeFromDate).arg(incomeToDate);
-    if (!source.isEmpty()) {
-        incomeFilter += QString(" AND source = '%1'").arg(source);
-    }
-    
-    m_incomeModel->setFilter(incomeFilter);
+    m_expensesModel->setFilter(firewood::core::DateRange::between(m_expenseFromDate->date(), m_expenseToDate->date()),
+                               m_expenseCategoryFilter->currentData().toString());
+    m_expensesModel->select();
 }
 
-void BookkeepingWidget::filterByCategory()
+void BookkeepingWidget::filterIncome()
 {
-    filterByDateRange(); // Reuse the same logic
+    m_incomeModel->setFilter(firewood::core::DateRange::between(m_incomeFromDate->date(), m_incomeToDate->date()),
+                             m_incomeSourceFilter->currentData().toString());
+    m_incomeModel->select();
 }
@@ -3,7 +3,6 @@
 #include <QWidget>
 #include <QTabWidget>
 #include <QTableView>
-#include <QSqlTableModel>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QLabel>
@@ -11,6 +10,13 @@
 #include <QGroupBox>
 #include <QDateEdit>
 #include <QComboBox>
+#include <QTableWidget>
+#include "BookkeepingPivot.h"
+#include "Money.h"
+#include "report_engine.h"
+#include <memory>
+
+class LedgerTableModel;
 
 class BookkeepingWidget : public QWidget {
     Q_OBJECT
@@ -31,10 +37,13 @@ private slots:
     void editIncome();
     void deleteIncome();
     void exportFinancialReport();
+    void exportGrantReport();
     void onExpenseDoubleClicked(const QModelIndex &index);
     void onIncomeDoubleClicked(const QModelIndex &index);
-    void filterByDateRange();
-    void filterByCategory();
+    void filterExpenses();
+    void filterIncome();
+    void loadBreakdown();
+    void renderBreakdown();
 
 private:
     void setupUI();
@@ -43,6 +52,9 @@ private:
     void setupSummaryTab();
     void setupModels();
     void updateSummaryWidgets();
+    int elapsedMonths(const firewood::core::BookkeepingPivot &pivot) const;
+    firewood::core::Money breakdownValue(int row, int month, int view) const;
+    firewood::core::Money breakdownTotal(firewood::core::BookkeepingPivot::Kind kind, int month, int view) const;
     
     // User info
     QString m_username;
@@ -79,11 +91,23 @@ private:
     QLabel *m_monthlyExpensesLabel = nullptr;
     QLabel *m_yearlyIncomeLabel = nullptr;
     QLabel *m_yearlyExpensesLabel = nullptr;
+    firewood::core::Money m_totalIncome;
+    firewood::core::Money m_totalExpenses;
+
+    // Category x month breakdown; views are rendered from m_pivot without a query
+    QComboBox *m_fiscalYearCombo = nullptr;
+    QComboBox *m_breakdownViewCombo = nullptr;
+    QTableWidget *m_breakdownTable = nullptr;
+    firewood::core::BookkeepingPivot m_pivot;
     
-    // Export button
+    // Export buttons
     QPushButton *m_exportBtn = nullptr;
+    QPushButton *m_grantReportBtn = nullptr;
+
+    // Kept for its section cache, so re-exporting an unchanged year is instant
+    std::unique_ptr<firewood::db::ReportEngine> m_reportEngine;
     
     // Database Models
-    QSqlTableModel *m_expensesModel = nullptr;
-    QSqlTableModel *m_incomeModel = nullptr;
+    LedgerTableModel *m_expensesModel = nullptr;
+    LedgerTableModel *m_incomeModel = nullptr;
 };
@@ -1,6 +1,8 @@
 #include "ClientDialog.h"
 #include "WorkOrderDialog.h"
 #include "StyleSheet.h"
+#include "ResultTableModel.h"
+#include "client_matching.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QFormLayout>
@@ -51,10 +53,7 @@ void ClientDialog::setupUI()
 
   m_saveButton = new QPushButton("Save", this);
   m_saveButton->setDefault(true);
-  m_saveButton->setStyleSheet(
-    "QPushButton { background-color: #0078d4; color: white; font-weight: bold; padding: 8px 20px; }"
-    "QPushButton:hover { background-color: #106ebe; }"
-  );
+  AdobeStyles::setVariant(m_saveButton, "primary");
   connect(m_saveButton, &QPushButton::clicked, this, &ClientDialog::onSaveClicked);
   buttonLayout->addWidget(m_saveButton);
 
@@ -138,7 +137,7 @@ void ClientDialog::createVolunteerTab()
   auto* statusLayout = new QVBoxLayout(statusGroup);
 
   m_isVolunteerCheck = new QCheckBox("This client is a volunteer");
-  m_isVolunteerCheck->setStyleSheet("font-weight: bold; font-size: 12px;");
+  AdobeStyles::setVariant(m_isVolunteerCheck, "strong");
   connect(m_isVolunteerCheck, &QCheckBox::stateChanged, this, &ClientDialog::onVolunteerCheckChanged);
   statusLayout->addWidget(m_isVolunteerCheck);
 
@@ -159,8 +158,7 @@ void ClientDialog::createVolunteerTab()
   auto* workLayout = new QFormLayout(workGroup);
 
   m_worksForWoodCheck = new QCheckBox("Participates in Work for Wood");
-  m_worksForWoodCheck->setStyleSheet("font-weight: bold;");
-  connect(m_worksForWoodCheck, &QCheckBox::stateChanged, this, &ClientDialog::onWorksForWoodChanged);
+  AdobeStyles::setVariant(m_worksForWoodCheck, "strong");
   workLayout->addRow("", m_worksForWoodCheck);
 
   m_woodCreditSpin = new QDoubleSpinBox();
@@ -168,6 +166,7 @@ void ClientDialog::createVolunteerTab()
   m_woodCreditSpin->setDecimals(2);
   m_woodCreditSpin->setSuffix(" cords");
   m_woodCreditSpin->setEnabled(false);
+  m_woodCreditSpin->setToolTip("Counted from delivered Work-for-Wood orders");
   workLayout->addRow("Wood Credit Received:", m_woodCreditSpin);
 
   m_creditBalanceSpin = new QDoubleSpinBox();
@@ -175,6 +174,7 @@ void ClientDialog::createVolunteerTab()
   m_creditBalanceSpin->setDecimals(2);
   m_creditBalanceSpin->setSuffix(" cords");
   m_creditBalanceSpin->setEnabled(false);
+  m_creditBalanceSpin->setToolTip("Kept by the credit ledger from volunteer hours and Work-for-Wood orders");
   workLayout->addRow("Current Credit Balance:", m_creditBalanceSpin);
 
   layout->addWidget(workGroup);
@@ -185,20 +185,27 @@ void ClientDialog::createVolunteerTab()
 
   auto* summaryLayout = new QHBoxLayout();
   m_totalHoursLabel = new QLabel("Total Hours: 0.0");
-  m_totalHoursLabel->setStyleSheet("font-weight: bold; font-size: 13px;");
+  AdobeStyles::setVariant(m_totalHoursLabel, "strong");
   summaryLayout->addWidget(m_totalHoursLabel);
 
   summaryLayout->addSpacing(20);
 
   m_lastVolunteerDateLabel = new QLabel("Last Date: Never");
-  m_lastVolunteerDateLabel->setStyleSheet("font-size: 13px;");
   summaryLayout->addWidget(m_lastVolunteerDateLabel);
   summaryLayout->addStretch();
   hoursLayout->addLayout(summaryLayout);
 
-  m_volunteerHoursTable = new QTableWidget();
-  m_volunteerHoursTable->setColumnCount(4);
-  m_volunteerHoursTable->setHorizontalHeaderLabels({ "Date", "Hours", "Activity", "Notes" });
+  m_volunteerHoursModel = new ResultTableModel(this);
+  m_volunteerHoursModel->setHeaders({ "Date", "Hours", "Activity", "Notes" });
+  m_volunteerHoursModel->setFormatter(1, [](const ResultTableModel& model, int row, int role) -> QVariant {
+    if (role == Qt::DisplayRole) {
+      return QString::number(model.real(row, 1), 'f', 1);
+    }
+    return QVariant();
+  });
+
+  m_volunteerHoursTable = new QTableView();
+  m_volunteerHoursTable->setModel(m_volunteerHoursModel);
   m_volunteerHoursTable->horizontalHeader()->setStretchLastSection(true);
   m_volunteerHoursTable->setSelectionBehavior(QAbstractItemView::SelectRows);
   m_volunteerHoursTable->setAlternatingRowColors(true);
@@ -232,13 +239,12 @@ void ClientDialog::createOrderHistoryTab()
 
   auto* summaryLayout = new QHBoxLayout();
   m_orderCountLabel = new QLabel("Total Orders: 0");
-  m_orderCountLabel->setStyleSheet("font-weight: bold; font-size: 14px;");
+  AdobeStyles::setVariant(m_orderCountLabel, "strong");
   summaryLayout->addWidget(m_orderCountLabel);
 
   summaryLayout->addSpacing(20);
 
   m_lastOrderDateLabel = new QLabel("Last Order: Never");
-  m_lastOrderDateLabel->setStyleSheet("font-size: 14px;");
   summaryLayout->addWidget(m_lastOrderDateLabel);
   summaryLayout->addStretch();
 
@@ -271,13 +277,6 @@ void ClientDialog::onVolunteerCheckChanged(int state)
   m_hasVehicleCheck->setEnabled(isVolunteer);
 }
 
-void ClientDialog::onWorksForWoodChanged(int state)
-{
-  bool worksForWood = (state == Qt::Checked);
-  m_woodCreditSpin->setEnabled(worksForWood);
-  m_creditBalanceSpin->setEnabled(worksForWood);
-}
-
 void ClientDialog::loadClientData()
 {
   QSqlQuery query;
@@ -322,6 +321,7 @@ void ClientDialog::loadClientData()
 void ClientDialog::loadVolunteerHours()
 {
   QSqlQuery query;
+  query.setForwardOnly(true);
   query.prepare("SELECT date, hours, activity, notes FROM volunteer_hours "
     "WHERE household_id = :id ORDER BY date DESC");
   query.bindValue(":id", m_clientId);
@@ -331,22 +331,14 @@ void ClientDialog::loadVolunteerHours()
     return;
   }
 
-  m_volunteerHoursTable->setRowCount(0);
+  m_volunteerHoursModel->load(query);
+
   double totalHours = 0.0;
-  QString lastDate;
-  int row = 0;
-
-  while (query.next()) {
-    m_volunteerHoursTable->insertRow(row);
-    m_volunteerHoursTable->setItem(row, 0, new QTableWidgetItem(query.value(0).toString()));
-    m_volunteerHoursTable->setItem(row, 1, new QTableWidgetItem(QString::number(query.value(1).toDouble(), 'f', 1)));
-    m_volunteerHoursTable->setItem(row, 2, new QTableWidgetItem(query.value(2).toString()));
-    m_volunteerHoursTable->setItem(row, 3, new QTableWidgetItem(query.value(3).toString()));
-
-    totalHours += query.value(1).toDouble();
-    if (row == 0) lastDate = query.value(0).toString();
-    row++;
+  for (int row = 0; row < m_volunteerHoursModel->resultRowCount(); ++row) {
+    totalHours += m_volunteerHoursModel->real(row, 1);
   }
+  // Newest first, so the first row is the last date worked
+  const QString lastDate = m_volunteerHoursModel->text(0, 0);
 
   m_totalHoursLabel->setText(QString("Total Hours: %1").arg(totalHours, 0, 'f', 1));
   m_lastVolunteerDateLabel->setText(QString("Last Date: %1").arg(lastDate.isEmpty() ? "Never" : lastDate));
@@ -416,38 +408,38 @@ bool ClientDialog::saveClientData()
   }
 
   if (m_isNewClient) {
-    QString name = m_nameEdit->text().trimmed();
-    QString address = m_addressEdit->toPlainText().trimmed();
-
-    QSqlQuery checkQuery;
-    checkQuery.prepare(
-      "SELECT id, name, address, phone FROM households "
-      "WHERE LOWER(name) = LOWER(:name) OR "
-      "(LOWER(address) = LOWER(:address) AND :address != '')"
-    );
-    checkQuery.bindValue(":name", name);
-    checkQuery.bindValue(":address", address);
-
-    if (checkQuery.exec() && checkQuery.next()) {
-      int existingId = checkQuery.value(0).toInt();
-      QString existingName = checkQuery.value(1).toString();
-      QString existingAddress = checkQuery.value(2).toString();
-      QString existingPhone = checkQuery.value(3).toString();
+    QSqlDatabase db = QSqlDatabase::database();
+    // Catches misspellings, nicknames and "Rd"/"Road" variants, not just exact copies
+    const QList<firewood::db::ClientMatch> matches = firewood::db::findClientMatches(
+      db, m_nameEdit->text().trimmed(), m_phoneEdit->text().trimmed(), m_addressEdit->toPlainText().trimmed());
+
+    if (!matches.isEmpty()) {
+      const firewood::db::MatchedHousehold &existing = matches.first().household;
+      int existingId = static_cast<int>(existing.id);
+      const QString others = matches.size() > 1
+        ? QString("\n(%1 other possible match%2; see Admin > Find Duplicate Clients.)")
+            .arg(matches.size() - 1).arg(matches.size() > 2 ? "es" : "")
+        : QString();
 
       QMessageBox::StandardButton reply = QMessageBox::question(
         this,
         "Possible Duplicate Household",
-        QString("A household with similar information already exists:\n\n"
+        QString("A household with similar information already exists "
+          "(%4% match: %5):\n\n"
           "Name: %1\n"
           "Address: %2\n"
-          "Phone: %3\n\n"
+          "Phone: %3\n%6\n"
           "Do you want to:\n"
           "• Click 'Yes' to edit the existing household instead\n"
           "• Click 'No' to add this as a new household anyway\n"
           "• Click 'Cancel' to go back and review")
-        .arg(existingName)
-        .arg(existingAddress.isEmpty() ? "(No address)" : existingAddress)
-        .arg(existingPhone.isEmpty() ? "(No phone)" : existingPhone),
+        .arg(existing.name)
+        .arg(existing.address.isEmpty() ? "(No address)" : existing.address)
+        .arg(existing.phone.isEmpty() ? "(No phone)" : existing.phone)
+        .arg(qRound(matches.first().match.score * 100))
+        .arg(matches.first().match.reasons.isEmpty() ? QString("similar details")
+                                                     : matches.first().match.reasons.join(", ").toLower())
+        .arg(others),
         QMessageBox::Yes | QMessageBox::No | QMessageBox::Cancel,
         QMessageBox::Yes
       );
@@ -473,18 +465,15 @@ bool ClientDialog::saveClientData()
 
   if (m_isNewClient) {
     query.prepare("INSERT INTO households (name, phone, address, email, mailing_address, gate_code, notes, stove_fireplace_size, "
-      "is_volunteer, waiver_signed, has_license, has_working_vehicle, participating_in_work_for_wood, "
-      "wood_credit_received, credit_balance) "
+      "is_volunteer, waiver_signed, has_license, has_working_vehicle, participating_in_work_for_wood) "
       "VALUES (:name, :phone, :address, :email, :mailing_address, :gate_code, :notes, :stove_size, "
-      ":is_volunteer, :waiver_signed, :has_license, :has_working_vehicle, :works_for_wood, "
-      ":wood_credit_received, :credit_balance)");
+      ":is_volunteer, :waiver_signed, :has_license, :has_working_vehicle, :works_for_wood)");
   }
   else {
     query.prepare("UPDATE households SET name = :name, phone = :phone, address = :address, email = :email, "
       "mailing_address = :mailing_address, gate_code = :gate_code, notes = :notes, stove_fireplace_size = :stove_size, "
       "is_volunteer = :is_volunteer, waiver_signed = :waiver_signed, has_license = :has_license, "
-      "has_working_vehicle = :has_working_vehicle, participating_in_work_for_wood = :works_for_wood, "
-      "wood_credit_received = :wood_credit_received, credit_balance = :credit_balance "
+      "has_working_vehicle = :has_working_vehicle, participating_in_work_for_wood = :works_for_wood "
       "WHERE id = :id");
     query.bindValue(":id", m_clientId);
   }
@@ -502,8 +491,6 @@ bool ClientDialog::saveClientData()
   query.bindValue(":has_license", m_hasLicenseCheck->isChecked() ? 1 : 0);
   query.bindValue(":has_working_vehicle", m_hasVehicleCheck->isChecked() ? 1 : 0);
   query.bindValue(":works_for_wood", m_worksForWoodCheck->isChecked() ? 1 : 0);
-  query.bindValue(":wood_credit_received", m_woodCreditSpin->value());
-  query.bindValue(":credit_balance", m_creditBalanceSpin->value());
 
   if (!query.exec()) {
     qDebug() << "ERROR: Failed to save client:" << query.lastError().text();
@@ -520,5 +507,11 @@ bool ClientDialog::saveClientData()
     qDebug() << "Updated client ID:" << m_clientId;
   }
 
+  // Otherwise the keys are filled in before the next duplicate check
+  QSqlDatabase db = QSqlDatabase::database();
+  if (!firewood::db::updateClientMatchKeys(db, m_clientId)) {
+    qDebug() << "WARNING: Failed to update match keys for client" << m_clientId;
+  }
+
   return true;
 }
@@ -7,7 +7,7 @@
 #include <QSpinBox>
 #include <QDoubleSpinBox>
 #include <QPushButton>
-#include <QTableWidget>
+#include <QTableView>
 #include <QComboBox>
 #include <QDateEdit>
 #include <QTabWidget>
@@ -29,7 +29,6 @@ private slots:
   void onAddVolunteerHours();
   void onDeleteVolunteerHours();
   void onVolunteerCheckChanged(int state);
-  void onWorksForWoodChanged(int state);
   void onOrderHistoryDoubleClicked(const QModelIndex& index);
 
 private:
@@ -67,7 +66,8 @@ private:
   QCheckBox* m_worksForWoodCheck = nullptr;
   QDoubleSpinBox* m_woodCreditSpin = nullptr;
   QDoubleSpinBox* m_creditBalanceSpin = nullptr;
-  QTableWidget* m_volunteerHoursTable = nullptr;
+  QTableView* m_volunteerHoursTable = nullptr;
+  class ResultTableModel* m_volunteerHoursModel = nullptr;
   QLabel* m_totalHoursLabel = nullptr;
   QLabel* m_lastVolunteerDateLabel = nullptr;
 
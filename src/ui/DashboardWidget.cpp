@@ -1,11 +1,18 @@
 #include "DashboardWidget.h"
+#include "TwoWeekScheduleWidget.h"
 #include "StyleSheet.h"
 #include "Authorization.h"
+#include "Codes.h"
+#include "DateRange.h"
+#include "Money.h"
+#include "data_version.h"
+#include "ResultTableModel.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QGridLayout>
 #include <QHeaderView>
 #include <QDate>
+#include <QDateTime>
 #include <QSqlQuery>
 #include <QSqlError>
 #include <QSqlRecord>
@@ -15,12 +22,12 @@
 using namespace firewood::core;
 
 DashboardWidget::DashboardWidget(const UserInfo &userInfo, QWidget *parent)
-    : QWidget(parent), m_userInfo(userInfo)
+    : QWidget(parent), m_userInfo(userInfo), m_role(parseUserType(userInfo.role))
 {
     setupUI();
     
     // Load data
-    if (Authorization::isAdmin(m_userInfo.role) || Authorization::isLead(m_userInfo.role)) {
+    if (Authorization::hasPermission(m_role, Authorization::Permission::ViewAllReports)) {
         loadStatistics();  // NEW: Load statistics for leads and admins
     }
     loadUpcomingOrders();
@@ -33,8 +40,8 @@ DashboardWidget::DashboardWidget(const UserInfo &userInfo, QWidget *parent)
 
 void DashboardWidget::setupUI()
 {
-    // Set modern dark background
-    setStyleSheet("QWidget { background-color: " + AdobeStyles::DARK_BG + "; }");
+    // Dark background comes from the "DashboardWidget" rule of the application stylesheet
+    setAttribute(Qt::WA_StyledBackground, true);
     
     auto *mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(20);
@@ -44,7 +51,7 @@ void DashboardWidget::setupUI()
     createModernHeader();
     
     // Show statistics for leads and admins only
-    if (Authorization::isAdmin(m_userInfo.role) || Authorization::isLead(m_userInfo.role)) {
+    if (Authorization::hasPermission(m_role, Authorization::Permission::ViewAllReports)) {
         createStatisticsSection();
     }
     
@@ -55,13 +62,7 @@ void DashboardWidget::setupUI()
 void DashboardWidget::createModernHeader()
 {
     auto *headerWidget = new QWidget(this);
-    headerWidget->setStyleSheet(
-        "QWidget { "
-        "   background: " + AdobeStyles::CARD_BG + "; "
-        "   border-radius: 12px; "
-        "   padding: 20px; "
-        "}"
-    );
+    AdobeStyles::setVariant(headerWidget, "card");
     
     auto *headerLayout = new QHBoxLayout(headerWidget);
     headerLayout->setSpacing(20);
@@ -72,23 +73,10 @@ void DashboardWidget::createModernHeader()
     userInfoLayout->setSpacing(8);
     
     auto *welcomeLabel = new QLabel("Welcome back, " + m_userInfo.fullName, this);
-    welcomeLabel->setStyleSheet(
-        "QLabel { "
-        "   font-size: 24px; "
-        "   font-weight: 700; "
-        "   color: " + AdobeStyles::TEXT_PRIMARY + "; "
-        "   margin-bottom: 4px; "
-        "}"
-    );
+    AdobeStyles::setVariant(welcomeLabel, "header");
     userInfoLayout->addWidget(welcomeLabel);
     
     auto *roleLabel = new QLabel(m_userInfo.role + " • " + QDate::currentDate().toString("dddd, MMMM d, yyyy"), this);
-    roleLabel->setStyleSheet(
-        "QLabel { "
-        "   font-size: 14px; "
-        "   color: " + AdobeStyles::TEXT_SECONDARY + "; "
-        "}"
-    );
     userInfoLayout->addWidget(roleLabel);
     
     headerLayout->addWidget(userInfoWidget);
@@ -115,41 +103,23 @@ void DashboardWidget::createModernHeader()
 QWidget* DashboardWidget::createQuickStatCard(const QString &icon, const QString &label, const QString &value)
 {
     auto *card = new QWidget();
-    card->setStyleSheet(
-        "QWidget { "
-        "   background: " + AdobeStyles::SURFACE_BG + "; "
-        "   border-radius: 8px; "
-        "   padding: 12px 16px; "
-        "   border: 1px solid " + AdobeStyles::BORDER_GRAY + "; "
-        "}"
-    );
+    AdobeStyles::setVariant(card, "tile");
     
     auto *layout = new QVBoxLayout(card);
     layout->setSpacing(4);
     
     auto *iconLabel = new QLabel(icon, this);
-    iconLabel->setStyleSheet("font-size: 16px;");
+    AdobeStyles::setVariant(iconLabel, "icon");
     iconLabel->setAlignment(Qt::AlignCenter);
     layout->addWidget(iconLabel);
     
     auto *valueLabel = new QLabel(value, this);
-    valueLabel->setStyleSheet(
-        "QLabel { "
-        "   font-size: 16px; "
-        "   font-weight: 600; "
-        "   color: " + AdobeStyles::TEXT_PRIMARY + "; "
-        "}"
-    );
+    AdobeStyles::setVariant(valueLabel, "value");
     valueLabel->setAlignment(Qt::AlignCenter);
     layout->addWidget(valueLabel);
     
     auto *labelLabel = new QLabel(label, this);
-    labelLabel->setStyleSheet(
-        "QLabel { "
-        "   font-size: 12px; "
-        "   color: " + AdobeStyles::TEXT_SECONDARY + "; "
-        "}"
-    );
+    AdobeStyles::setVariant(labelLabel, "caption");
     labelLabel->setAlignment(Qt::AlignCenter);
     layout->addWidget(labelLabel);
     
@@ -184,13 +154,7 @@ void DashboardWidget::createModernDashboard()
 QWidget* DashboardWidget::createModernCard(const QString &title, const QString &subtitle, QWidget *content)
 {
     auto *card = new QWidget();
-    card->setStyleSheet(
-        "QWidget { "
-        "   background: " + AdobeStyles::CARD_BG + "; "
-        "   border-radius: 12px; "
-        "   border: 1px solid " + AdobeStyles::BORDER_GRAY + "; "
-        "}"
-    );
+    AdobeStyles::setVariant(card, "card");
     
     auto *layout = new QVBoxLayout(card);
     layout->setSpacing(16);
@@ -202,22 +166,10 @@ QWidget* DashboardWidget::createModernCard(const QString &title, const QString &
     headerLayout->setSpacing(4);
     
     auto *titleLabel = new QLabel(title, this);
-    titleLabel->setStyleSheet(
-        "QLabel { "
-        "   font-size: 18px; "
-        "   font-weight: 600; "
-        "   color: " + AdobeStyles::TEXT_PRIMARY + "; "
-        "}"
-    );
+    AdobeStyles::setVariant(titleLabel, "subheader");
     headerLayout->addWidget(titleLabel);
     
     auto *subtitleLabel = new QLabel(subtitle, this);
-    subtitleLabel->setStyleSheet(
-        "QLabel { "
-        "   font-size: 14px; "
-        "   color: " + AdobeStyles::TEXT_SECONDARY + "; "
-        "}"
-    );
     headerLayout->addWidget(subtitleLabel);
     
     layout->addWidget(headerWidget);
@@ -233,15 +185,14 @@ QWidget* DashboardWidget::createWorkOrdersContent()
     layout->setSpacing(12);
     
     // Create a modern table for work orders
-    m_upcomingOrdersTable = new QTableWidget(this);
-    m_upcomingOrdersTable->setColumnCount(3);
-    m_upcomingOrdersTable->setHorizontalHeaderLabels({"Date", "Client", "Status"});
+    upcomingOrdersModel()->setHeaders({"Date", "Client", "Contact #"});
+    m_upcomingOrdersTable = new QTableView(this);
+    m_upcomingOrdersTable->setModel(upcomingOrdersModel());
     m_upcomingOrdersTable->horizontalHeader()->setStretchLastSection(true);
     m_upcomingOrdersTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_upcomingOrdersTable->setSelectionBehavior(QAbstractItemView::SelectRows);
     m_upcomingOrdersTable->setAlternatingRowColors(true);
     m_upcomingOrdersTable->verticalHeader()->setVisible(false);
-    m_upcomingOrdersTable->setStyleSheet(AdobeStyles::TABLE_VIEW);
     m_upcomingOrdersTable->setShowGrid(false);
     m_upcomingOrdersTable->setMaximumHeight(200);
     
@@ -256,32 +207,10 @@ QWidget* DashboardWidget::createCalendarContent()
     auto *layout = new QVBoxLayout(content);
     layout->setSpacing(12);
     
-    // Create a modern calendar widget
-    m_twoWeekCalendar = new QCalendarWidget(this);
-    m_twoWeekCalendar->setStyleSheet(
-        "QCalendarWidget { "
-        "   background: " + AdobeStyles::SURFACE_BG + "; "
-        "   border: 1px solid " + AdobeStyles::BORDER_GRAY + "; "
-        "   border-radius: 8px; "
-        "   color: " + AdobeStyles::TEXT_PRIMARY + "; "
-        "} "
-        "QCalendarWidget QAbstractItemView { "
-        "   selection-background-color: " + AdobeStyles::ADOBE_BLUE + "; "
-        "   selection-color: white; "
-        "} "
-        "QCalendarWidget QToolButton { "
-        "   background: " + AdobeStyles::ADOBE_BLUE + "; "
-        "   color: white; "
-        "   border-radius: 4px; "
-        "   padding: 4px; "
-        "} "
-        "QCalendarWidget QToolButton:hover { "
-        "   background: " + AdobeStyles::ADOBE_BLUE_LIGHT + "; "
-        "}"
-    );
-    m_twoWeekCalendar->setMaximumHeight(200);
-    
-    layout->addWidget(m_twoWeekCalendar);
+    // Open deliveries and work shifts for today and the next 13 days
+    m_twoWeekSchedule = new TwoWeekScheduleWidget(this);
+    
+    layout->addWidget(m_twoWeekSchedule);
     
     return content;
 }
@@ -298,29 +227,35 @@ QWidget* DashboardWidget::createInventoryContent()
     
     // Wood section
     auto *woodLabel = new QLabel("🪵 Wood", this);
-    woodLabel->setStyleSheet("font-weight: 600; color: " + AdobeStyles::TEXT_PRIMARY + ";");
+    AdobeStyles::setVariant(woodLabel, "strong");
+    AdobeStyles::setTone(woodLabel, "primary");
     inventoryGrid->addWidget(woodLabel, 0, 0);
     
     m_splitWoodLabel = new QLabel("Loading...", this);
-    m_splitWoodLabel->setStyleSheet("color: " + AdobeStyles::SUCCESS_GREEN + "; font-weight: 600;");
+    AdobeStyles::setVariant(m_splitWoodLabel, "strong");
+    AdobeStyles::setTone(m_splitWoodLabel, "success");
     inventoryGrid->addWidget(m_splitWoodLabel, 0, 1);
     
     // Gas section
     auto *gasLabel = new QLabel("⛽ Gas", this);
-    gasLabel->setStyleSheet("font-weight: 600; color: " + AdobeStyles::TEXT_PRIMARY + ";");
+    AdobeStyles::setVariant(gasLabel, "strong");
+    AdobeStyles::setTone(gasLabel, "primary");
     inventoryGrid->addWidget(gasLabel, 1, 0);
     
     m_regularGasLabel = new QLabel("Loading...", this);
-    m_regularGasLabel->setStyleSheet("color: " + AdobeStyles::SUCCESS_GREEN + "; font-weight: 600;");
+    AdobeStyles::setVariant(m_regularGasLabel, "strong");
+    AdobeStyles::setTone(m_regularGasLabel, "success");
     inventoryGrid->addWidget(m_regularGasLabel, 1, 1);
     
     // Equipment section
     auto *equipmentLabel = new QLabel("🔧 Equipment", this);
-    equipmentLabel->setStyleSheet("font-weight: 600; color: " + AdobeStyles::TEXT_PRIMARY + ";");
+    AdobeStyles::setVariant(equipmentLabel, "strong");
+    AdobeStyles::setTone(equipmentLabel, "primary");
     inventoryGrid->addWidget(equipmentLabel, 2, 0);
     
     m_sawsLabel = new QLabel("Loading...", this);
-    m_sawsLabel->setStyleSheet("color: " + AdobeStyles::SUCCESS_GREEN + "; font-weight: 600;");
+    AdobeStyles::setVariant(m_sawsLabel, "strong");
+    AdobeStyles::setTone(m_sawsLabel, "success");
     inventoryGrid->addWidget(m_sawsLabel, 2, 1);
     
     layout->addLayout(inventoryGrid);
@@ -338,29 +273,11 @@ QWidget* DashboardWidget::createAlertsContent()
     m_emergenciesText = new QTextEdit(this);
     m_emergenciesText->setReadOnly(true);
     m_emergenciesText->setMaximumHeight(80);
-    m_emergenciesText->setStyleSheet(
-        "QTextEdit { "
-        "   background: " + AdobeStyles::SURFACE_BG + "; "
-        "   border: 1px solid " + AdobeStyles::BORDER_GRAY + "; "
-        "   border-radius: 8px; "
-        "   padding: 12px; "
-        "   color: " + AdobeStyles::TEXT_PRIMARY + "; "
-        "}"
-    );
     layout->addWidget(m_emergenciesText);
     
     m_lowInventoryText = new QTextEdit(this);
     m_lowInventoryText->setReadOnly(true);
     m_lowInventoryText->setMaximumHeight(80);
-    m_lowInventoryText->setStyleSheet(
-        "QTextEdit { "
-        "   background: " + AdobeStyles::SURFACE_BG + "; "
-        "   border: 1px solid " + AdobeStyles::BORDER_GRAY + "; "
-        "   border-radius: 8px; "
-        "   padding: 12px; "
-        "   color: " + AdobeStyles::TEXT_PRIMARY + "; "
-        "}"
-    );
     layout->addWidget(m_lowInventoryText);
     
     return content;
@@ -370,26 +287,7 @@ void DashboardWidget::createStatisticsSection()
 {
     // Statistics banner at the top for leads and admins
     auto *statsBox = createGroupBox("📊 Organization Statistics Dashboard");
-    statsBox->setStyleSheet(
-        "QGroupBox { "
-        "   border: 3px solid " + AdobeStyles::ADOBE_BLUE + "; "
-        "   border-radius: 15px; "
-        "   margin-top: 18px; "
-        "   padding: 15px 20px 15px 20px; "
-        "   font-weight: bold; "
-        "   background: " + AdobeStyles::CARD_BG + "; "
-        "} "
-        "QGroupBox::title { "
-        "   subcontrol-origin: margin; "
-        "   subcontrol-position: top center; "
-        "   padding: 8px 20px; "
-        "   background: " + AdobeStyles::GRADIENT_PRIMARY + "; "
-        "   color: white; "
-        "   border-radius: 8px; "
-        "   font-size: 13pt; "
-        "   font-weight: bold; "
-        "}"
-    );
+    AdobeStyles::setVariant(statsBox, "stats");
     auto *statsLayout = new QGridLayout(statsBox);
     statsLayout->setSpacing(15);
     statsLayout->setContentsMargins(10, 10, 10, 10);
@@ -404,7 +302,8 @@ void DashboardWidget::createStatisticsSection()
     statsLayout->addWidget(householdsLabel, 0, 0);
     
     m_totalHouseholdsLabel = new QLabel("Loading...", this);
-    m_totalHouseholdsLabel->setStyleSheet("font-size: 20pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + "; padding: 10px 5px 15px 5px;");
+    AdobeStyles::setVariant(m_totalHouseholdsLabel, "figure");
+    AdobeStyles::setTone(m_totalHouseholdsLabel, "success");
     m_totalHouseholdsLabel->setAlignment(Qt::AlignCenter);
     m_totalHouseholdsLabel->setMinimumHeight(60);
     statsLayout->addWidget(m_totalHouseholdsLabel, 1, 0);
@@ -419,22 +318,23 @@ void DashboardWidget::createStatisticsSection()
     woodStatsLayout->setSpacing(5);
     
     m_woodDeliveredWeekLabel = new QLabel("This Week: <b>0.0 cords</b>", this);
-    m_woodDeliveredWeekLabel->setStyleSheet("font-size: 11pt; padding: 3px;");
+    AdobeStyles::setVariant(m_woodDeliveredWeekLabel, "stat");
     m_woodDeliveredWeekLabel->setWordWrap(false);
     woodStatsLayout->addWidget(m_woodDeliveredWeekLabel);
     
     m_woodDeliveredMonthLabel = new QLabel("This Month: <b>0.0 cords</b>", this);
-    m_woodDeliveredMonthLabel->setStyleSheet("font-size: 11pt; padding: 3px;");
+    AdobeStyles::setVariant(m_woodDeliveredMonthLabel, "stat");
     m_woodDeliveredMonthLabel->setWordWrap(false);
     woodStatsLayout->addWidget(m_woodDeliveredMonthLabel);
     
     m_woodDeliveredYearLabel = new QLabel("This Year: <b>0.0 cords</b>", this);
-    m_woodDeliveredYearLabel->setStyleSheet("font-size: 11pt; padding: 3px;");
+    AdobeStyles::setVariant(m_woodDeliveredYearLabel, "stat");
     m_woodDeliveredYearLabel->setWordWrap(false);
     woodStatsLayout->addWidget(m_woodDeliveredYearLabel);
     
     m_woodDeliveredAllTimeLabel = new QLabel("All Time: <b>0.0 cords</b>", this);
-    m_woodDeliveredAllTimeLabel->setStyleSheet("font-size: 13pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + "; padding: 3px;");
+    AdobeStyles::setVariant(m_woodDeliveredAllTimeLabel, "metric");
+    AdobeStyles::setTone(m_woodDeliveredAllTimeLabel, "success");
     m_woodDeliveredAllTimeLabel->setWordWrap(false);
     woodStatsLayout->addWidget(m_woodDeliveredAllTimeLabel);
     
@@ -450,22 +350,23 @@ void DashboardWidget::createStatisticsSection()
     expenseStatsLayout->setSpacing(5);
     
     m_expenseWeekLabel = new QLabel("This Week: <b>$0.00</b>", this);
-    m_expenseWeekLabel->setStyleSheet("font-size: 11pt; padding: 3px;");
+    AdobeStyles::setVariant(m_expenseWeekLabel, "stat");
     m_expenseWeekLabel->setWordWrap(false);
     expenseStatsLayout->addWidget(m_expenseWeekLabel);
     
     m_expenseMonthLabel = new QLabel("This Month: <b>$0.00</b>", this);
-    m_expenseMonthLabel->setStyleSheet("font-size: 11pt; padding: 3px;");
+    AdobeStyles::setVariant(m_expenseMonthLabel, "stat");
     m_expenseMonthLabel->setWordWrap(false);
     expenseStatsLayout->addWidget(m_expenseMonthLabel);
     
     m_expenseYearLabel = new QLabel("This Year: <b>$0.00</b>", this);
-    m_expenseYearLabel->setStyleSheet("font-size: 11pt; padding: 3px;");
+    AdobeStyles::setVariant(m_expenseYearLabel, "stat");
     m_expenseYearLabel->setWordWrap(false);
     expenseStatsLayout->addWidget(m_expenseYearLabel);
     
     m_expenseAllTimeLabel = new QLabel("All Time: <b>$0.00</b>", this);
-    m_expenseAllTimeLabel->setStyleSheet("font-size: 13pt; font-weight: bold; color: " + AdobeStyles::WARNING_ORANGE + "; padding: 3px;");
+    AdobeStyles::setVariant(m_expenseAllTimeLabel, "metric");
+    AdobeStyles::setTone(m_expenseAllTimeLabel, "warning");
     m_expenseAllTimeLabel->setWordWrap(false);
     expenseStatsLayout->addWidget(m_expenseAllTimeLabel);
     
@@ -481,60 +382,8 @@ void DashboardWidget::createStatisticsSection()
     m_monthlyCalendar->setMinimumHeight(190);
     m_monthlyCalendar->setMaximumHeight(210);
     
-    m_monthlyCalendar->setStyleSheet(
-        "QCalendarWidget { "
-        "  background-color: white; "
-        "  border: 2px solid " + AdobeStyles::BORDER_GRAY + "; "
-        "  border-radius: 6px; "
-        "  padding: 3px; "
-        "} "
-        "QCalendarWidget QWidget { "
-        "  alternate-background-color: " + AdobeStyles::SURFACE_BG + "; "
-        "  background-color: white; "
-        "} "
-        "QCalendarWidget QAbstractItemView { "
-        "  selection-background-color: " + AdobeStyles::ADOBE_BLUE + "; "
-        "  selection-color: white; "
-        "  font-size: 9pt; "
-        "  border-radius: 3px; "
-        "} "
-        "QCalendarWidget QAbstractItemView:enabled { "
-        "  color: " + AdobeStyles::TEXT_PRIMARY + "; "
-        "} "
-        "QCalendarWidget QToolButton { "
-        "  color: white; "
-        "  background-color: " + AdobeStyles::ADOBE_BLUE + "; "
-        "  border-radius: 3px; "
-        "  padding: 3px; "
-        "  font-weight: bold; "
-        "  font-size: 9pt; "
-        "  min-width: 20px; "
-        "  margin: 1px; "
-        "} "
-        "QCalendarWidget QToolButton:hover { "
-        "  background-color: " + AdobeStyles::ADOBE_BLUE_LIGHT + "; "
-        "  color: white; "
-        "} "
-        "QCalendarWidget QToolButton:pressed { "
-        "  background-color: " + AdobeStyles::ADOBE_BLUE_DARK + "; "
-        "} "
-        "QCalendarWidget QMenu { "
-        "  background-color: white; "
-        "  border: 1px solid " + AdobeStyles::BORDER_GRAY + "; "
-        "} "
-        "QCalendarWidget QSpinBox { "
-        "  font-size: 9pt; "
-        "  padding: 2px; "
-        "} "
-        "QCalendarWidget QWidget#qt_calendar_navigationbar { "
-        "  background-color: " + AdobeStyles::ADOBE_BLUE + "; "
-        "  border-radius: 4px; "
-        "  padding: 1px; "
-        "} "
-        "QCalendarWidget QAbstractItemView:disabled { "
-        "  color: #cccccc; "
-        "}"
-    );
+    AdobeStyles::setVariant(m_monthlyCalendar, "compact");
+    connect(m_monthlyCalendar, &QCalendarWidget::currentPageChanged, this, &DashboardWidget::highlightMonth);
     
     // Add calendar to the statistics section, spanning both rows
     statsLayout->addWidget(m_monthlyCalendar, 0, 3, 2, 1, Qt::AlignTop | Qt::AlignRight);
@@ -553,17 +402,14 @@ void DashboardWidget::createTopSection()
     userInfoLayout->setSpacing(8);
     
     m_userNameLabel = new QLabel(QString("<b>Name:</b> %1").arg(m_userInfo.fullName), this);
-    m_userNameLabel->setStyleSheet("font-size: 14px;");
     userInfoLayout->addWidget(m_userNameLabel);
     
     m_userContactLabel = new QLabel(QString("<b>Contact:</b> %1").arg(
         m_userInfo.contactNumber.isEmpty() ? "N/A" : m_userInfo.contactNumber), this);
-    m_userContactLabel->setStyleSheet("font-size: 14px;");
     userInfoLayout->addWidget(m_userContactLabel);
     
     m_userRoleLabel = new QLabel(QString("<b>Position:</b> %1").arg(
         m_userInfo.role.isEmpty() ? "N/A" : m_userInfo.role), this);
-    m_userRoleLabel->setStyleSheet("font-size: 14px; padding-bottom: 10px;");
     userInfoLayout->addWidget(m_userRoleLabel);
     
     userInfoLayout->addStretch();
@@ -575,27 +421,21 @@ void DashboardWidget::createTopSection()
     alertsLayout->setSpacing(10);
     
     auto *emergencyLabel = new QLabel("<b style='color: red;'>🚨 EMERGENCIES</b>", this);
-    emergencyLabel->setStyleSheet("font-size: 14px;");
     alertsLayout->addWidget(emergencyLabel);
     
     m_emergenciesText = new QTextEdit(this);
     m_emergenciesText->setReadOnly(true);
     m_emergenciesText->setMaximumHeight(80);
-    m_emergenciesText->setStyleSheet(
-        "QTextEdit { background-color: #fff3cd; border: 1px solid #ffc107; padding: 5px; }"
-    );
+    AdobeStyles::setTone(m_emergenciesText, "warning");
     alertsLayout->addWidget(m_emergenciesText);
     
     auto *lowInventoryLabel = new QLabel("<b>⚠️ Low Inventory</b>", this);
-    lowInventoryLabel->setStyleSheet("font-size: 14px; margin-top: 5px;");
     alertsLayout->addWidget(lowInventoryLabel);
     
     m_lowInventoryText = new QTextEdit(this);
     m_lowInventoryText->setReadOnly(true);
     m_lowInventoryText->setMaximumHeight(80);
-    m_lowInventoryText->setStyleSheet(
-        "QTextEdit { background-color: #f8d7da; border: 1px solid #dc3545; padding: 5px; }"
-    );
+    AdobeStyles::setTone(m_lowInventoryText, "error");
     alertsLayout->addWidget(m_lowInventoryText);
     
     topLayout->addWidget(alertsBox, 2);
@@ -610,7 +450,7 @@ void DashboardWidget::createBottomSection()
     
     // ==================== LEFT: Upcoming Work Orders List ====================
     auto *ordersBox = createGroupBox("📋 Upcoming Work Orders");
-    ordersBox->setStyleSheet(AdobeStyles::GROUP_BOX_FIRE);
+    AdobeStyles::setVariant(ordersBox, "fire");
     auto *ordersLayout = new QVBoxLayout(ordersBox);
     
     // Simple scrollable list
@@ -618,15 +458,14 @@ void DashboardWidget::createBottomSection()
     ordersScroll->setWidgetResizable(true);
     ordersScroll->setFrameShape(QFrame::NoFrame);
     
-    m_upcomingOrdersTable = new QTableWidget(this);
-    m_upcomingOrdersTable->setColumnCount(3);
-    m_upcomingOrdersTable->setHorizontalHeaderLabels({"Date Received", "Client Name", "Contact #"});
+    upcomingOrdersModel()->setHeaders({"Date Received", "Client Name", "Contact #"});
+    m_upcomingOrdersTable = new QTableView(this);
+    m_upcomingOrdersTable->setModel(upcomingOrdersModel());
     m_upcomingOrdersTable->horizontalHeader()->setStretchLastSection(true);
     m_upcomingOrdersTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_upcomingOrdersTable->setSelectionBehavior(QAbstractItemView::SelectRows);
     m_upcomingOrdersTable->setAlternatingRowColors(true);
     m_upcomingOrdersTable->verticalHeader()->setVisible(false);
-    m_upcomingOrdersTable->setStyleSheet(AdobeStyles::TABLE_VIEW);
     m_upcomingOrdersTable->setShowGrid(false);
     ordersScroll->setWidget(m_upcomingOrdersTable);
     ordersLayout->addWidget(ordersScroll);
@@ -635,67 +474,18 @@ void DashboardWidget::createBottomSection()
     
     // ==================== CENTER: 2-Week Calendar ====================
     auto *twoWeekBox = createGroupBox("📅 Next 2 Weeks");
-    twoWeekBox->setStyleSheet(AdobeStyles::GROUP_BOX);
     auto *twoWeekLayout = new QVBoxLayout(twoWeekBox);
     
-    // Custom 2-week calendar display
-    auto *calendarScroll = new QScrollArea(this);
-    calendarScroll->setWidgetResizable(true);
-    calendarScroll->setFrameShape(QFrame::NoFrame);
-    
-    m_twoWeekCalendar = new QCalendarWidget(this);  // Will be replaced with custom widget
-    auto *calendarWidget = new QWidget(this);
-    auto *calendarContentLayout = new QVBoxLayout(calendarWidget);
-    calendarContentLayout->setSpacing(0);
-    
-    // Create 14-day list with zebra striping
-    QDate startDate = QDate::currentDate();
-    for (int i = 0; i < 14; i++) {
-        QDate date = startDate.addDays(i);
-        
-        // Zebra striping - alternating row colors
-        QString bgColor = (i % 2 == 0) ? AdobeStyles::CARD_BG : AdobeStyles::SURFACE_BG;
-        
-        // Day name label
-        auto *dayLabel = new QLabel(date.toString("dddd"), this);
-        dayLabel->setStyleSheet(
-            "font-size: 12pt; "
-            "font-weight: bold; "
-            "color: " + AdobeStyles::ADOBE_BLUE + "; "
-            "padding: 8px 10px 2px 10px; "
-            "background: " + bgColor + ";"
-        );
-        calendarContentLayout->addWidget(dayLabel);
-        
-        // Full date label
-        auto *dateLabel = new QLabel(date.toString("MMMM d, yyyy"), this);
-        dateLabel->setStyleSheet(
-            "font-size: 10pt; "
-            "color: " + AdobeStyles::TEXT_PRIMARY + "; "
-            "padding: 2px 10px 8px 10px; "
-            "background: " + bgColor + ";"
-        );
-        calendarContentLayout->addWidget(dateLabel);
-        
-        // Separator (only between rows, not after last row)
-        if (i < 13) {
-            auto *separator = new QFrame(this);
-            separator->setFrameShape(QFrame::HLine);
-            separator->setFrameShadow(QFrame::Sunken);
-            separator->setStyleSheet("background-color: " + AdobeStyles::BORDER_GRAY + "; min-height: 1px; max-height: 1px;");
-            calendarContentLayout->addWidget(separator);
-        }
-    }
-    
-    calendarContentLayout->addStretch();
-    calendarScroll->setWidget(calendarWidget);
-    twoWeekLayout->addWidget(calendarScroll);
+    // One painted widget for all 14 days
+    m_twoWeekSchedule = new TwoWeekScheduleWidget(this);
+    twoWeekLayout->addWidget(m_twoWeekSchedule);
+    twoWeekLayout->addStretch();
     
     bottomLayout->addWidget(twoWeekBox, 1);
     
     // ==================== RIGHT: Visual Inventory Display ====================
     auto *inventoryBox = createGroupBox("📦 Inventory At-A-Glance");
-    inventoryBox->setStyleSheet(AdobeStyles::GROUP_BOX_SUCCESS);
+    AdobeStyles::setVariant(inventoryBox, "success");
     auto *inventoryLayout = new QVBoxLayout(inventoryBox);
     inventoryLayout->setSpacing(8);
     inventoryLayout->setContentsMargins(15, 18, 15, 15);
@@ -711,12 +501,13 @@ void DashboardWidget::createBottomSection()
     
     // Wood - Split
     auto *splitLabel = new QLabel("<b>Split:</b>", this);
-    splitLabel->setStyleSheet("font-size: 8pt;");
+    AdobeStyles::setVariant(splitLabel, "fine");
     splitLabel->setMinimumWidth(65);
     splitLabel->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Preferred);
     m_splitWoodLabel = new QLabel("Loading...", this);
     m_splitWoodLabel->setTextFormat(Qt::RichText);
-    m_splitWoodLabel->setStyleSheet("font-size: 9pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + ";");
+    AdobeStyles::setVariant(m_splitWoodLabel, "reading");
+    AdobeStyles::setTone(m_splitWoodLabel, "success");
     m_splitWoodLabel->setMinimumWidth(140);
     m_splitWoodLabel->setWordWrap(true);
     m_splitWoodLabel->setAlignment(Qt::AlignRight | Qt::AlignVCenter);
@@ -726,12 +517,13 @@ void DashboardWidget::createBottomSection()
     
     // Wood - Not Split
     auto *unsplitLabel = new QLabel("<b>Rounds:</b>", this);
-    unsplitLabel->setStyleSheet("font-size: 8pt;");
+    AdobeStyles::setVariant(unsplitLabel, "fine");
     unsplitLabel->setMinimumWidth(65);
     unsplitLabel->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Preferred);
     m_roundsWoodLabel = new QLabel("Loading...", this);
     m_roundsWoodLabel->setTextFormat(Qt::RichText);
-    m_roundsWoodLabel->setStyleSheet("font-size: 9pt; font-weight: bold; color: " + AdobeStyles::WARNING_ORANGE + ";");
+    AdobeStyles::setVariant(m_roundsWoodLabel, "reading");
+    AdobeStyles::setTone(m_roundsWoodLabel, "warning");
     m_roundsWoodLabel->setMinimumWidth(140);
     m_roundsWoodLabel->setWordWrap(false);
     m_roundsWoodLabel->setAlignment(Qt::AlignRight | Qt::AlignVCenter);
@@ -758,11 +550,12 @@ void DashboardWidget::createBottomSection()
     gasGrid->setContentsMargins(10, 0, 10, 0);
     
     auto *regularGasLabel = new QLabel("<b>Regular:</b>", this);
-    regularGasLabel->setStyleSheet("font-size: 8pt;");
+    AdobeStyles::setVariant(regularGasLabel, "fine");
     regularGasLabel->setMinimumWidth(65);
     regularGasLabel->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Preferred);
     m_regularGasLabel = new QLabel("Loading...", this);
-    m_regularGasLabel->setStyleSheet("font-size: 9pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + ";");
+    AdobeStyles::setVariant(m_regularGasLabel, "reading");
+    AdobeStyles::setTone(m_regularGasLabel, "success");
     m_regularGasLabel->setMinimumWidth(100);
     m_regularGasLabel->setWordWrap(false);
     m_regularGasLabel->setAlignment(Qt::AlignRight | Qt::AlignVCenter);
@@ -771,11 +564,12 @@ void DashboardWidget::createBottomSection()
     gasGrid->addWidget(m_regularGasLabel, 0, 1);
     
     auto *mixedGasLabel = new QLabel("<b>Mixed:</b>", this);
-    mixedGasLabel->setStyleSheet("font-size: 8pt;");
+    AdobeStyles::setVariant(mixedGasLabel, "fine");
     mixedGasLabel->setMinimumWidth(65);
     mixedGasLabel->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Preferred);
     m_mixedGasLabel = new QLabel("Loading...", this);
-    m_mixedGasLabel->setStyleSheet("font-size: 9pt; font-weight: bold; color: " + AdobeStyles::WARNING_ORANGE + ";");
+    AdobeStyles::setVariant(m_mixedGasLabel, "reading");
+    AdobeStyles::setTone(m_mixedGasLabel, "warning");
     m_mixedGasLabel->setMinimumWidth(100);
     m_mixedGasLabel->setWordWrap(false);
     m_mixedGasLabel->setAlignment(Qt::AlignRight | Qt::AlignVCenter);
@@ -798,7 +592,8 @@ void DashboardWidget::createBottomSection()
     inventoryLayout->addSpacing(4);
     
     m_sawsLabel = new QLabel("Loading...", this);
-    m_sawsLabel->setStyleSheet("font-size: 9pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + "; padding-left: 10px;");
+    AdobeStyles::setVariant(m_sawsLabel, "reading");
+    AdobeStyles::setTone(m_sawsLabel, "success");
     m_sawsLabel->setMinimumWidth(140);
     m_sawsLabel->setWordWrap(false);
     m_sawsLabel->setAlignment(Qt::AlignRight | Qt::AlignVCenter);
@@ -819,29 +614,14 @@ QFrame* DashboardWidget::createSeparator()
     auto *sep = new QFrame(this);
     sep->setFrameShape(QFrame::HLine);
     sep->setFrameShadow(QFrame::Sunken);
-    sep->setStyleSheet("background-color: " + AdobeStyles::BORDER_GRAY + "; min-height: 1px; max-height: 1px; margin: 5px 0;");
+    AdobeStyles::setVariant(sep, "separator");
     return sep;
 }
 
 QGroupBox* DashboardWidget::createGroupBox(const QString &title)
 {
     auto *groupBox = new QGroupBox(title, this);
-    groupBox->setStyleSheet(
-        "QGroupBox {"
-        "    font-weight: bold;"
-        "    font-size: 14px;"
-        "    border: 2px solid #0078d4;"
-        "    border-radius: 5px;"
-        "    margin-top: 10px;"
-        "    padding-top: 10px;"
-        "}"
-        "QGroupBox::title {"
-        "    subcontrol-origin: margin;"
-        "    subcontrol-position: top left;"
-        "    padding: 0 5px;"
-        "    color: #0078d4;"
-        "}"
-    );
+    AdobeStyles::setVariant(groupBox, "fire");
     return groupBox;
 }
 
@@ -849,14 +629,15 @@ void DashboardWidget::loadStatistics()
 {
     // Calculate date ranges
     QDate today = QDate::currentDate();
-    QDate weekStart = today.addDays(-(today.dayOfWeek() - 1));  // Monday of this week
-    QDate monthStart = QDate(today.year(), today.month(), 1);
-    QDate yearStart = QDate(today.year(), 1, 1);
+    const DateRange week = DateRange::week(today);
+    const DateRange month = DateRange::month(today);
+    const DateRange year = DateRange::year(today);
+    const int completed = code(OrderStatus::Completed);
     
     // === TOTAL HOUSEHOLDS SERVED ===
     // Count distinct households that have received completed deliveries
     QSqlQuery householdQuery;
-    if (householdQuery.exec("SELECT COUNT(DISTINCT household_id) FROM orders WHERE status = 'Completed'")) {
+    if (householdQuery.exec(QString("SELECT COUNT(DISTINCT household_id) FROM orders WHERE status_code = %1").arg(completed))) {
         if (householdQuery.next()) {
             int totalHouseholds = householdQuery.value(0).toInt();
             m_totalHouseholdsLabel->setText(QString::number(totalHouseholds));
@@ -869,8 +650,9 @@ void DashboardWidget::loadStatistics()
     // === WOOD DELIVERED ===
     // Week
     QSqlQuery woodWeekQuery;
-    woodWeekQuery.prepare("SELECT COALESCE(SUM(delivered_cords), 0) FROM orders WHERE status = 'Completed' AND delivery_date >= ?");
-    woodWeekQuery.addBindValue(weekStart.toString(Qt::ISODate));
+    woodWeekQuery.prepare(QString("SELECT COALESCE(SUM(delivered_cords), 0) FROM orders WHERE status_code = %1 AND delivery_day >= ? AND delivery_day < ?").arg(completed));
+    woodWeekQuery.addBindValue(week.firstDay());
+    woodWeekQuery.addBindValue(week.endDay());
     if (woodWeekQuery.exec() && woodWeekQuery.next()) {
         double cords = woodWeekQuery.value(0).toDouble();
         m_woodDeliveredWeekLabel->setText(QString("This Week: <b>%1 cords</b>").arg(cords, 0, 'f', 1));
@@ -878,8 +660,9 @@ void DashboardWidget::loadStatistics()
     
     // Month
     QSqlQuery woodMonthQuery;
-    woodMonthQuery.prepare("SELECT COALESCE(SUM(delivered_cords), 0) FROM orders WHERE status = 'Completed' AND delivery_date >= ?");
-    woodMonthQuery.addBindValue(monthStart.toString(Qt::ISODate));
+    woodMonthQuery.prepare(QString("SELECT COALESCE(SUM(delivered_cords), 0) FROM orders WHERE status_code = %1 AND delivery_day >= ? AND delivery_day < ?").arg(completed));
+    woodMonthQuery.addBindValue(month.firstDay());
+    woodMonthQuery.addBindValue(month.endDay());
     if (woodMonthQuery.exec() && woodMonthQuery.next()) {
         double cords = woodMonthQuery.value(0).toDouble();
         m_woodDeliveredMonthLabel->setText(QString("This Month: <b>%1 cords</b>").arg(cords, 0, 'f', 1));
@@ -887,8 +670,9 @@ void DashboardWidget::loadStatistics()
     
     // Year
     QSqlQuery woodYearQuery;
-    woodYearQuery.prepare("SELECT COALESCE(SUM(delivered_cords), 0) FROM orders WHERE status = 'Completed' AND delivery_date >= ?");
-    woodYearQuery.addBindValue(yearStart.toString(Qt::ISODate));
+    woodYearQuery.prepare(QString("SELECT COALESCE(SUM(delivered_cords), 0) FROM orders WHERE status_code = %1 AND delivery_day >= ? AND delivery_day < ?").arg(completed));
+    woodYearQuery.addBindValue(year.firstDay());
+    woodYearQuery.addBindValue(year.endDay());
     if (woodYearQuery.exec() && woodYearQuery.next()) {
         double cords = woodYearQuery.value(0).toDouble();
         m_woodDeliveredYearLabel->setText(QString("This Year: <b>%1 cords</b>").arg(cords, 0, 'f', 1));
@@ -896,7 +680,7 @@ void DashboardWidget::loadStatistics()
     
     // All Time
     QSqlQuery woodAllQuery;
-    if (woodAllQuery.exec("SELECT COALESCE(SUM(delivered_cords), 0) FROM orders WHERE status = 'Completed'") && woodAllQuery.next()) {
+    if (woodAllQuery.exec(QString("SELECT COALESCE(SUM(delivered_cords), 0) FROM orders WHERE status_code = %1").arg(completed)) && woodAllQuery.next()) {
         double cords = woodAllQuery.value(0).toDouble();
         m_woodDeliveredAllTimeLabel->setText(QString("All Time: <b>%1 cords</b>").arg(cords, 0, 'f', 1));
     }
@@ -904,93 +688,94 @@ void DashboardWidget::loadStatistics()
     // === EXPENSES (based on amount_paid) ===
     // Week
     QSqlQuery expWeekQuery;
-    expWeekQuery.prepare("SELECT COALESCE(SUM(amount_paid), 0) FROM orders WHERE status = 'Completed' AND delivery_date >= ?");
-    expWeekQuery.addBindValue(weekStart.toString(Qt::ISODate));
+    expWeekQuery.prepare(QString("SELECT COALESCE(SUM(amount_paid_cents), 0) FROM orders WHERE status_code = %1 AND delivery_day >= ? AND delivery_day < ?").arg(completed));
+    expWeekQuery.addBindValue(week.firstDay());
+    expWeekQuery.addBindValue(week.endDay());
     if (expWeekQuery.exec() && expWeekQuery.next()) {
-        double amount = expWeekQuery.value(0).toDouble();
-        m_expenseWeekLabel->setText(QString("This Week: <b>$%1</b>").arg(amount, 0, 'f', 2));
+        const Money amount = Money::fromCents(expWeekQuery.value(0).toLongLong());
+        m_expenseWeekLabel->setText(QString("This Week: <b>%1</b>").arg(amount.format()));
     }
     
     // Month
     QSqlQuery expMonthQuery;
-    expMonthQuery.prepare("SELECT COALESCE(SUM(amount_paid), 0) FROM orders WHERE status = 'Completed' AND delivery_date >= ?");
-    expMonthQuery.addBindValue(monthStart.toString(Qt::ISODate));
+    expMonthQuery.prepare(QString("SELECT COALESCE(SUM(amount_paid_cents), 0) FROM orders WHERE status_code = %1 AND delivery_day >= ? AND delivery_day < ?").arg(completed));
+    expMonthQuery.addBindValue(month.firstDay());
+    expMonthQuery.addBindValue(month.endDay());
     if (expMonthQuery.exec() && expMonthQuery.next()) {
-        double amount = expMonthQuery.value(0).toDouble();
-        m_expenseMonthLabel->setText(QString("This Month: <b>$%1</b>").arg(amount, 0, 'f', 2));
+        const Money amount = Money::fromCents(expMonthQuery.value(0).toLongLong());
+        m_expenseMonthLabel->setText(QString("This Month: <b>%1</b>").arg(amount.format()));
     }
     
     // Year
     QSqlQuery expYearQuery;
-    expYearQuery.prepare("SELECT COALESCE(SUM(amount_paid), 0) FROM orders WHERE status = 'Completed' AND delivery_date >= ?");
-    expYearQuery.addBindValue(yearStart.toString(Qt::ISODate));
+    expYearQuery.prepare(QString("SELECT COALESCE(SUM(amount_paid_cents), 0) FROM orders WHERE status_code = %1 AND delivery_day >= ? AND delivery_day < ?").arg(completed));
+    expYearQuery.addBindValue(year.firstDay());
+    expYearQuery.addBindValue(year.endDay());
     if (expYearQuery.exec() && expYearQuery.next()) {
-        double amount = expYearQuery.value(0).toDouble();
-        m_expenseYearLabel->setText(QString("This Year: <b>$%1</b>").arg(amount, 0, 'f', 2));
+        const Money amount = Money::fromCents(expYearQuery.value(0).toLongLong());
+        m_expenseYearLabel->setText(QString("This Year: <b>%1</b>").arg(amount.format()));
     }
     
     // All Time
     QSqlQuery expAllQuery;
-    if (expAllQuery.exec("SELECT COALESCE(SUM(amount_paid), 0) FROM orders WHERE status = 'Completed'") && expAllQuery.next()) {
-        double amount = expAllQuery.value(0).toDouble();
-        m_expenseAllTimeLabel->setText(QString("All Time: <b>$%1</b>").arg(amount, 0, 'f', 2));
+    if (expAllQuery.exec(QString("SELECT COALESCE(SUM(amount_paid_cents), 0) FROM orders WHERE status_code = %1").arg(completed)) && expAllQuery.next()) {
+        const Money amount = Money::fromCents(expAllQuery.value(0).toLongLong());
+        m_expenseAllTimeLabel->setText(QString("All Time: <b>%1</b>").arg(amount.format()));
     }
     
     qDebug() << "Statistics loaded successfully for leads/admins";
 }
 
+ResultTableModel *DashboardWidget::upcomingOrdersModel()
+{
+    if (m_upcomingOrdersModel) {
+        return m_upcomingOrdersModel;
+    }
+    
+    m_upcomingOrdersModel = new ResultTableModel(this);
+    m_upcomingOrdersModel->setEmptyText("No upcoming orders scheduled");
+    m_upcomingOrdersModel->setFormatter(0, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        if (role == Qt::DisplayRole) {
+            const QString orderDate = model.text(row, 0);
+            const QDate date = QDate::fromString(orderDate, Qt::ISODate);
+            return date.isValid() ? date.toString("MMM d, yyyy") : orderDate;
+        }
+        return QVariant();
+    });
+    m_upcomingOrdersModel->setFormatter(2, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        if (role == Qt::DisplayRole && model.text(row, 2).isEmpty()) {
+            return QString("N/A");
+        }
+        return QVariant();
+    });
+    return m_upcomingOrdersModel;
+}
+
 void DashboardWidget::loadUpcomingOrders()
 {
     // Load actual orders from database
     QSqlQuery query;
-    if (!query.exec("SELECT o.id, o.order_date, h.name, h.phone, o.requested_cords, o.status "
-                   "FROM orders o "
-                   "JOIN households h ON o.household_id = h.id "
-                   "WHERE o.status IN ('Pending', 'Scheduled', 'In Progress') "
-                   "ORDER BY o.delivery_date, o.order_date "
-                   "LIMIT 10")) {
+    query.setForwardOnly(true);
+    if (!query.exec(QString("SELECT o.order_date, h.name, h.phone "
+                            "FROM orders o "
+                            "JOIN households h ON o.household_id = h.id "
+                            "WHERE o.status_code IN (%1) "
+                            "ORDER BY o.delivery_date, o.order_date "
+                            "LIMIT 10").arg(openOrderStatusCodeList()))) {
         qDebug() << "ERROR: Failed to load upcoming orders:" << query.lastError().text();
-        m_upcomingOrdersTable->setRowCount(1);
-        auto *messageItem = new QTableWidgetItem("Error loading orders");
-        m_upcomingOrdersTable->setItem(0, 0, messageItem);
-        m_upcomingOrdersTable->setSpan(0, 0, 1, 3);
-        return;
-    }
-    
-    m_upcomingOrdersTable->setRowCount(0);
-    int row = 0;
-    
-    while (query.next()) {
-        m_upcomingOrdersTable->insertRow(row);
-        
-        QString orderDate = query.value(1).toString();
-        QString clientName = query.value(2).toString();
-        QString contactNumber = query.value(3).toString();
-        
-        // Parse and format date
-        QDate date = QDate::fromString(orderDate, Qt::ISODate);
-        QString formattedDate = date.isValid() ? date.toString("MMM d, yyyy") : orderDate;
-        
-        m_upcomingOrdersTable->setItem(row, 0, new QTableWidgetItem(formattedDate));
-        m_upcomingOrdersTable->setItem(row, 1, new QTableWidgetItem(clientName));
-        m_upcomingOrdersTable->setItem(row, 2, new QTableWidgetItem(contactNumber.isEmpty() ? "N/A" : contactNumber));
-        
-        row++;
+        m_upcomingOrdersModel->setEmptyText("Error loading orders");
+        m_upcomingOrdersModel->clear();
+    } else {
+        m_upcomingOrdersModel->setEmptyText("No upcoming orders scheduled");
+        m_upcomingOrdersModel->load(query);
+        qDebug() << "Loaded" << m_upcomingOrdersModel->resultRowCount() << "upcoming orders";
     }
     
-    if (row == 0) {
-        m_upcomingOrdersTable->setRowCount(1);
-        auto *messageItem = new QTableWidgetItem("No upcoming orders scheduled");
-        messageItem->setTextAlignment(Qt::AlignCenter);
-        QFont font = messageItem->font();
-        font.setItalic(true);
-        messageItem->setFont(font);
-        messageItem->setForeground(QBrush(Qt::gray));
-        m_upcomingOrdersTable->setItem(0, 0, messageItem);
+    // The placeholder row spans the table
+    m_upcomingOrdersTable->clearSpans();
+    if (m_upcomingOrdersModel->showsEmptyText()) {
         m_upcomingOrdersTable->setSpan(0, 0, 1, 3);
     }
-    
-    qDebug() << "Loaded" << row << "upcoming orders";
 }
 
 void DashboardWidget::loadCurrentInventory()
@@ -1033,39 +818,132 @@ void DashboardWidget::loadEmergencies()
     // TODO: Query emergencies from database when implemented
     // For now, show placeholder or empty
     m_emergenciesText->setPlainText("No current emergencies");
-    m_emergenciesText->setStyleSheet(
-        "QTextEdit { background-color: #d4edda; border: 1px solid #28a745; padding: 5px; color: #155724; }"
-    );
+    AdobeStyles::setTone(m_emergenciesText, "success");
     
     qDebug() << "Loaded emergencies (placeholder)";
 }
 
 void DashboardWidget::loadLowInventory()
 {
-    // TODO: Query inventory below threshold when inventory system is fully implemented
-    // For now, show placeholder
-    m_lowInventoryText->setPlainText("All inventory levels adequate");
-    m_lowInventoryText->setStyleSheet(
-        "QTextEdit { background-color: #d4edda; border: 1px solid #28a745; padding: 5px; color: #155724; }"
-    );
-    
-    qDebug() << "Loaded low inventory alerts (placeholder)";
+    // Active alerts are maintained by triggers on inventory_items (migration 13),
+    // so this only reads the handful of rows that are currently low or critical
+    QSqlQuery query;
+    if (!query.exec("SELECT i.item_name, i.quantity, i.unit, s.level "
+                    "FROM inventory_alert_state s "
+                    "JOIN inventory_items i ON i.id = s.item_id "
+                    "WHERE s.level <> 'ok' "
+                    "ORDER BY s.level = 'critical' DESC, i.quantity ASC")) {
+        qDebug() << "ERROR: Failed to load low inventory alerts:" << query.lastError().text();
+        return;
+    }
+    
+    QStringList lines;
+    bool anyCritical = false;
+    while (query.next()) {
+        bool critical = query.value(3).toString() == "critical";
+        anyCritical = anyCritical || critical;
+        lines << QString("%1 %2: %3 %4")
+                     .arg(critical ? "🚨" : "⚠️")
+                     .arg(query.value(0).toString())
+                     .arg(query.value(1).toDouble())
+                     .arg(query.value(2).toString());
+    }
+    
+    if (lines.isEmpty()) {
+        m_lowInventoryText->setPlainText("All inventory levels adequate");
+        AdobeStyles::setTone(m_lowInventoryText, "success");
+    } else {
+        m_lowInventoryText->setPlainText(lines.join("\n"));
+        AdobeStyles::setTone(m_lowInventoryText, anyCritical ? "error" : "warning");
+    }
+    
+    qDebug() << "Loaded" << lines.size() << "low inventory alerts";
 }
 
 void DashboardWidget::updateMonthlyCalendar()
 {
-    // TODO: Highlight dates with scheduled orders/deliveries
-    // For now, just highlight today
-    QDate today = QDate::currentDate();
+    // The calendar is part of the statistics section, which not every role sees
+    if (!m_monthlyCalendar) return;
+    
+    highlightMonth(m_monthlyCalendar->yearShown(), m_monthlyCalendar->monthShown());
+}
+
+QHash<int, int> DashboardWidget::ordersPerDay(int year, int month)
+{
+    const int key = year * 12 + (month - 1);
+    const auto cached = m_orderDensityCache.constFind(key);
+    if (cached != m_orderDensityCache.constEnd()) {
+        return cached.value();
+    }
+    
+    const DateRange range = DateRange::month(QDate(year, month, 1));
+    
+    QSqlQuery query;
+    query.prepare(QString("SELECT delivery_day, COUNT(*) FROM orders "
+                          "WHERE delivery_day >= ? AND delivery_day < ? AND status_code <> %1 "
+                          "GROUP BY delivery_day").arg(code(OrderStatus::Cancelled)));
+    query.addBindValue(range.firstDay());
+    query.addBindValue(range.endDay());
+    
+    QHash<int, int> counts;
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to load orders per day:" << query.lastError().text();
+        return counts;
+    }
+    while (query.next()) {
+        counts.insert(QDate::fromJulianDay(query.value(0).toLongLong()).day(), query.value(1).toInt());
+    }
+    
+    m_orderDensityCache.insert(key, counts);
+    return counts;
+}
+
+void DashboardWidget::highlightMonth(int year, int month)
+{
+    if (!m_monthlyCalendar) return;
+    
+    // Any write to orders, from this window or another, bumps its data version
+    QSqlDatabase db = QSqlDatabase::database();
+    const qint64 version = firewood::db::dataVersion(db, "orders");
+    if (version < 0 || version != m_orderDensityVersion) {
+        m_orderDensityCache.clear();
+        m_orderDensityVersion = version;
+    }
+    
+    const QHash<int, int> counts = ordersPerDay(year, month);
+    int busiest = 0;
+    for (int count : counts) {
+        busiest = qMax(busiest, count);
+    }
     
-    QTextCharFormat format;
-    format.setBackground(QBrush(QColor(0, 120, 212, 100))); // Light blue
-    format.setForeground(QBrush(Qt::white));
-    format.setFontWeight(QFont::Bold);
+    // Clear the previous page, then shade each day by its share of the busiest day
+    m_monthlyCalendar->setDateTextFormat(QDate(), QTextCharFormat());
     
-    m_monthlyCalendar->setDateTextFormat(today, format);
+    const QColor heat(AdobeStyles::NMERA_PRIMARY);
+    for (auto it = counts.constBegin(); it != counts.constEnd(); ++it) {
+        const int level = (it.value() * 3 + busiest - 1) / busiest;  // 1 to 3
+        QColor shade = heat;
+        shade.setAlpha(60 + 60 * level);
+        
+        QTextCharFormat format;
+        format.setBackground(shade);
+        format.setForeground(QBrush(Qt::white));
+        format.setToolTip(QString("%1 %2").arg(it.value()).arg(it.value() == 1 ? "order" : "orders"));
+        m_monthlyCalendar->setDateTextFormat(QDate(year, month, it.key()), format);
+    }
     
-    qDebug() << "Updated monthly calendar"; 
+    // Today stays outlined in blue on top of its shade
+    const QDate today = QDate::currentDate();
+    QTextCharFormat todayFormat = m_monthlyCalendar->dateTextFormat(today);
+    if (!counts.contains(today.day()) || today.year() != year || today.month() != month) {
+        todayFormat.setBackground(QBrush(QColor(0, 120, 212, 100))); // Light blue
+        todayFormat.setForeground(QBrush(Qt::white));
+    }
+    todayFormat.setFontWeight(QFont::Bold);
+    todayFormat.setFontUnderline(true);
+    m_monthlyCalendar->setDateTextFormat(today, todayFormat);
+    
+    qDebug() << "Highlighted" << counts.size() << "days with orders in" << year << month;
 }
 
 void DashboardWidget::refreshData()
@@ -1073,7 +951,7 @@ void DashboardWidget::refreshData()
     qDebug() << "Refreshing all dashboard data...";
     
     // Reload all data
-    if (Authorization::isAdmin(m_userInfo.role) || Authorization::isLead(m_userInfo.role)) {
+    if (Authorization::hasPermission(m_role, Authorization::Permission::ViewAllReports)) {
         loadStatistics();
     }
     loadUpcomingOrders();
@@ -1084,6 +962,15 @@ void DashboardWidget::refreshData()
     updateMonthlyCalendar();
     checkInventoryAlerts();
     
+    // Roll the schedule forward after midnight, otherwise re-read the same days
+    if (m_twoWeekSchedule) {
+        if (m_twoWeekSchedule->startDate() != QDate::currentDate()) {
+            m_twoWeekSchedule->setStartDate(QDate::currentDate());
+        } else {
+            m_twoWeekSchedule->reload();
+        }
+    }
+    
     qDebug() << "Dashboard data refreshed!";
 }
 
@@ -1145,7 +1032,8 @@ void DashboardWidget::loadInventoryAtAGlance()
     double openRequested = 0.0;
     {
         QSqlQuery openQ;
-        openQ.prepare("SELECT COALESCE(SUM(requested_cords - delivered_cords), 0) FROM orders WHERE status IN ('Pending','Scheduled','In Progress')");
+        openQ.prepare(QString("SELECT COALESCE(SUM(requested_cords - delivered_cords), 0) FROM orders WHERE status_code IN (%1)")
+                          .arg(openOrderStatusCodeList()));
         if (openQ.exec() && openQ.next()) {
             openRequested = openQ.value(0).toDouble();
         } else {
@@ -1194,13 +1082,15 @@ void DashboardWidget::checkInventoryAlerts()
         m_inventoryAlertsWidget = nullptr;
     }
     
-    // Query for items that are low or critical
+    // Read only the currently active alerts from the trigger-maintained state table
     QSqlQuery query;
-    query.exec("SELECT item_name, quantity, unit, reorder_level, emergency_level "
-               "FROM inventory_items "
-               "WHERE (reorder_level > 0 AND quantity <= reorder_level) "
-               "OR (emergency_level > 0 AND quantity <= emergency_level) "
-               "ORDER BY quantity ASC");
+    if (!query.exec("SELECT i.item_name, i.quantity, i.unit, s.level, s.changed_at "
+                    "FROM inventory_alert_state s "
+                    "JOIN inventory_items i ON i.id = s.item_id "
+                    "WHERE s.level <> 'ok' "
+                    "ORDER BY i.quantity ASC")) {
+        qDebug() << "ERROR: Failed to load inventory alerts:" << query.lastError().text();
+    }
     
     QStringList alerts;
     QStringList criticalAlerts;
@@ -1209,14 +1099,17 @@ void DashboardWidget::checkInventoryAlerts()
         QString itemName = query.value(0).toString();
         double quantity = query.value(1).toDouble();
         QString unit = query.value(2).toString();
-        double reorderLevel = query.value(3).toDouble();
-        double emergencyLevel = query.value(4).toDouble();
+        QString level = query.value(3).toString();
+        QDateTime since = QDateTime::fromString(query.value(4).toString(), "yyyy-MM-dd HH:mm:ss");
         
         QString alertText = QString("%1: %2 %3 remaining").arg(itemName).arg(quantity).arg(unit);
+        if (since.isValid()) {
+            alertText += QString(" (since %1)").arg(since.toString("MMM d"));
+        }
         
-        if (emergencyLevel > 0 && quantity <= emergencyLevel) {
+        if (level == "critical") {
             criticalAlerts << QString("🚨 CRITICAL: %1").arg(alertText);
-        } else if (reorderLevel > 0 && quantity <= reorderLevel) {
+        } else {
             alerts << QString("⚠️ LOW: %1").arg(alertText);
         }
     }
@@ -1227,33 +1120,26 @@ void DashboardWidget::checkInventoryAlerts()
         auto *alertLayout = new QVBoxLayout(m_inventoryAlertsWidget);
         
         // Style the alert widget
-        m_inventoryAlertsWidget->setStyleSheet(
-            "QWidget { "
-            "  background-color: #ffebe0; "
-            "  border: 2px solid #ff6b35; "
-            "  border-radius: 8px; "
-            "  padding: 10px; "
-            "  margin: 5px; "
-            "}"
-        );
+        AdobeStyles::setVariant(m_inventoryAlertsWidget, "alertPanel");
         
         // Add title
         auto *titleLabel = new QLabel("⚠️ INVENTORY ALERTS", m_inventoryAlertsWidget);
-        titleLabel->setStyleSheet("font-weight: bold; color: #ff6b35; font-size: 12pt;");
+        AdobeStyles::setVariant(titleLabel, "strong");
+        AdobeStyles::setTone(titleLabel, "alert");
         titleLabel->setAlignment(Qt::AlignCenter);
         alertLayout->addWidget(titleLabel);
         
         // Add critical alerts first
         for (const QString &alert : criticalAlerts) {
             auto *alertLabel = new QLabel(alert, m_inventoryAlertsWidget);
-            alertLabel->setStyleSheet("color: #c1421e; font-weight: bold;");
+            AdobeStyles::setTone(alertLabel, "critical");
             alertLayout->addWidget(alertLabel);
         }
         
         // Add regular alerts
         for (const QString &alert : alerts) {
             auto *alertLabel = new QLabel(alert, m_inventoryAlertsWidget);
-            alertLabel->setStyleSheet("color: #d97732;");
+            AdobeStyles::setTone(alertLabel, "low");
             alertLayout->addWidget(alertLabel);
         }
         
@@ -4,9 +4,13 @@
 #include <QLabel>
 #include <QTextEdit>
 #include <QTableWidget>
+#include <QTableView>
 #include <QCalendarWidget>
 #include <QFrame>
 #include <QGroupBox>
+#include <QHash>
+#include <optional>
+#include "Codes.h"
 
 struct UserInfo {
     QString username;
@@ -38,11 +42,14 @@ private:
     void loadEmergencies();
     void loadLowInventory();
     void updateMonthlyCalendar();
+    void highlightMonth(int year, int month);
+    QHash<int, int> ordersPerDay(int year, int month);  // Day of month -> orders, cached per month
     void loadStatistics();  // NEW: Load statistics data
     void checkInventoryAlerts();  // NEW: Check for low inventory alerts
     
     // User info
     UserInfo m_userInfo;
+    std::optional<firewood::core::UserType> m_role;  // m_userInfo.role parsed once
     
     // Statistics widgets (for leads and admins)
     QLabel *m_totalHouseholdsLabel = nullptr;
@@ -64,9 +71,14 @@ private:
     QCalendarWidget *m_monthlyCalendar = nullptr;
     QWidget *m_inventoryAlertsWidget = nullptr;  // NEW: Inventory alerts widget
     
+    // Monthly calendar heatmap, keyed by year * 12 + month - 1
+    QHash<int, QHash<int, int>> m_orderDensityCache;
+    qint64 m_orderDensityVersion = -1;  // orders data version the cache was filled at
+    
     // Bottom section widgets
-    QTableWidget *m_upcomingOrdersTable = nullptr;
-    QCalendarWidget *m_twoWeekCalendar = nullptr;
+    QTableView *m_upcomingOrdersTable = nullptr;
+    class ResultTableModel *m_upcomingOrdersModel = nullptr;
+    class TwoWeekScheduleWidget *m_twoWeekSchedule = nullptr;
     QTableWidget *m_currentInventoryTable = nullptr;
     
     // Inventory At-A-Glance widgets
@@ -77,6 +89,7 @@ private:
     QLabel *m_sawsLabel = nullptr;
     
     void loadInventoryAtAGlance();  // Load real inventory data
+    class ResultTableModel *upcomingOrdersModel();
     
     QFrame* createSection(const QString &title, QWidget *content);
     QGroupBox* createGroupBox(const QString &title);
@@ -1,5 +1,7 @@
 #include "DeliveryLogDialog.h"
 #include "StyleSheet.h"
+#include "DateRange.h"
+#include "DeliveryLogModel.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QFormLayout>
@@ -9,6 +11,7 @@
 #include <QSqlError>
 #include <QMessageBox>
 #include <QFileDialog>
+#include <QFile>
 #include <QTextStream>
 #include <QDate>
 #include <QDebug>
@@ -32,35 +35,25 @@ void DeliveryLogDialog::setupUI()
 
   auto* headerLabel = new QLabel("🚚 <b>DELIVERY LOG</b> 🪵", this);
   headerLabel->setAlignment(Qt::AlignCenter);
-  headerLabel->setStyleSheet(
-    "background: qlineargradient(x1:0, y1:0, x2:1, y2:0, "
-    "stop:0 " + AdobeStyles::ADOBE_BLUE + ", "
-    "stop:1 " + AdobeStyles::ADOBE_BLUE_DARK + "); "
-    "color: white; font-size: 18pt; font-weight: bold; padding: 15px; "
-    "border-radius: 8px; margin-bottom: 10px;"
-  );
+  AdobeStyles::setVariant(headerLabel, "infoBanner");
   mainLayout->addWidget(headerLabel);
 
   auto* filtersGroup = new QGroupBox("📅 Filters", this);
-  filtersGroup->setStyleSheet(AdobeStyles::GROUP_BOX);
   auto* filtersLayout = new QHBoxLayout(filtersGroup);
 
   auto* dateFilterLayout = new QFormLayout();
   m_startDateEdit = new QDateEdit(QDate::currentDate().addMonths(-1), this);
   m_startDateEdit->setCalendarPopup(true);
-  m_startDateEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   dateFilterLayout->addRow("From:", m_startDateEdit);
 
   m_endDateEdit = new QDateEdit(QDate::currentDate(), this);
   m_endDateEdit->setCalendarPopup(true);
-  m_endDateEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   dateFilterLayout->addRow("To:", m_endDateEdit);
 
   filtersLayout->addLayout(dateFilterLayout);
 
   auto* driverLayout = new QFormLayout();
   m_driverFilterCombo = new QComboBox(this);
-  m_driverFilterCombo->setStyleSheet(AdobeStyles::COMBO_BOX);
   populateDriverFilter();
   driverLayout->addRow("Driver:", m_driverFilterCombo);
   filtersLayout->addLayout(driverLayout);
@@ -75,13 +68,13 @@ void DeliveryLogDialog::setupUI()
   }
 
   auto* applyButton = new QPushButton("🔍 Apply Filters", this);
-  applyButton->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+  AdobeStyles::setVariant(applyButton, "primary");
   applyButton->setMinimumHeight(40);
   connect(applyButton, &QPushButton::clicked, this, &DeliveryLogDialog::applyFilters);
   filtersLayout->addWidget(applyButton);
 
   auto* exportButton = new QPushButton("📊 Export to CSV", this);
-  exportButton->setStyleSheet(AdobeStyles::SECONDARY_BUTTON);
+  AdobeStyles::setVariant(exportButton, "secondary");
   exportButton->setMinimumHeight(40);
   connect(exportButton, &QPushButton::clicked, this, &DeliveryLogDialog::exportToCsv);
   filtersLayout->addWidget(exportButton);
@@ -89,33 +82,33 @@ void DeliveryLogDialog::setupUI()
   mainLayout->addWidget(filtersGroup);
 
   auto* statsGroup = new QGroupBox("📊 Summary Statistics", this);
-  statsGroup->setStyleSheet(AdobeStyles::GROUP_BOX_SUCCESS);
+  AdobeStyles::setVariant(statsGroup, "success");
   auto* statsLayout = new QHBoxLayout(statsGroup);
 
   m_deliveryCountLabel = new QLabel("<b>Deliveries:</b> 0", this);
-  m_deliveryCountLabel->setStyleSheet("font-size: 13pt; padding: 5px;");
+  AdobeStyles::setVariant(m_deliveryCountLabel, "metric");
   statsLayout->addWidget(m_deliveryCountLabel);
 
   m_totalMilesLabel = new QLabel("<b>Total Miles:</b> 0.0", this);
-  m_totalMilesLabel->setStyleSheet("font-size: 13pt; padding: 5px;");
+  AdobeStyles::setVariant(m_totalMilesLabel, "metric");
   statsLayout->addWidget(m_totalMilesLabel);
 
   m_totalCordsLabel = new QLabel("<b>Total Cords:</b> 0.0", this);
-  m_totalCordsLabel->setStyleSheet("font-size: 13pt; padding: 5px;");
+  AdobeStyles::setVariant(m_totalCordsLabel, "metric");
   statsLayout->addWidget(m_totalCordsLabel);
 
   mainLayout->addWidget(statsGroup);
 
-  m_logTable = new QTableWidget(this);
-  m_logTable->setColumnCount(9);
-  m_logTable->setHorizontalHeaderLabels({ "ID", "Driver", "Date", "Time", "Start Mi", "End Mi", "Miles", "Cords", "Client" });
+  // Rows arrive newest first, a page at a time, so header sorting is left off:
+  // it could only reorder the pages loaded so far
+  m_logModel = new DeliveryLogModel(this);
+  m_logTable = new QTableView(this);
+  m_logTable->setModel(m_logModel);
   m_logTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
   m_logTable->setSelectionBehavior(QAbstractItemView::SelectRows);
   m_logTable->setAlternatingRowColors(true);
-  m_logTable->setStyleSheet(AdobeStyles::TABLE_VIEW);
   m_logTable->horizontalHeader()->setStretchLastSection(true);
   m_logTable->verticalHeader()->setVisible(false);
-  m_logTable->setSortingEnabled(true);
 
   mainLayout->addWidget(m_logTable);
 
@@ -123,7 +116,7 @@ void DeliveryLogDialog::setupUI()
   buttonLayout->addStretch();
 
   auto* closeButton = new QPushButton("✅ Close", this);
-  closeButton->setStyleSheet(AdobeStyles::CANCEL_BUTTON);
+  AdobeStyles::setVariant(closeButton, "cancel");
   closeButton->setMinimumHeight(40);
   closeButton->setMinimumWidth(120);
   connect(closeButton, &QPushButton::clicked, this, &QDialog::accept);
@@ -145,53 +138,88 @@ void DeliveryLogDialog::populateDriverFilter()
 
 void DeliveryLogDialog::applyFilters()
 {
-  QString driverFilter = m_driverFilterCombo->currentData().toString();
-  QDate startDate = m_startDateEdit->date();
-  QDate endDate = m_endDateEdit->date();
+  const QString driverFilter = m_driverFilterCombo->currentData().toString();
+  m_logModel->setFilter(firewood::core::DateRange::between(m_startDateEdit->date(), m_endDateEdit->date()),
+                        driverFilter);
 
-  QSqlQuery query;
-  QString queryString = "SELECT id, driver, delivery_date, delivery_time, "
-    "start_mileage, end_mileage, total_miles, delivered_cords, client_name "
-    "FROM delivery_log WHERE delivery_date BETWEEN :start_date AND :end_date ";
+  // The table loads a page at a time as it scrolls; the totals cover every match
+  if (!m_logModel->select()) {
+    QMessageBox::critical(this, "Database Error", "Failed to filter delivery log.");
+    return;
+  }
 
-  if (!driverFilter.isEmpty()) {
-    queryString += "AND driver = :driver ";
+  bool ok = false;
+  const DeliveryLogModel::Totals totals = m_logModel->totals(&ok);
+  if (!ok) {
+    QMessageBox::critical(this, "Database Error", "Failed to total delivery log.");
   }
 
-  queryString += "ORDER BY delivery_date DESC, id DESC";
+  m_deliveryCountLabel->setText(QString("<b>Deliveries:</b> %1").arg(totals.deliveries));
+  m_totalMilesLabel->setText(QString("<b>Total Miles:</b> %1").arg(totals.miles, 0, 'f', 1));
+  m_totalCordsLabel->setText(QString("<b>Total Cords:</b> %1").arg(totals.cords, 0, 'f', 2));
+
+  qDebug() << "Filtered to" << totals.deliveries << "deliveries";
+}
+
+void DeliveryLogDialog::exportToCsv()
+{
+  QString fileName = QFileDialog::getSaveFileName(this,
+    "Export Delivery Log",
+    QString("delivery_log_%1.csv").arg(QDate::currentDate().toString("yyyy-MM-dd")),
+    "CSV Files (*.csv)");
+
+  if (fileName.isEmpty()) return;
 
-  query.prepare(queryString);
+  QFile file(fileName);
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+    QMessageBox::critical(this, "Export Error", "Could not open file for writing.");
+    return;
+  }
 
-  query.bindValue(":start_date", startDate.toString(Qt::ISODate));
-  query.bindValue(":end_date", endDate.toString(Qt::ISODate));
+  const QString driverFilter = m_driverFilterCombo->currentData().toString();
+  const firewood::core::DateRange range =
+    firewood::core::DateRange::between(m_startDateEdit->date(), m_endDateEdit->date());
+
+  // Export every matching row, not just the pages the table has loaded
+  QSqlQuery query;
+  query.setForwardOnly(true);
+  query.prepare(QString("SELECT driver, delivery_date, delivery_time, start_mileage, end_mileage, "
+                        "total_miles, delivered_cords, client_name "
+                        "FROM delivery_log WHERE %1delivery_day >= :first_day AND delivery_day < :end_day "
+                        "ORDER BY delivery_day DESC, id DESC")
+                  .arg(driverFilter.isEmpty() ? "" : "driver = :driver AND "));
   if (!driverFilter.isEmpty()) {
     query.bindValue(":driver", driverFilter);
   }
+  query.bindValue(":first_day", range.firstDay());
+  query.bindValue(":end_day", range.endDay());
 
   if (!query.exec()) {
-    QMessageBox::critical(this, "Database Error", "Failed to filter delivery log: " + query.lastError().text());
+    QMessageBox::critical(this, "Database Error", "Failed to export delivery log: " + query.lastError().text());
     return;
   }
 
-  m_logTable->setRowCount(0);
-  int row = 0;
-  double totalMiles = 0.0;
-  double totalCords = 0.0;
+  const auto quoted = [](QString text) {
+    return "\"" + text.replace('"', "\"\"") + "\"";
+  };
 
+  QTextStream out(&file);
+  out << "Driver,Date,Time,Start Mileage,End Mileage,Miles,Cords,Client\n";
+  int rows = 0;
   while (query.next()) {
-    m_logTable->insertRow(row);
-    // ... (data population is the same as before, so it is omitted for brevity)
-    row++;
+    out << quoted(query.value(0).toString()) << ","
+        << query.value(1).toString() << ","
+        << query.value(2).toString() << ","
+        << QString::number(query.value(3).toDouble(), 'f', 1) << ","
+        << QString::number(query.value(4).toDouble(), 'f', 1) << ","
+        << QString::number(query.value(5).toDouble(), 'f', 1) << ","
+        << QString::number(query.value(6).toDouble(), 'f', 2) << ","
+        << quoted(query.value(7).toString()) << "\n";
+    ++rows;
   }
 
-  m_deliveryCountLabel->setText(QString("<b>Deliveries:</b> %1").arg(row));
-  m_totalMilesLabel->setText(QString("<b>Total Miles:</b> %1").arg(totalMiles, 0, 'f', 1));
-  m_totalCordsLabel->setText(QString("<b>Total Cords:</b> %1").arg(totalCords, 0, 'f', 2));
+  file.close();
 
-  qDebug() << "Filtered to" << row << "deliveries";
-}
-
-void DeliveryLogDialog::exportToCsv()
-{
-  // ... (export logic is unchanged, so it is omitted for brevity)
+  QMessageBox::information(this, "Export Complete",
+                           QString("Exported %1 deliveries to:\n%2").arg(rows).arg(fileName));
 }
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <QDialog>
-#include <QTableWidget>
+#include <QTableView>
 #include <QDateEdit>
 #include <QPushButton>
 #include <QComboBox>
@@ -23,7 +23,8 @@ private:
   void setupUI();
   void populateDriverFilter();
 
-  QTableWidget* m_logTable = nullptr;
+  QTableView* m_logTable = nullptr;
+  class DeliveryLogModel* m_logModel = nullptr;
   QDateEdit* m_startDateEdit = nullptr;
   QDateEdit* m_endDateEdit = nullptr;
   QComboBox* m_driverFilterCombo = nullptr;
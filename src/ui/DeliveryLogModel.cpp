@@ -0,0 +1,218 @@
+#include "DeliveryLogModel.h"
+#include <QSqlDatabase>
+#include <QSqlError>
+#include <QDebug>
+
+using namespace firewood::core;
+
+DeliveryLogModel::DeliveryLogModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+void DeliveryLogModel::setFilter(const DateRange &range, const QString &driver)
+{
+    m_range = range;
+    m_driver = driver;
+}
+
+QSqlQuery *DeliveryLogModel::pageStatement(bool byDriver, bool continued)
+{
+    std::unique_ptr<QSqlQuery> &cached = m_statements[(byDriver ? 2 : 0) + (continued ? 1 : 0)];
+    if (cached) {
+        return cached.get();
+    }
+
+    QString sql = "SELECT id, delivery_day, driver, delivery_date, delivery_time, "
+                  "start_mileage, end_mileage, total_miles, delivered_cords, client_name "
+                  "FROM delivery_log WHERE ";
+    if (byDriver) {
+        sql += "driver = :driver AND ";
+    }
+    sql += "delivery_day >= :first_day AND delivery_day < :end_day ";
+    if (continued) {
+        sql += "AND (delivery_day, id) < (:after_day, :after_id) ";
+    }
+    sql += QString("ORDER BY delivery_day DESC, id DESC LIMIT %1").arg(PageSize);
+
+    auto query = std::make_unique<QSqlQuery>(QSqlDatabase::database());
+    query->setForwardOnly(true);
+    if (!query->prepare(sql)) {
+        qDebug() << "ERROR: Failed to prepare delivery log query:" << query->lastError().text();
+        return nullptr;
+    }
+    cached = std::move(query);
+    return cached.get();
+}
+
+bool DeliveryLogModel::select()
+{
+    beginResetModel();
+    m_rows.clear();
+    m_hasMore = false;
+    endResetModel();
+
+    return m_range.isValid() && loadPage();
+}
+
+bool DeliveryLogModel::loadPage()
+{
+    const bool continued = !m_rows.isEmpty();
+    QSqlQuery *query = pageStatement(!m_driver.isEmpty(), continued);
+    if (!query) {
+        m_hasMore = false;
+        return false;
+    }
+
+    if (!m_driver.isEmpty()) {
+        query->bindValue(":driver", m_driver);
+    }
+    query->bindValue(":first_day", m_range.firstDay());
+    if (continued) {
+        // Start the index range at the last day loaded; the row-value condition
+        // then skips only the rows of that day already seen
+        const Row &last = m_rows.last();
+        query->bindValue(":end_day", last.day + 1);
+        query->bindValue(":after_day", last.day);
+        query->bindValue(":after_id", last.id);
+    } else {
+        query->bindValue(":end_day", m_range.endDay());
+    }
+
+    if (!query->exec()) {
+        qDebug() << "ERROR: Failed to load delivery log:" << query->lastError().text();
+        m_hasMore = false;
+        return false;
+    }
+
+    QVector<Row> page;
+    page.reserve(PageSize);
+    while (query->next()) {
+        Row row;
+        row.id = query->value(0).toLongLong();
+        row.day = query->value(1).toLongLong();
+        row.driver = query->value(2).toString();
+        row.date = query->value(3).toString();
+        row.time = query->value(4).toString();
+        row.startMileage = query->value(5).toDouble();
+        row.endMileage = query->value(6).toDouble();
+        row.miles = query->value(7).toDouble();
+        row.cords = query->value(8).toDouble();
+        row.client = query->value(9).toString();
+        page.append(std::move(row));
+    }
+    query->finish();
+
+    // A short page is the last one
+    m_hasMore = page.size() == PageSize;
+
+    if (!page.isEmpty()) {
+        beginInsertRows(QModelIndex(), m_rows.size(), m_rows.size() + page.size() - 1);
+        m_rows.append(page);
+        endInsertRows();
+    }
+    return true;
+}
+
+DeliveryLogModel::Totals DeliveryLogModel::totals(bool *ok) const
+{
+    Totals totals;
+    if (ok) {
+        *ok = false;
+    }
+    if (!m_range.isValid()) {
+        return totals;
+    }
+
+    QSqlQuery query;
+    QString sql = "SELECT COUNT(*), COALESCE(SUM(total_miles), 0), COALESCE(SUM(delivered_cords), 0) "
+                  "FROM delivery_log WHERE ";
+    if (!m_driver.isEmpty()) {
+        sql += "driver = :driver AND ";
+    }
+    sql += "delivery_day >= :first_day AND delivery_day < :end_day";
+
+    query.prepare(sql);
+    if (!m_driver.isEmpty()) {
+        query.bindValue(":driver", m_driver);
+    }
+    query.bindValue(":first_day", m_range.firstDay());
+    query.bindValue(":end_day", m_range.endDay());
+
+    if (!query.exec() || !query.next()) {
+        qDebug() << "ERROR: Failed to total delivery log:" << query.lastError().text();
+        return totals;
+    }
+
+    totals.deliveries = query.value(0).toInt();
+    totals.miles = query.value(1).toDouble();
+    totals.cords = query.value(2).toDouble();
+    if (ok) {
+        *ok = true;
+    }
+    return totals;
+}
+
+int DeliveryLogModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+int DeliveryLogModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant DeliveryLogModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.size()) {
+        return QVariant();
+    }
+
+    const Row &row = m_rows[index.row()];
+    const int column = index.column();
+
+    if (role == Qt::TextAlignmentRole) {
+        const bool numeric = column == IdColumn || (column >= StartMileageColumn && column <= CordsColumn);
+        return QVariant::fromValue(Qt::Alignment((numeric ? Qt::AlignRight : Qt::AlignLeft) | Qt::AlignVCenter));
+    }
+    if (role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    switch (column) {
+    case IdColumn: return row.id;
+    case DriverColumn: return row.driver;
+    case DateColumn: return row.date;
+    case TimeColumn: return row.time;
+    case StartMileageColumn: return QString::number(row.startMileage, 'f', 1);
+    case EndMileageColumn: return QString::number(row.endMileage, 'f', 1);
+    case MilesColumn: return QString::number(row.miles, 'f', 1);
+    case CordsColumn: return QString::number(row.cords, 'f', 2);
+    case ClientColumn: return row.client;
+    default: return QVariant();
+    }
+}
+
+QVariant DeliveryLogModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    static const char *const headers[ColumnCount] = {
+        "ID", "Driver", "Date", "Time", "Start Mi", "End Mi", "Miles", "Cords", "Client"
+    };
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole && section >= 0 && section < ColumnCount) {
+        return QString(headers[section]);
+    }
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+bool DeliveryLogModel::canFetchMore(const QModelIndex &parent) const
+{
+    return !parent.isValid() && m_hasMore;
+}
+
+void DeliveryLogModel::fetchMore(const QModelIndex &parent)
+{
+    if (!parent.isValid() && m_hasMore) {
+        loadPage();
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "DateRange.h"
+#include <QAbstractTableModel>
+#include <QSqlQuery>
+#include <QVector>
+#include <array>
+#include <memory>
+
+/**
+ * @brief Delivery log rows for a date range and optional driver, loaded a page at a time
+ *
+ * Rows are read newest first over the (driver, delivery_day) or delivery_day
+ * index. Each page continues from the last row loaded (keyset paging on
+ * delivery_day and id), so the cost of a page does not grow with how far the
+ * view has scrolled. Views pull further pages through canFetchMore()/fetchMore().
+ * Totals for the whole filter come from totals(), one aggregate query.
+ */
+class DeliveryLogModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    enum Column {
+        IdColumn,
+        DriverColumn,
+        DateColumn,
+        TimeColumn,
+        StartMileageColumn,
+        EndMileageColumn,
+        MilesColumn,
+        CordsColumn,
+        ClientColumn,
+        ColumnCount
+    };
+
+    struct Totals {
+        int deliveries = 0;
+        double miles = 0.0;
+        double cords = 0.0;
+    };
+
+    static constexpr int PageSize = 200;
+
+    explicit DeliveryLogModel(QObject *parent = nullptr);
+    ~DeliveryLogModel() = default;
+
+    /**
+     * @brief Filter used by the next select(); an empty driver means all drivers
+     */
+    void setFilter(const firewood::core::DateRange &range, const QString &driver = QString());
+
+    /**
+     * @brief Drops loaded rows and loads the first page
+     * @return false if the query failed
+     */
+    bool select();
+
+    /**
+     * @brief Count, miles and cords over every row matching the filter
+     * @param ok Set to false if the query failed
+     */
+    Totals totals(bool *ok = nullptr) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
+
+private:
+    struct Row {
+        qint64 id = 0;
+        qint64 day = 0;
+        QString driver;
+        QString date;
+        QString time;
+        double startMileage = 0.0;
+        double endMileage = 0.0;
+        double miles = 0.0;
+        double cords = 0.0;
+        QString client;
+    };
+
+    QSqlQuery *pageStatement(bool byDriver, bool continued);
+    bool loadPage();
+
+    firewood::core::DateRange m_range;
+    QString m_driver;
+
+    // [by driver][continued after the last loaded row]
+    std::array<std::unique_ptr<QSqlQuery>, 4> m_statements;
+
+    QVector<Row> m_rows;
+    bool m_hasMore = false;
+};
@@ -0,0 +1,154 @@
+#include "DuplicateClientsDialog.h"
+#include "ClientDialog.h"
+#include "StyleSheet.h"
+#include "client_matching.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QPushButton>
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QSqlDatabase>
+#include <QDebug>
+
+namespace {
+
+// Each household takes two columns: name, then address and phone
+enum Column {
+  MatchColumn,
+  ReasonsColumn,
+  FirstNameColumn,
+  FirstDetailsColumn,
+  SecondNameColumn,
+  SecondDetailsColumn,
+  ColumnCount
+};
+
+QString details(const firewood::db::MatchedHousehold& household)
+{
+  QStringList parts;
+  if (!household.address.isEmpty()) {
+    parts << household.address.simplified();
+  }
+  if (!household.phone.isEmpty()) {
+    parts << household.phone;
+  }
+  return parts.join(" · ");
+}
+
+} // namespace
+
+DuplicateClientsDialog::DuplicateClientsDialog(QWidget* parent)
+  : QDialog(parent)
+{
+  setupUI();
+  scan();
+}
+
+void DuplicateClientsDialog::setupUI()
+{
+  setWindowTitle("Find Duplicate Clients");
+  resize(1100, 600);
+
+  auto* mainLayout = new QVBoxLayout(this);
+  mainLayout->setSpacing(15);
+  mainLayout->setContentsMargins(20, 20, 20, 20);
+
+  auto* headerLabel = new QLabel("👥 <b>LIKELY DUPLICATE HOUSEHOLDS</b>", this);
+  headerLabel->setAlignment(Qt::AlignCenter);
+  AdobeStyles::setVariant(headerLabel, "infoBanner");
+  mainLayout->addWidget(headerLabel);
+
+  auto* summaryLayout = new QHBoxLayout();
+  m_summaryLabel = new QLabel(this);
+  summaryLayout->addWidget(m_summaryLabel);
+  summaryLayout->addStretch();
+
+  auto* rescanButton = new QPushButton("🔍 Scan Again", this);
+  AdobeStyles::setVariant(rescanButton, "secondary");
+  connect(rescanButton, &QPushButton::clicked, this, &DuplicateClientsDialog::scan);
+  summaryLayout->addWidget(rescanButton);
+  mainLayout->addLayout(summaryLayout);
+
+  m_pairsTable = new QTableWidget(0, ColumnCount, this);
+  m_pairsTable->setHorizontalHeaderLabels({"Match", "Why", "Household", "Address / Phone",
+                                           "Possible Duplicate", "Address / Phone"});
+  m_pairsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  m_pairsTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+  m_pairsTable->setAlternatingRowColors(true);
+  m_pairsTable->verticalHeader()->setVisible(false);
+  m_pairsTable->horizontalHeader()->setStretchLastSection(true);
+  connect(m_pairsTable, &QTableWidget::cellDoubleClicked, this, &DuplicateClientsDialog::onPairDoubleClicked);
+  mainLayout->addWidget(m_pairsTable);
+
+  auto* hintLabel = new QLabel("Double-click a household to open it. Merge by moving orders and hours "
+                               "to the record you keep, then delete the other.", this);
+  hintLabel->setWordWrap(true);
+  mainLayout->addWidget(hintLabel);
+
+  auto* closeButton = new QPushButton("Close", this);
+  connect(closeButton, &QPushButton::clicked, this, &QDialog::accept);
+  auto* buttonLayout = new QHBoxLayout();
+  buttonLayout->addStretch();
+  buttonLayout->addWidget(closeButton);
+  mainLayout->addLayout(buttonLayout);
+}
+
+void DuplicateClientsDialog::scan()
+{
+  QApplication::setOverrideCursor(Qt::WaitCursor);
+  QElapsedTimer timer;
+  timer.start();
+
+  QSqlDatabase db = QSqlDatabase::database();
+  const QList<firewood::db::DuplicatePair> pairs = firewood::db::findLikelyDuplicates(db);
+  const qint64 elapsedMs = timer.elapsed();
+
+  m_pairsTable->setSortingEnabled(false);
+  m_pairsTable->setRowCount(pairs.size());
+  for (int row = 0; row < pairs.size(); ++row) {
+    const firewood::db::DuplicatePair& pair = pairs[row];
+
+    auto* matchItem = new QTableWidgetItem();
+    matchItem->setData(Qt::DisplayRole, qRound(pair.match.score * 100));
+    matchItem->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    m_pairsTable->setItem(row, MatchColumn, matchItem);
+    m_pairsTable->setItem(row, ReasonsColumn, new QTableWidgetItem(pair.match.reasons.join(", ")));
+
+    // Household ids ride on the name items, for opening them
+    auto* firstItem = new QTableWidgetItem(pair.first.name);
+    firstItem->setData(Qt::UserRole, pair.first.id);
+    firstItem->setToolTip(QString("Client #%1").arg(pair.first.id));
+    m_pairsTable->setItem(row, FirstNameColumn, firstItem);
+    m_pairsTable->setItem(row, FirstDetailsColumn, new QTableWidgetItem(details(pair.first)));
+
+    auto* secondItem = new QTableWidgetItem(pair.second.name);
+    secondItem->setData(Qt::UserRole, pair.second.id);
+    secondItem->setToolTip(QString("Client #%1").arg(pair.second.id));
+    m_pairsTable->setItem(row, SecondNameColumn, secondItem);
+    m_pairsTable->setItem(row, SecondDetailsColumn, new QTableWidgetItem(details(pair.second)));
+  }
+  m_pairsTable->setSortingEnabled(true);
+  m_pairsTable->resizeColumnsToContents();
+
+  m_summaryLabel->setText(QString("<b>%1</b> likely duplicate pair%2 (scanned in %3 ms)")
+    .arg(pairs.size())
+    .arg(pairs.size() == 1 ? "" : "s")
+    .arg(elapsedMs));
+
+  QApplication::restoreOverrideCursor();
+}
+
+void DuplicateClientsDialog::onPairDoubleClicked(int row, int column)
+{
+  const int nameColumn = column >= SecondNameColumn ? SecondNameColumn : FirstNameColumn;
+  const QTableWidgetItem* item = m_pairsTable->item(row, nameColumn);
+  if (!item) {
+    return;
+  }
+
+  ClientDialog dialog(item->data(Qt::UserRole).toInt(), this);
+  if (dialog.exec() == QDialog::Accepted) {
+    scan();
+  }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <QDialog>
+#include <QLabel>
+#include <QTableWidget>
+
+/**
+ * @brief Lists every pair of households that are likely the same one
+ *
+ * Runs firewood::db::findLikelyDuplicates over the whole client base.
+ * Double-clicking a household in a pair opens it for editing.
+ */
+class DuplicateClientsDialog : public QDialog {
+  Q_OBJECT
+
+public:
+  explicit DuplicateClientsDialog(QWidget* parent = nullptr);
+  ~DuplicateClientsDialog() = default;
+
+private slots:
+  void scan();
+  void onPairDoubleClicked(int row, int column);
+
+private:
+  void setupUI();
+
+  QTableWidget* m_pairsTable = nullptr;
+  QLabel* m_summaryLabel = nullptr;
+};
@@ -1,5 +1,6 @@
 #include "EmployeeDirectoryDialog.h"
 #include "DeliveryLogDialog.h" // Now we can use the enhanced dialog
+#include "ResultTableModel.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QHeaderView>
@@ -38,9 +39,11 @@ void EmployeeDirectoryDialog::setupUI()
 
   mainLayout->addLayout(searchLayout);
 
-  m_employeesTable = new QTableWidget(this);
-  m_employeesTable->setColumnCount(6);
-  m_employeesTable->setHorizontalHeaderLabels({ "ID", "Full Name", "Role", "Email", "Phone", "Availability" });
+  m_employeesModel = new ResultTableModel(this);
+  m_employeesModel->setHeaders({ "ID", "Full Name", "Role", "Email", "Phone", "Availability" });
+
+  m_employeesTable = new QTableView(this);
+  m_employeesTable->setModel(m_employeesModel);
   m_employeesTable->horizontalHeader()->setStretchLastSection(true);
   m_employeesTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
   m_employeesTable->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -50,7 +53,7 @@ void EmployeeDirectoryDialog::setupUI()
   m_employeesTable->setSortingEnabled(true);
   m_employeesTable->hideColumn(0);
 
-  connect(m_employeesTable, &QTableWidget::doubleClicked, this, &EmployeeDirectoryDialog::viewProfile);
+  connect(m_employeesTable, &QTableView::doubleClicked, this, &EmployeeDirectoryDialog::viewProfile);
 
   mainLayout->addWidget(m_employeesTable);
 
@@ -79,40 +82,30 @@ void EmployeeDirectoryDialog::setupUI()
 
 void EmployeeDirectoryDialog::loadEmployees()
 {
-  m_employeesTable->setRowCount(0);
-
-  QSqlQuery query("SELECT id, full_name, role, email, phone, availability "
+  QSqlQuery query;
+  query.setForwardOnly(true);
+  if (!query.exec("SELECT id, full_name, role, email, phone, availability "
     "FROM users WHERE (role = 'employee' OR role = 'admin' OR role = 'lead') AND active = 1 "
-    "ORDER BY role DESC, full_name");
-
-  if (!query.exec()) {
+    "ORDER BY role DESC, full_name")) {
+    m_employeesModel->clear();
     QMessageBox::critical(this, "Error", "Failed to load employees: " + query.lastError().text());
     return;
   }
 
-  int row = 0;
-  while (query.next()) {
-    m_employeesTable->insertRow(row);
-
-    m_employeesTable->setItem(row, 0, new QTableWidgetItem(query.value(0).toString()));
-    m_employeesTable->setItem(row, 1, new QTableWidgetItem(query.value(1).toString()));
-    // ... (rest of data population is unchanged)
-
-    row++;
-  }
-
+  m_employeesModel->load(query);
   m_employeesTable->resizeColumnsToContents();
+  searchEmployees();
 }
 
 void EmployeeDirectoryDialog::viewDeliveryHistory()
 {
-  if (m_employeesTable->currentRow() < 0) {
+  if (m_employeesTable->currentIndex().row() < 0) {
     QMessageBox::information(this, "No Selection", "Please select a driver to view their delivery history.");
     return;
   }
 
-  int row = m_employeesTable->currentRow();
-  QString driverName = m_employeesTable->item(row, 1)->text();
+  int row = m_employeesTable->currentIndex().row();
+  QString driverName = m_employeesModel->text(row, 1);
 
   // Create an instance of the DeliveryLogDialog, passing the driver's name to the constructor.
   // This will open the dialog pre-filtered for that driver.
@@ -124,7 +117,15 @@ void EmployeeDirectoryDialog::viewDeliveryHistory()
 
 void EmployeeDirectoryDialog::searchEmployees()
 {
-  // ... (functionality is unchanged)
+  const QString searchText = m_searchEdit->text().toLower();
+
+  for (int row = 0; row < m_employeesModel->resultRowCount(); ++row) {
+    // Name, email and phone
+    const bool match = m_employeesModel->text(row, 1).toLower().contains(searchText)
+      || m_employeesModel->text(row, 3).toLower().contains(searchText)
+      || m_employeesModel->text(row, 4).toLower().contains(searchText);
+    m_employeesTable->setRowHidden(row, !match);
+  }
 }
 
 void EmployeeDirectoryDialog::viewProfile()
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <QDialog>
-#include <QTableWidget>
+#include <QTableView>
 #include <QLineEdit>
 #include <QPushButton>
 
@@ -21,7 +21,8 @@ private slots:
 private:
   void setupUI();
 
-  QTableWidget* m_employeesTable = nullptr;
+  QTableView* m_employeesTable = nullptr;
+  class ResultTableModel* m_employeesModel = nullptr;
   QLineEdit* m_searchEdit = nullptr;
   QPushButton* m_viewButton = nullptr;
   QPushButton* m_deliveryHistoryButton = nullptr;
@@ -1,4 +1,5 @@
 #include "EquipmentMaintenanceDialog.h"
+#include "StyleSheet.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QFormLayout>
@@ -75,7 +76,7 @@ void EquipmentMaintenanceDialog::setupUI()
     // Service alert label
     m_serviceAlertLabel = new QLabel(this);
     m_serviceAlertLabel->setWordWrap(true);
-    m_serviceAlertLabel->setStyleSheet("QLabel { padding: 10px; border-radius: 5px; }");
+    AdobeStyles::setVariant(m_serviceAlertLabel, "notice");
     hoursLayout->addRow("", m_serviceAlertLabel);
     
     // Record service button
@@ -140,18 +141,15 @@ void EquipmentMaintenanceDialog::updateServiceAlert()
     
     if (hoursRemaining <= 0) {
         m_serviceAlertLabel->setText("⚠️ SERVICE OVERDUE!");
-        m_serviceAlertLabel->setStyleSheet("QLabel { background-color: #ffcccc; color: #cc0000; "
-                                          "padding: 10px; border-radius: 5px; font-weight: bold; }");
+        AdobeStyles::setTone(m_serviceAlertLabel, "error");
     } else if (hoursRemaining <= threshold) {
         m_serviceAlertLabel->setText(QString("⚠️ Service needed soon! %1 hours remaining")
                                      .arg(hoursRemaining, 0, 'f', 1));
-        m_serviceAlertLabel->setStyleSheet("QLabel { background-color: #ffffcc; color: #cc6600; "
-                                          "padding: 10px; border-radius: 5px; font-weight: bold; }");
+        AdobeStyles::setTone(m_serviceAlertLabel, "warning");
     } else {
         m_serviceAlertLabel->setText(QString("✓ Service in %1 hours")
                                      .arg(hoursRemaining, 0, 'f', 1));
-        m_serviceAlertLabel->setStyleSheet("QLabel { background-color: #ccffcc; color: #006600; "
-                                          "padding: 10px; border-radius: 5px; }");
+        AdobeStyles::setTone(m_serviceAlertLabel, "success");
     }
 }
 
@@ -1,5 +1,6 @@
 #include "ExpenseDialog.h"
 #include "StyleSheet.h"
+#include "Money.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QFormLayout>
@@ -34,7 +35,6 @@ void ExpenseDialog::setupUI()
 {
     setModal(true);
     setFixedSize(500, 600);
-    setStyleSheet(AdobeStyles::MAIN_WINDOW);
 
     auto *mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(20);
@@ -42,11 +42,7 @@ void ExpenseDialog::setupUI()
 
     // Header with firewood theme
     auto *headerLabel = new QLabel(AdobeStyles::ICON_MONEY + " Expense Entry", this);
-    headerLabel->setStyleSheet(
-        "font-size: 16pt; font-weight: bold; color: white; "
-        "background: " + AdobeStyles::GRADIENT_PRIMARY + "; "
-        "padding: 15px; border-radius: 10px; text-align: center;"
-    );
+    AdobeStyles::setVariant(headerLabel, "banner");
     headerLabel->setAlignment(Qt::AlignCenter);
     mainLayout->addWidget(headerLabel);
 
@@ -58,12 +54,10 @@ void ExpenseDialog::setupUI()
     // Date
     m_dateEdit = new QDateEdit(QDate::currentDate(), formGroup);
     m_dateEdit->setCalendarPopup(true);
-    m_dateEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow("Date:", m_dateEdit);
 
     // Category
     m_categoryCombo = new QComboBox(formGroup);
-    m_categoryCombo->setStyleSheet(AdobeStyles::COMBO_BOX);
     formLayout->addRow("Category:", m_categoryCombo);
 
     // Amount
@@ -71,19 +65,16 @@ void ExpenseDialog::setupUI()
     m_amountSpinBox->setRange(0.01, 999999.99);
     m_amountSpinBox->setDecimals(2);
     m_amountSpinBox->setPrefix("$");
-    m_amountSpinBox->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow("Amount:", m_amountSpinBox);
 
     // Description
     m_descriptionEdit = new QLineEdit(formGroup);
     m_descriptionEdit->setPlaceholderText("Brief description of the expense...");
-    m_descriptionEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow("Description:", m_descriptionEdit);
 
     // Vendor
     m_vendorEdit = new QLineEdit(formGroup);
     m_vendorEdit->setPlaceholderText("Store, company, or person paid...");
-    m_vendorEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow("Vendor:", m_vendorEdit);
 
     // Receipt file
@@ -91,10 +82,9 @@ void ExpenseDialog::setupUI()
     m_receiptPathEdit = new QLineEdit(formGroup);
     m_receiptPathEdit->setPlaceholderText("No receipt selected...");
     m_receiptPathEdit->setReadOnly(true);
-    m_receiptPathEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
     
     m_selectReceiptBtn = new QPushButton("📁 Browse", formGroup);
-    m_selectReceiptBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+    AdobeStyles::setVariant(m_selectReceiptBtn, "primary");
     connect(m_selectReceiptBtn, &QPushButton::clicked, this, &ExpenseDialog::selectReceiptFile);
     
     receiptLayout->addWidget(m_receiptPathEdit);
@@ -104,14 +94,12 @@ void ExpenseDialog::setupUI()
     // Payment method
     m_paymentMethodCombo = new QComboBox(formGroup);
     m_paymentMethodCombo->addItems({"cash", "check", "card", "bank_transfer", "other"});
-    m_paymentMethodCombo->setStyleSheet(AdobeStyles::COMBO_BOX);
     formLayout->addRow("Payment Method:", m_paymentMethodCombo);
 
     // Notes
     m_notesEdit = new QTextEdit(formGroup);
     m_notesEdit->setPlaceholderText("Additional notes or details...");
     m_notesEdit->setMaximumHeight(80);
-    m_notesEdit->setStyleSheet(AdobeStyles::TEXT_EDIT);
     formLayout->addRow("Notes:", m_notesEdit);
 
     mainLayout->addWidget(formGroup);
@@ -121,13 +109,13 @@ void ExpenseDialog::setupUI()
     buttonLayout->addStretch();
 
     m_cancelBtn = new QPushButton("❌ Cancel", this);
-    m_cancelBtn->setStyleSheet(AdobeStyles::CANCEL_BUTTON);
+    AdobeStyles::setVariant(m_cancelBtn, "cancel");
     m_cancelBtn->setMinimumHeight(40);
     connect(m_cancelBtn, &QPushButton::clicked, this, &QDialog::reject);
     buttonLayout->addWidget(m_cancelBtn);
 
     m_saveBtn = new QPushButton("💾 Save Expense", this);
-    m_saveBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+    AdobeStyles::setVariant(m_saveBtn, "primary");
     m_saveBtn->setMinimumHeight(40);
     m_saveBtn->setDefault(true);
     connect(m_saveBtn, &QPushButton::clicked, this, &ExpenseDialog::accept);
@@ -284,7 +272,7 @@ void ExpenseDialog::saveExpense()
     
     query.bindValue(":date", m_dateEdit->date().toString(Qt::ISODate));
     query.bindValue(":category", m_categoryCombo->currentData().toString());
-    query.bindValue(":amount", m_amountSpinBox->value());
+    query.bindValue(":amount", firewood::core::Money::fromDouble(m_amountSpinBox->value()).toDouble());
     query.bindValue(":description", m_descriptionEdit->text().trimmed());
     query.bindValue(":vendor", m_vendorEdit->text().trimmed());
     query.bindValue(":receipt", m_receiptPathEdit->text().trimmed());
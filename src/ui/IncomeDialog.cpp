@@ -1,5 +1,6 @@
 #include "IncomeDialog.h"
 #include "StyleSheet.h"
+#include "Money.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QFormLayout>
@@ -31,7 +32,6 @@ void IncomeDialog::setupUI()
 {
     setModal(true);
     setFixedSize(500, 550);
-    setStyleSheet(AdobeStyles::MAIN_WINDOW);
 
     auto *mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(20);
@@ -39,11 +39,7 @@ void IncomeDialog::setupUI()
 
     // Header with firewood theme
     auto *headerLabel = new QLabel(AdobeStyles::ICON_MONEY + " Income Entry", this);
-    headerLabel->setStyleSheet(
-        "font-size: 16pt; font-weight: bold; color: white; "
-        "background: " + AdobeStyles::GRADIENT_PRIMARY + "; "
-        "padding: 15px; border-radius: 10px; text-align: center;"
-    );
+    AdobeStyles::setVariant(headerLabel, "banner");
     headerLabel->setAlignment(Qt::AlignCenter);
     mainLayout->addWidget(headerLabel);
 
@@ -55,12 +51,10 @@ void IncomeDialog::setupUI()
     // Date
     m_dateEdit = new QDateEdit(QDate::currentDate(), formGroup);
     m_dateEdit->setCalendarPopup(true);
-    m_dateEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow("Date:", m_dateEdit);
 
     // Source
     m_sourceCombo = new QComboBox(formGroup);
-    m_sourceCombo->setStyleSheet(AdobeStyles::COMBO_BOX);
     connect(m_sourceCombo, QOverload<int>::of(&QComboBox::currentIndexChanged), 
             this, &IncomeDialog::onSourceChanged);
     formLayout->addRow("Source:", m_sourceCombo);
@@ -70,37 +64,31 @@ void IncomeDialog::setupUI()
     m_amountSpinBox->setRange(0.01, 999999.99);
     m_amountSpinBox->setDecimals(2);
     m_amountSpinBox->setPrefix("$");
-    m_amountSpinBox->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow("Amount:", m_amountSpinBox);
 
     // Description
     m_descriptionEdit = new QLineEdit(formGroup);
     m_descriptionEdit->setPlaceholderText("Brief description of the income...");
-    m_descriptionEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow("Description:", m_descriptionEdit);
 
     // Donor name (for donations)
     m_donorNameEdit = new QLineEdit(formGroup);
     m_donorNameEdit->setPlaceholderText("Name of donor or organization...");
-    m_donorNameEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow("Donor/Source Name:", m_donorNameEdit);
 
     // Tax deductible checkbox
     m_taxDeductibleCheck = new QCheckBox("This income is tax deductible for the donor", formGroup);
     m_taxDeductibleCheck->setChecked(true); // Default to true for non-profits
-    m_taxDeductibleCheck->setStyleSheet("QCheckBox { font-size: 10pt; }");
     formLayout->addRow("", m_taxDeductibleCheck);
 
     // Receipt issued checkbox
     m_receiptIssuedCheck = new QCheckBox("Receipt has been issued to donor", formGroup);
-    m_receiptIssuedCheck->setStyleSheet("QCheckBox { font-size: 10pt; }");
     formLayout->addRow("", m_receiptIssuedCheck);
 
     // Notes
     m_notesEdit = new QTextEdit(formGroup);
     m_notesEdit->setPlaceholderText("Additional notes or details...");
     m_notesEdit->setMaximumHeight(80);
-    m_notesEdit->setStyleSheet(AdobeStyles::TEXT_EDIT);
     formLayout->addRow("Notes:", m_notesEdit);
 
     mainLayout->addWidget(formGroup);
@@ -110,13 +98,13 @@ void IncomeDialog::setupUI()
     buttonLayout->addStretch();
 
     m_cancelBtn = new QPushButton("❌ Cancel", this);
-    m_cancelBtn->setStyleSheet(AdobeStyles::CANCEL_BUTTON);
+    AdobeStyles::setVariant(m_cancelBtn, "cancel");
     m_cancelBtn->setMinimumHeight(40);
     connect(m_cancelBtn, &QPushButton::clicked, this, &QDialog::reject);
     buttonLayout->addWidget(m_cancelBtn);
 
     m_saveBtn = new QPushButton("💾 Save Income", this);
-    m_saveBtn->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+    AdobeStyles::setVariant(m_saveBtn, "primary");
     m_saveBtn->setMinimumHeight(40);
     m_saveBtn->setDefault(true);
     connect(m_saveBtn, &QPushButton::clicked, this, &IncomeDialog::accept);
@@ -265,7 +253,7 @@ void IncomeDialog::saveIncome()
     
     query.bindValue(":date", m_dateEdit->date().toString(Qt::ISODate));
     query.bindValue(":source", m_sourceCombo->currentData().toString());
-    query.bindValue(":amount", m_amountSpinBox->value());
+    query.bindValue(":amount", firewood::core::Money::fromDouble(m_amountSpinBox->value()).toDouble());
     query.bindValue(":description", m_descriptionEdit->text().trimmed());
     query.bindValue(":donor", m_donorNameEdit->text().trimmed());
     query.bindValue(":tax_deductible", m_taxDeductibleCheck->isChecked() ? 1 : 0);
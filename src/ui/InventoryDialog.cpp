@@ -1,4 +1,5 @@
 #include "InventoryDialog.h"
+#include "StyleSheet.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QFormLayout>
@@ -75,7 +76,7 @@ void InventoryDialog::setupUI()
     
     // Alert Levels
     auto *alertSpacer = new QLabel("<hr><b>📊 Inventory Alerts</b>", this);
-    alertSpacer->setStyleSheet("color: #d97732; padding-top: 10px;");
+    AdobeStyles::setTone(alertSpacer, "low");
     itemLayout->addRow("", alertSpacer);
     
     m_reorderLevelEdit = new QDoubleSpinBox(this);
@@ -83,7 +84,7 @@ void InventoryDialog::setupUI()
     m_reorderLevelEdit->setSingleStep(1.0);
     m_reorderLevelEdit->setDecimals(2);
     m_reorderLevelEdit->setToolTip("Quantity at which to reorder (yellow alert)");
-    m_reorderLevelEdit->setStyleSheet("QDoubleSpinBox { padding: 8px; font-size: 11pt; }");
+    AdobeStyles::setVariant(m_reorderLevelEdit, "compact");
     itemLayout->addRow("⚠️ Reorder Level:", m_reorderLevelEdit);
     
     m_emergencyLevelEdit = new QDoubleSpinBox(this);
@@ -91,7 +92,7 @@ void InventoryDialog::setupUI()
     m_emergencyLevelEdit->setSingleStep(1.0);
     m_emergencyLevelEdit->setDecimals(2);
     m_emergencyLevelEdit->setToolTip("Critical quantity level (red alert)");
-    m_emergencyLevelEdit->setStyleSheet("QDoubleSpinBox { padding: 8px; font-size: 11pt; }");
+    AdobeStyles::setVariant(m_emergencyLevelEdit, "compact");
     itemLayout->addRow("🚨 Emergency Level:", m_emergencyLevelEdit);
     
     auto *alertHelpLabel = new QLabel(
@@ -99,7 +100,7 @@ void InventoryDialog::setupUI()
         "Leave at 0 to disable alerts for this item.</i></small>", this
     );
     alertHelpLabel->setWordWrap(true);
-    alertHelpLabel->setStyleSheet("color: #6b7280; padding: 5px 0px;");
+    AdobeStyles::setTone(alertHelpLabel, "muted");
     itemLayout->addRow("", alertHelpLabel);
     
     mainLayout->addWidget(itemGroup);
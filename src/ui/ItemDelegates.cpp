@@ -0,0 +1,278 @@
+#include "ItemDelegates.h"
+#include "StyleSheet.h"
+#include "Codes.h"
+#include "Money.h"
+#include <QApplication>
+#include <QPainter>
+#include <QStyle>
+#include <QWidget>
+#include <optional>
+
+using namespace firewood::core;
+
+namespace {
+
+constexpr int CellPadding = 4;
+
+// Code for stored text, parsed once per distinct spelling
+template <typename Enum>
+int cachedCode(QHash<QString, int> &codes, const QString &text, std::optional<Enum> (*parse)(const QString &))
+{
+    const auto found = codes.constFind(text);
+    if (found != codes.constEnd()) {
+        return found.value();
+    }
+    const std::optional<Enum> parsed = parse(text);
+    const int value = parsed ? code(*parsed) : 0;
+    codes.insert(text, value);
+    return value;
+}
+
+// Same text as Money::format(), written into a reused buffer
+void formatMoney(QString &out, qint64 cents)
+{
+    const qint64 absolute = cents < 0 ? -cents : cents;
+    out.resize(0);
+    if (cents < 0) {
+        out += QLatin1Char('-');
+    }
+    out += QLatin1Char('$');
+
+    char digits[20];
+    int count = 0;
+    qint64 whole = absolute / 100;
+    do {
+        digits[count++] = static_cast<char>('0' + whole % 10);
+        whole /= 10;
+    } while (whole > 0);
+    for (int i = count - 1; i >= 0; --i) {
+        out += QLatin1Char(digits[i]);
+        if (i > 0 && i % 3 == 0) {
+            out += QLatin1Char(',');
+        }
+    }
+
+    out += QLatin1Char('.');
+    out += QLatin1Char(static_cast<char>('0' + (absolute % 100) / 10));
+    out += QLatin1Char(static_cast<char>('0' + absolute % 10));
+}
+
+bool isYes(const QVariant &value)
+{
+    if (value.typeId() == QMetaType::QString) {
+        const QString text = value.toString().trimmed();
+        return text.compare(QLatin1String("yes"), Qt::CaseInsensitive) == 0
+            || text.compare(QLatin1String("true"), Qt::CaseInsensitive) == 0
+            || text == QLatin1String("1");
+    }
+    return value.toBool();
+}
+
+QPixmap markPixmap(bool yes, qreal devicePixelRatio)
+{
+    constexpr int size = 14;
+    QPixmap pixmap(QSize(size, size) * devicePixelRatio);
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(QPen(QColor(yes ? AdobeStyles::SUCCESS_GREEN : AdobeStyles::TEXT_MUTED), 2.2,
+                        Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
+    if (yes) {
+        const QPointF check[] = {{3.0, 7.5}, {6.0, 10.5}, {11.0, 4.0}};
+        painter.drawPolyline(check, 3);
+    } else {
+        painter.drawLine(QPointF(4.0, 4.0), QPointF(10.0, 10.0));
+        painter.drawLine(QPointF(10.0, 4.0), QPointF(4.0, 10.0));
+    }
+    return pixmap;
+}
+
+} // namespace
+
+void FastItemDelegate::drawPanel(QPainter *painter, const QStyleOptionViewItem &option) const
+{
+    const QWidget *widget = option.widget;
+    QStyle *style = widget ? widget->style() : QApplication::style();
+    style->drawPrimitive(QStyle::PE_PanelItemViewItem, &option, painter, widget);
+}
+
+const QPen &FastItemDelegate::textPen(const QStyleOptionViewItem &option) const
+{
+    const bool selected = option.state & QStyle::State_Selected;
+    QPen &pen = selected ? m_selectedTextPen : m_textPen;
+    const QColor &color = selected ? option.palette.highlightedText().color() : option.palette.text().color();
+    // Only changes when the palette does
+    if (pen.color() != color) {
+        pen.setColor(color);
+    }
+    return pen;
+}
+
+StatusBadgeDelegate::StatusBadgeDelegate(QObject *parent)
+    : FastItemDelegate(parent),
+      m_badgeTextPen(Qt::white)
+{
+    m_fills[code(OrderStatus::Pending)] = QBrush(QColor(AdobeStyles::WARNING_ORANGE));
+    m_fills[code(OrderStatus::Scheduled)] = QBrush(QColor(AdobeStyles::ADOBE_BLUE));
+    m_fills[code(OrderStatus::InProgress)] = QBrush(QColor(AdobeStyles::INFO_CYAN));
+    m_fills[code(OrderStatus::Completed)] = QBrush(QColor(AdobeStyles::SUCCESS_GREEN));
+    m_fills[code(OrderStatus::Cancelled)] = QBrush(QColor(AdobeStyles::TEXT_MUTED));
+}
+
+void StatusBadgeDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    drawPanel(painter, option);
+
+    const QString text = index.data(Qt::DisplayRole).toString();
+    if (text.isEmpty()) {
+        return;
+    }
+    const int status = cachedCode<OrderStatus>(m_codes, text, parseOrderStatus);
+
+    const QRect cell = option.rect.adjusted(CellPadding, 3, -CellPadding, -3);
+    const QPen oldPen = painter->pen();
+    const QFont oldFont = painter->font();
+    painter->setFont(option.font);
+
+    if (status == 0) {
+        painter->setPen(textPen(option));
+        painter->drawText(cell, Qt::AlignLeft | Qt::AlignVCenter, text);
+        painter->setPen(oldPen);
+        painter->setFont(oldFont);
+        return;
+    }
+
+    const int width = qMin(cell.width(), option.fontMetrics.horizontalAdvance(text) + 2 * 8);
+    const QRect badge(cell.left(), cell.top(), width, cell.height());
+    const qreal radius = badge.height() / 2.0;
+
+    const QBrush oldBrush = painter->brush();
+    const bool antialiased = painter->testRenderHint(QPainter::Antialiasing);
+    painter->setRenderHint(QPainter::Antialiasing, true);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(m_fills[status]);
+    painter->drawRoundedRect(badge, radius, radius);
+    painter->setRenderHint(QPainter::Antialiasing, antialiased);
+
+    painter->setPen(m_badgeTextPen);
+    painter->drawText(badge, Qt::AlignCenter, text);
+
+    painter->setBrush(oldBrush);
+    painter->setPen(oldPen);
+    painter->setFont(oldFont);
+}
+
+PriorityDelegate::PriorityDelegate(QObject *parent)
+    : FastItemDelegate(parent)
+{
+    m_dots[code(OrderPriority::Low)] = QBrush(QColor(AdobeStyles::TEXT_MUTED));
+    m_dots[code(OrderPriority::Normal)] = QBrush(QColor(AdobeStyles::SUCCESS_GREEN));
+    m_dots[code(OrderPriority::High)] = QBrush(QColor(AdobeStyles::WARNING_ORANGE));
+    m_dots[code(OrderPriority::Emergency)] = QBrush(QColor(AdobeStyles::ERROR_RED));
+}
+
+void PriorityDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    drawPanel(painter, option);
+
+    const QString text = index.data(Qt::DisplayRole).toString();
+    if (text.isEmpty()) {
+        return;
+    }
+    const int priority = cachedCode<OrderPriority>(m_codes, text, parseOrderPriority);
+
+    if (option.font != m_font) {
+        m_font = option.font;
+        m_boldFont = option.font;
+        m_boldFont.setBold(true);
+    }
+
+    QRect textRect = option.rect.adjusted(CellPadding, 0, -CellPadding, 0);
+    const QPen oldPen = painter->pen();
+    const QBrush oldBrush = painter->brush();
+    const QFont oldFont = painter->font();
+
+    if (priority != 0) {
+        constexpr int dot = 8;
+        const QRect dotRect(textRect.left(), textRect.center().y() - dot / 2, dot, dot);
+        const bool antialiased = painter->testRenderHint(QPainter::Antialiasing);
+        painter->setRenderHint(QPainter::Antialiasing, true);
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(m_dots[priority]);
+        painter->drawEllipse(dotRect);
+        painter->setRenderHint(QPainter::Antialiasing, antialiased);
+        textRect.setLeft(dotRect.right() + 1 + CellPadding + 2);
+    }
+
+    painter->setFont(priority == code(OrderPriority::Emergency) ? m_boldFont : m_font);
+    painter->setPen(textPen(option));
+    painter->drawText(textRect, Qt::AlignLeft | Qt::AlignVCenter, text);
+
+    painter->setBrush(oldBrush);
+    painter->setPen(oldPen);
+    painter->setFont(oldFont);
+}
+
+MoneyDelegate::MoneyDelegate(Unit unit, QObject *parent)
+    : FastItemDelegate(parent),
+      m_unit(unit),
+      m_negativePen(QColor(AdobeStyles::ERROR_RED))
+{
+}
+
+void MoneyDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    drawPanel(painter, option);
+
+    const QVariant value = index.data(Qt::DisplayRole);
+    if (value.isNull()) {
+        return;
+    }
+    const qint64 cents = m_unit == Unit::Cents ? value.toLongLong()
+                                               : Money::fromDouble(value.toDouble()).cents();
+    formatMoney(m_text, cents);
+
+    const QPen oldPen = painter->pen();
+    const QFont oldFont = painter->font();
+    painter->setFont(option.font);
+    const bool selected = option.state & QStyle::State_Selected;
+    painter->setPen(cents < 0 && !selected ? m_negativePen : textPen(option));
+    painter->drawText(option.rect.adjusted(CellPadding, 0, -CellPadding, 0),
+                      Qt::AlignRight | Qt::AlignVCenter, m_text);
+    painter->setPen(oldPen);
+    painter->setFont(oldFont);
+}
+
+YesNoDelegate::YesNoDelegate(QObject *parent)
+    : FastItemDelegate(parent)
+{
+}
+
+void YesNoDelegate::updatePixmaps(qreal devicePixelRatio) const
+{
+    if (devicePixelRatio == m_devicePixelRatio) {
+        return;
+    }
+    m_devicePixelRatio = devicePixelRatio;
+    m_yes = markPixmap(true, devicePixelRatio);
+    m_no = markPixmap(false, devicePixelRatio);
+}
+
+void YesNoDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    drawPanel(painter, option);
+
+    const QVariant value = index.data(Qt::DisplayRole);
+    if (value.isNull()) {
+        return;
+    }
+
+    updatePixmaps(painter->device() ? painter->device()->devicePixelRatioF() : 1.0);
+    const QPixmap &mark = isYes(value) ? m_yes : m_no;
+    const QSize size = mark.deviceIndependentSize().toSize();
+    const QPoint topLeft(option.rect.center().x() - size.width() / 2 + 1,
+                         option.rect.center().y() - size.height() / 2 + 1);
+    painter->drawPixmap(topLeft, mark);
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <QStyledItemDelegate>
+#include <QBrush>
+#include <QPen>
+#include <QPixmap>
+#include <QFont>
+#include <QHash>
+#include <array>
+
+/**
+ * @brief Delegates that paint common column kinds straight from the model value
+ *
+ * Each keeps the pens, brushes and pixmaps it needs from construction (or the
+ * first paint) and maps stored text to a code through a small cache, so painting
+ * a cell draws the item panel, a shape and a line of text without creating
+ * style options, fonts or brushes. Editing and sorting still use the raw value.
+ */
+
+/**
+ * @brief Shared painting helpers: the item panel and a cached text pen
+ */
+class FastItemDelegate : public QStyledItemDelegate {
+    Q_OBJECT
+
+public:
+    using QStyledItemDelegate::QStyledItemDelegate;
+
+protected:
+    /**
+     * @brief Selection and alternate-row background, as the default delegate draws it
+     */
+    void drawPanel(QPainter *painter, const QStyleOptionViewItem &option) const;
+
+    /**
+     * @brief Pen for plain cell text in the option's palette and selection state
+     */
+    const QPen &textPen(const QStyleOptionViewItem &option) const;
+
+private:
+    mutable QPen m_textPen;
+    mutable QPen m_selectedTextPen;
+};
+
+/**
+ * @brief Order status as a rounded colour badge ("Pending", "Completed", ...)
+ *
+ * Text that is not a known status is drawn plain.
+ */
+class StatusBadgeDelegate : public FastItemDelegate {
+    Q_OBJECT
+
+public:
+    explicit StatusBadgeDelegate(QObject *parent = nullptr);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+    // Indexed by OrderStatus code; 0 is unknown text
+    std::array<QBrush, 6> m_fills;
+    QPen m_badgeTextPen;
+    mutable QHash<QString, int> m_codes;
+};
+
+/**
+ * @brief Order priority as a colour dot and the priority text; emergencies in bold
+ */
+class PriorityDelegate : public FastItemDelegate {
+    Q_OBJECT
+
+public:
+    explicit PriorityDelegate(QObject *parent = nullptr);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+    // Indexed by OrderPriority code; 0 is unknown text
+    std::array<QBrush, 5> m_dots;
+    mutable QHash<QString, int> m_codes;
+    mutable QFont m_font;                   // Font the bold copy was made from
+    mutable QFont m_boldFont;
+};
+
+/**
+ * @brief Right-aligned currency ("$1,234.50"); negative amounts in red
+ */
+class MoneyDelegate : public FastItemDelegate {
+    Q_OBJECT
+
+public:
+    enum class Unit { Dollars, Cents };
+
+    explicit MoneyDelegate(Unit unit = Unit::Dollars, QObject *parent = nullptr);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+    Unit m_unit;
+    QPen m_negativePen;
+    mutable QString m_text;                 // Reused for every cell
+};
+
+/**
+ * @brief Flag columns (1/0, true/false, "Yes"/"No") as a check or a cross, centered
+ */
+class YesNoDelegate : public FastItemDelegate {
+    Q_OBJECT
+
+public:
+    explicit YesNoDelegate(QObject *parent = nullptr);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+    void updatePixmaps(qreal devicePixelRatio) const;
+
+    mutable QPixmap m_yes;
+    mutable QPixmap m_no;
+    mutable qreal m_devicePixelRatio = 0;
+};
@@ -0,0 +1,192 @@
+#include "LedgerTableModel.h"
+#include <QSqlDatabase>
+#include <QSqlError>
+#include <QDebug>
+#include <algorithm>
+
+using namespace firewood::core;
+
+namespace {
+
+bool lessThan(const QVariant &left, const QVariant &right)
+{
+    if (left.isNull() || right.isNull()) {
+        return left.isNull() && !right.isNull();
+    }
+    const int leftType = left.typeId();
+    const int rightType = right.typeId();
+    const auto isNumber = [](int type) {
+        return type == QMetaType::Int || type == QMetaType::LongLong || type == QMetaType::Double;
+    };
+    if (isNumber(leftType) && isNumber(rightType)) {
+        return left.toDouble() < right.toDouble();
+    }
+    return QString::localeAwareCompare(left.toString(), right.toString()) < 0;
+}
+
+} // namespace
+
+LedgerTableModel::LedgerTableModel(const QString &table, const QString &categoryColumn,
+                                   const QStringList &columns, QObject *parent)
+    : QAbstractTableModel(parent),
+      m_table(table),
+      m_categoryColumn(categoryColumn),
+      m_columns(columns),
+      m_headers(columns)
+{
+}
+
+void LedgerTableModel::setFilter(const DateRange &range, const QString &category)
+{
+    m_range = range;
+    m_category = category;
+}
+
+QSqlQuery *LedgerTableModel::statement(int kind)
+{
+    std::unique_ptr<QSqlQuery> &cached = m_statements[kind];
+    if (cached) {
+        return cached.get();
+    }
+
+    QStringList conditions;
+    if (kind & InCategory) {
+        conditions << m_categoryColumn + " = :category";
+    }
+    if (kind & InRange) {
+        conditions << "day >= :first_day AND day < :end_day";
+    }
+
+    QString sql = QString("SELECT %1 FROM %2").arg(m_columns.join(", "), m_table);
+    if (!conditions.isEmpty()) {
+        sql += " WHERE " + conditions.join(" AND ");
+    }
+    sql += " ORDER BY day DESC";
+
+    auto query = std::make_unique<QSqlQuery>(QSqlDatabase::database());
+    query->setForwardOnly(true);
+    if (!query->prepare(sql)) {
+        qDebug() << "ERROR: Failed to prepare" << m_table << "query:" << query->lastError().text();
+        return nullptr;
+    }
+    cached = std::move(query);
+    return cached.get();
+}
+
+bool LedgerTableModel::select()
+{
+    beginResetModel();
+    m_rows.clear();
+
+    const int kind = (m_range.isValid() ? InRange : 0) | (m_category.isEmpty() ? 0 : InCategory);
+    QSqlQuery *query = statement(kind);
+    if (!query) {
+        endResetModel();
+        return false;
+    }
+
+    if (kind & InCategory) {
+        query->bindValue(":category", m_category);
+    }
+    if (kind & InRange) {
+        query->bindValue(":first_day", m_range.firstDay());
+        query->bindValue(":end_day", m_range.endDay());
+    }
+
+    if (!query->exec()) {
+        qDebug() << "ERROR: Failed to load" << m_table << ":" << query->lastError().text();
+        endResetModel();
+        return false;
+    }
+
+    const int columns = m_columns.size();
+    while (query->next()) {
+        QVector<QVariant> row(columns);
+        for (int column = 0; column < columns; ++column) {
+            row[column] = query->value(column);
+        }
+        m_rows.append(std::move(row));
+    }
+    // Keep the statement prepared but release its read cursor
+    query->finish();
+
+    sortRows();
+    endResetModel();
+    return true;
+}
+
+int LedgerTableModel::idAt(int row) const
+{
+    if (row < 0 || row >= m_rows.size()) {
+        return -1;
+    }
+    return m_rows[row][0].toInt();
+}
+
+int LedgerTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+int LedgerTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_columns.size();
+}
+
+QVariant LedgerTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || (role != Qt::DisplayRole && role != Qt::EditRole)) {
+        return QVariant();
+    }
+    return m_rows[index.row()][index.column()];
+}
+
+QVariant LedgerTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole && section >= 0 && section < m_headers.size()) {
+        return m_headers[section];
+    }
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+bool LedgerTableModel::setHeaderData(int section, Qt::Orientation orientation, const QVariant &value, int role)
+{
+    if (orientation != Qt::Horizontal || (role != Qt::EditRole && role != Qt::DisplayRole)
+        || section < 0 || section >= m_headers.size()) {
+        return false;
+    }
+    m_headers[section] = value.toString();
+    emit headerDataChanged(orientation, section, section);
+    return true;
+}
+
+void LedgerTableModel::sort(int column, Qt::SortOrder order)
+{
+    if (column < 0 || column >= m_columns.size()) {
+        return;
+    }
+    m_sortColumn = column;
+    m_sortOrder = order;
+
+    // Reset rather than remap persistent indexes; the selection is cleared
+    beginResetModel();
+    sortRows();
+    endResetModel();
+}
+
+void LedgerTableModel::sortRows()
+{
+    if (m_sortColumn < 0) {
+        return;
+    }
+    const int column = m_sortColumn;
+    if (m_sortOrder == Qt::AscendingOrder) {
+        std::stable_sort(m_rows.begin(), m_rows.end(), [column](const QVector<QVariant> &a, const QVector<QVariant> &b) {
+            return lessThan(a[column], b[column]);
+        });
+    } else {
+        std::stable_sort(m_rows.begin(), m_rows.end(), [column](const QVector<QVariant> &a, const QVector<QVariant> &b) {
+            return lessThan(b[column], a[column]);
+        });
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "DateRange.h"
+#include <QAbstractTableModel>
+#include <QSqlQuery>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+#include <array>
+#include <memory>
+
+/**
+ * @brief Read-only rows of the expenses or income table, filtered by bound parameters
+ *
+ * The filter is a date range on the day column and an optional category (the
+ * expenses category or income source). Each combination of the two has one
+ * statement, prepared on first use and then only re-bound, so changing the filter
+ * never builds or compiles SQL and any category text is safe. Rows come back
+ * newest first from the (category, day) and day indexes; header sorting is done
+ * in memory. Edits go through the expense and income dialogs by id.
+ */
+class LedgerTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    /**
+     * @param table expenses or income
+     * @param categoryColumn Column the category filter applies to
+     * @param columns Columns to show; the first must be the id
+     */
+    LedgerTableModel(const QString &table, const QString &categoryColumn,
+                     const QStringList &columns, QObject *parent = nullptr);
+    ~LedgerTableModel() = default;
+
+    /**
+     * @brief Filter used by the next select(); an invalid range or empty category means all
+     */
+    void setFilter(const firewood::core::DateRange &range, const QString &category = QString());
+
+    /**
+     * @brief Re-runs the statement for the current filter
+     * @return false if the query failed; the model is then empty
+     */
+    bool select();
+
+    int idAt(int row) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    bool setHeaderData(int section, Qt::Orientation orientation, const QVariant &value,
+                       int role = Qt::EditRole) override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+private:
+    enum Statement {
+        AllRows = 0,
+        InRange = 1,
+        InCategory = 2,
+        InRangeAndCategory = InRange | InCategory
+    };
+
+    QSqlQuery *statement(int kind);
+    void sortRows();
+
+    QString m_table;
+    QString m_categoryColumn;
+    QStringList m_columns;
+    QStringList m_headers;
+
+    firewood::core::DateRange m_range;
+    QString m_category;
+    std::array<std::unique_ptr<QSqlQuery>, 4> m_statements;
+
+    QVector<QVector<QVariant>> m_rows;
+    int m_sortColumn = -1;
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+};
@@ -17,14 +17,6 @@ LoginDialog::LoginDialog(QWidget *parent)
     setWindowTitle("🌲 Firewood Bank - Login 🔥");
     setModal(true);
     setFixedSize(650, 500);
-    
-    // Apply warm background
-    setStyleSheet(
-        "QDialog { background-color: " + AdobeStyles::SURFACE_BG + "; }" +
-        AdobeStyles::LINE_EDIT + 
-        AdobeStyles::PRIMARY_BUTTON +
-        AdobeStyles::CANCEL_BUTTON
-    );
 }
 
 void LoginDialog::setupUI()
@@ -42,18 +34,12 @@ void LoginDialog::setupUI()
         "</div>"
     );
     headerLabel->setAlignment(Qt::AlignCenter);
-    headerLabel->setStyleSheet(
-        "background: " + AdobeStyles::GRADIENT_PRIMARY + "; "
-        "color: white; "
-        "border-radius: 10px; "
-        "padding: 25px 20px; "
-        "margin-bottom: 15px;"
-    );
+    AdobeStyles::setVariant(headerLabel, "banner");
     mainLayout->addWidget(headerLabel);
     
     auto *subtitleLabel = new QLabel("Please log in to continue", this);
     subtitleLabel->setAlignment(Qt::AlignCenter);
-    subtitleLabel->setStyleSheet("color: " + AdobeStyles::TEXT_PRIMARY + "; font-size: 11pt; padding: 8px;");
+    AdobeStyles::setTone(subtitleLabel, "primary");
     mainLayout->addWidget(subtitleLabel);
     
     mainLayout->addSpacing(10);
@@ -68,32 +54,25 @@ void LoginDialog::setupUI()
     formLayout->setContentsMargins(0, 20, 0, 20);
     
     auto *usernameLabel = new QLabel("Username:", this);
-    usernameLabel->setStyleSheet("font-size: 11pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + "; padding-right: 10px;");
+    AdobeStyles::setVariant(usernameLabel, "strong");
+    AdobeStyles::setTone(usernameLabel, "success");
     m_usernameEdit = new QLineEdit(this);
     m_usernameEdit->setPlaceholderText("Enter username");
-    m_usernameEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow(usernameLabel, m_usernameEdit);
     
     auto *passwordLabel = new QLabel("Password:", this);
-    passwordLabel->setStyleSheet("font-size: 11pt; font-weight: bold; color: " + AdobeStyles::SUCCESS_GREEN + "; padding-right: 10px;");
+    AdobeStyles::setVariant(passwordLabel, "strong");
+    AdobeStyles::setTone(passwordLabel, "success");
     m_passwordEdit = new QLineEdit(this);
     m_passwordEdit->setEchoMode(QLineEdit::Password);
     m_passwordEdit->setPlaceholderText("Enter password");
-    m_passwordEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
     formLayout->addRow(passwordLabel, m_passwordEdit);
     
     mainLayout->addLayout(formLayout);
     
     // Error label
     m_errorLabel = new QLabel(this);
-    m_errorLabel->setStyleSheet(
-        "color: white; "
-        "background-color: " + AdobeStyles::ERROR_RED + "; "
-        "padding: 12px; "
-        "border-radius: 6px; "
-        "font-size: 10pt; "
-        "font-weight: bold;"
-    );
+    AdobeStyles::setVariant(m_errorLabel, "error");
     m_errorLabel->setAlignment(Qt::AlignCenter);
     m_errorLabel->setWordWrap(true);
     m_errorLabel->hide();
@@ -108,14 +87,14 @@ void LoginDialog::setupUI()
     m_cancelButton = new QPushButton(AdobeStyles::ICON_ERROR + " Cancel", this);
     m_cancelButton->setProperty("class", "cancel");
     m_cancelButton->setMinimumWidth(180);
-    m_cancelButton->setStyleSheet(AdobeStyles::CANCEL_BUTTON);
+    AdobeStyles::setVariant(m_cancelButton, "cancel");
     buttonLayout->addWidget(m_cancelButton);
     
     m_loginButton = new QPushButton(AdobeStyles::ICON_SUCCESS + " Login", this);
     m_loginButton->setProperty("class", "primary");
     m_loginButton->setMinimumWidth(180);
     m_loginButton->setDefault(true);
-    m_loginButton->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+    AdobeStyles::setVariant(m_loginButton, "primary");
     buttonLayout->addWidget(m_loginButton);
     
     mainLayout->addLayout(buttonLayout);
@@ -173,7 +152,9 @@ bool LoginDialog::validateCredentials(const QString &username, const QString &pa
     qDebug() << "Password hash:" << QString::fromLatin1(passwordHash);
     
     QSqlQuery query(db);
-    query.prepare("SELECT username, role FROM users WHERE username = :username AND password_hash = :password_hash AND active = 1");
+    query.prepare("SELECT a.username, a.role FROM user_accounts a "
+                  "JOIN user_credentials c ON c.user_id = a.id "
+                  "WHERE a.username = :username AND c.password_hash = :password_hash AND a.active = 1");
     query.bindValue(":username", username);
     query.bindValue(":password_hash", QString::fromLatin1(passwordHash));
     
@@ -184,7 +165,7 @@ bool LoginDialog::validateCredentials(const QString &username, const QString &pa
     
     // Debug: Check what users exist in the database
     QSqlQuery debugQuery(db);
-    if (debugQuery.exec("SELECT username, role, active FROM users")) {
+    if (debugQuery.exec("SELECT username, role, active FROM user_accounts")) {
         qDebug() << "Available users in database:";
         while (debugQuery.next()) {
             qDebug() << "  Username:" << debugQuery.value(0).toString() 
@@ -203,6 +184,14 @@ bool LoginDialog::validateCredentials(const QString &username, const QString &pa
     return false;
 }
 
+bool LoginDialog::loginWith(const QString &username, const QString &password)
+{
+    m_usernameEdit->setText(username);
+    m_passwordEdit->setText(password);
+    onLoginClicked();
+    return result() == QDialog::Accepted;
+}
+
 QString LoginDialog::getUsername() const
 {
     return m_loggedInUsername;
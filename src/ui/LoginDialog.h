@@ -15,6 +15,13 @@ public:
     QString getUsername() const;
     QString getRole() const;
 
+    /**
+     * @brief Signs in with the given credentials without showing the dialog
+     *
+     * Used by the headless startup benchmark; returns true if accepted.
+     */
+    bool loginWith(const QString &username, const QString &password);
+
 private slots:
     void onLoginClicked();
 
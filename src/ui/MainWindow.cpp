@@ -12,8 +12,12 @@
 #include "EmployeeDirectoryDialog.h"
 #include "ProfileChangeRequestDialog.h"
 #include "DeliveryLogDialog.h"
+#include "DuplicateClientsDialog.h"
+#include "ItemDelegates.h"
 #include "Authorization.h"
+#include "StartupProfiler.h"
 #include "database.h"
+#include "backup.h"
 #include <QApplication>
 #include <QLabel>
 #include <QTabWidget>
@@ -43,26 +47,35 @@
 #include <QHBoxLayout>
 #include <QStatusBar>
 #include <QShortcut>
+#include <QTimer>
+#include <QElapsedTimer>
 #include <QKeySequence>
+#include <memory>
 
 using namespace firewood::core;
 
 
 MainWindow::MainWindow(const QString& username, const QString& fullName,
   const QString& userType, QWidget* parent)
-  : QMainWindow(parent), m_username(username), m_fullName(fullName), m_userType(userType)
+  : QMainWindow(parent), m_username(username), m_fullName(fullName), m_userType(userType),
+    m_role(parseUserType(userType))
 {
   qDebug() << "Creating MainWindow...";
 
+  StartupProfiler &profiler = StartupProfiler::instance();
+
   logDatabaseStatus();
   loadUserInfo();
+  profiler.mark("main window: user info");
   setupUI();
+  profiler.mark("main window: dashboard");
 
   applyRoleBasedPermissions();
 
   setupMenuBar();
   setupDatabaseModels();
   setupToolbar();
+  profiler.mark("main window: menus, tabs and toolbar");
   
   // Setup status bar
   m_statusBar = new QStatusBar(this);
@@ -75,6 +88,7 @@ MainWindow::MainWindow(const QString& username, const QString& fullName,
   setWindowTitle(QString("Firewood Bank - %1 (%2)").arg(m_fullName).arg(m_userType));
 
   showMaximized();
+  profiler.mark("main window: shown");
 
   qDebug() << "MainWindow created successfully";
 }
@@ -82,7 +96,7 @@ MainWindow::MainWindow(const QString& username, const QString& fullName,
 void MainWindow::loadUserInfo()
 {
   QSqlQuery query;
-  query.prepare("SELECT email, full_name FROM users WHERE username = :username");
+  query.prepare("SELECT email, full_name FROM user_accounts WHERE username = :username");
   query.bindValue(":username", m_username);
 
   if (query.exec() && query.next()) {
@@ -103,14 +117,12 @@ void MainWindow::setupUI()
 {
   qDebug() << "Setting up UI...";
 
-  setStyleSheet(AdobeStyles::APPLICATION_STYLE);
-
   auto* tabs = new QTabWidget(this);
   setCentralWidget(tabs);
 
   m_tabs = tabs;
 
-  if (Authorization::isVolunteer(m_userType)) {
+  if (m_role == UserType::Volunteer) {
     auto* volunteerProfile = new VolunteerProfileWidget(m_username, this);
     m_tabs->addTab(volunteerProfile, "👤 My Profile");
   }
@@ -139,233 +151,311 @@ void MainWindow::setupDatabaseModels()
     return;
   }
 
-  if (Authorization::isVolunteer(m_userType)) {
+  if (m_role == UserType::Volunteer) {
     qDebug() << "Volunteer role - skipping admin/employee tabs";
     return;
   }
 
-  if (Authorization::hasPermission(m_userType, Authorization::Permission::ViewClients)) {
-    m_householdsModel = new QSqlTableModel(this, db);
-    m_householdsModel->setTable("users");
-    m_householdsModel->setEditStrategy(QSqlTableModel::OnFieldChange);
-    // Filter to show only clients and volunteers (people who can receive firewood)
-    m_householdsModel->setFilter("user_type IN ('client', 'volunteer')");
+  // Tabs start as empty pages; each is built and queried the first time it is shown
+  if (Authorization::hasPermission(m_role, Authorization::Permission::ViewClients)) {
+    addLazyTab("👥 Clients", &MainWindow::buildClientsTab);
+  }
+  if (Authorization::hasPermission(m_role, Authorization::Permission::ViewInventory)) {
+    addLazyTab("📦 Inventory", &MainWindow::buildInventoryTab);
+  }
+  if (Authorization::hasPermission(m_role, Authorization::Permission::AddOrders)) {
+    addLazyTab("📋 Work Orders", &MainWindow::buildOrdersTab);
+  }
+  // Add Bookkeeping tab for Admin and Lead roles
+  if (m_role == UserType::Admin || m_role == UserType::Lead) {
+    addLazyTab("💰 Bookkeeping", &MainWindow::buildBookkeepingTab);
+    qDebug() << "Added Bookkeeping tab for user type:" << m_userType;
+  }
+
+  connect(m_tabs, &QTabWidget::currentChanged, this, &MainWindow::ensureTabBuilt);
+}
 
-    if (!m_householdsModel->select()) {
-      qDebug() << "ERROR: Failed to select households table:" << m_householdsModel->lastError().text();
-    }
-    else {
-      qDebug() << "Households model loaded successfully, rows:" << m_householdsModel->rowCount();
-    }
+void MainWindow::addLazyTab(const QString &label, TabBuilder builder)
+{
+  auto *page = new QWidget();
+  m_tabBuilders.insert(page, builder);
+  m_tabs->addTab(page, label);
+}
 
-    m_householdsView = new QTableView(this);
-    m_householdsView->setModel(m_householdsModel);
-    m_householdsView->setSelectionBehavior(QAbstractItemView::SelectRows);
-    m_householdsView->setSelectionMode(QAbstractItemView::SingleSelection);
-    m_householdsView->setAlternatingRowColors(true);
-    m_householdsView->setStyleSheet(AdobeStyles::TABLE_VIEW);
-    m_householdsView->setSortingEnabled(true);
-    connect(m_householdsView, &QTableView::doubleClicked, this, &MainWindow::onClientDoubleClicked);
-
-    // Set user-friendly column headers for users table
-    m_householdsModel->setHeaderData(4, Qt::Horizontal, "Name");        // full_name
-    m_householdsModel->setHeaderData(5, Qt::Horizontal, "Email");       // email
-    m_householdsModel->setHeaderData(6, Qt::Horizontal, "Phone");       // phone
-    m_householdsModel->setHeaderData(7, Qt::Horizontal, "Address");     // address
-    m_householdsModel->setHeaderData(11, Qt::Horizontal, "Stove Size"); // stove_size
-    m_householdsModel->setHeaderData(12, Qt::Horizontal, "Volunteer");  // is_volunteer
-    m_householdsModel->setHeaderData(23, Qt::Horizontal, "Orders");     // order_count
-    m_householdsModel->setHeaderData(2, Qt::Horizontal, "Type");        // user_type
-    
-    // Hide some detailed columns for the table view
-    m_householdsView->hideColumn(0); // ID
-    m_householdsView->hideColumn(1); // username
-    m_householdsView->hideColumn(3); // role (legacy)
-    m_householdsView->hideColumn(8); // mailing_address
-    m_householdsView->hideColumn(9); // gate_code
-    m_householdsView->hideColumn(10); // notes
-    m_householdsView->hideColumn(13); // waiver_signed
-    m_householdsView->hideColumn(14); // has_license
-    m_householdsView->hideColumn(15); // has_working_vehicle
-    m_householdsView->hideColumn(16); // works_for_wood
-    m_householdsView->hideColumn(17); // wood_credit_received
-    m_householdsView->hideColumn(18); // credit_balance
-    m_householdsView->hideColumn(19); // last_volunteer_date
-    m_householdsView->hideColumn(20); // last_order_date
-    m_householdsView->hideColumn(21); // availability
-    m_householdsView->hideColumn(22); // active
-    m_householdsView->hideColumn(24); // created_at
-    m_householdsView->hideColumn(25); // last_login
-
-    // Create clients tab with search functionality
-    auto *clientsTab = new QWidget();
-    auto *clientsLayout = new QVBoxLayout(clientsTab);
-    clientsLayout->setSpacing(10);
-    clientsLayout->setContentsMargins(10, 10, 10, 10);
-    
-    // Add search box
-    auto *searchLayout = new QHBoxLayout();
-    auto *searchLabel = new QLabel("🔍 Search Clients:", clientsTab);
-    auto *clientSearchBox = new QLineEdit(clientsTab);
-    clientSearchBox->setPlaceholderText("Search by name, phone, or address...");
-    clientSearchBox->setStyleSheet(AdobeStyles::LINE_EDIT);
-    
-    connect(clientSearchBox, &QLineEdit::textChanged, this, &MainWindow::searchClients);
-    
-    searchLayout->addWidget(searchLabel);
-    searchLayout->addWidget(clientSearchBox);
-    searchLayout->addStretch();
-    
-    clientsLayout->addLayout(searchLayout);
-    clientsLayout->addWidget(m_householdsView);
-    
-    m_tabs->addTab(clientsTab, "👥 Clients");
+void MainWindow::ensureTabBuilt(int index)
+{
+  QWidget *page = m_tabs->widget(index);
+  if (!page || !m_tabBuilders.contains(page)) {
+    return;
   }
 
-  if (Authorization::hasPermission(m_userType, Authorization::Permission::ViewInventory)) {
-    auto* inventoryRelModel = new QSqlRelationalTableModel(this, db);
-    inventoryRelModel->setTable("inventory_items");
-    inventoryRelModel->setEditStrategy(QSqlTableModel::OnManualSubmit);
-    inventoryRelModel->setRelation(1, QSqlRelation("inventory_categories", "id", "name"));
+  // Take the builder first so a nested event loop cannot build the page twice
+  const TabBuilder builder = m_tabBuilders.take(page);
+  QElapsedTimer timer;
+  timer.start();
+  (this->*builder)(page);
+  qDebug() << "Built tab" << m_tabs->tabText(index) << "in" << timer.elapsed() << "ms";
 
-    if (!inventoryRelModel->select()) {
-      qDebug() << "ERROR: Failed to select inventory_items table:" << inventoryRelModel->lastError().text();
-    }
-    else {
-      qDebug() << "Inventory model loaded successfully, rows:" << inventoryRelModel->rowCount();
-    }
+  updateStatusBar();
+}
 
-    m_inventoryView = new QTableView(this);
-    m_inventoryView->setModel(inventoryRelModel);
-    m_inventoryView->setSelectionBehavior(QAbstractItemView::SelectRows);
-    m_inventoryView->setSelectionMode(QAbstractItemView::SingleSelection);
-    m_inventoryView->setAlternatingRowColors(true);
-    m_inventoryView->setEditTriggers(QAbstractItemView::NoEditTriggers);
-    m_inventoryView->setStyleSheet(AdobeStyles::TABLE_VIEW);
-    m_inventoryView->setSortingEnabled(true);
-    connect(m_inventoryView, &QTableView::doubleClicked, this, &MainWindow::onInventoryDoubleClicked);
-
-    m_inventoryModel = inventoryRelModel;
-
-    // Set user-friendly column headers
-    inventoryRelModel->setHeaderData(0, Qt::Horizontal, "ID");
-    inventoryRelModel->setHeaderData(1, Qt::Horizontal, "Category");
-    inventoryRelModel->setHeaderData(2, Qt::Horizontal, "Item Name");
-    inventoryRelModel->setHeaderData(3, Qt::Horizontal, "Quantity");
-    inventoryRelModel->setHeaderData(4, Qt::Horizontal, "Unit");
-    inventoryRelModel->setHeaderData(5, Qt::Horizontal, "Location");
-    inventoryRelModel->setHeaderData(6, Qt::Horizontal, "Notes");
-    
-    // Hide some columns
-    m_inventoryView->hideColumn(0); // ID
-    m_inventoryView->hideColumn(7); // last_updated
-    m_inventoryView->hideColumn(8); // created_at
-
-    // Create inventory tab with search functionality
-    auto *inventoryTab = new QWidget();
-    auto *inventoryLayout = new QVBoxLayout(inventoryTab);
-    inventoryLayout->setSpacing(10);
-    inventoryLayout->setContentsMargins(10, 10, 10, 10);
-    
-    // Add search box
-    auto *invSearchLayout = new QHBoxLayout();
-    auto *invSearchLabel = new QLabel("🔍 Search Inventory:", inventoryTab);
-    auto *inventorySearchBox = new QLineEdit(inventoryTab);
-    inventorySearchBox->setPlaceholderText("Search by item name or category...");
-    inventorySearchBox->setStyleSheet(AdobeStyles::LINE_EDIT);
-    
-    connect(inventorySearchBox, &QLineEdit::textChanged, this, &MainWindow::searchInventory);
-    
-    invSearchLayout->addWidget(invSearchLabel);
-    invSearchLayout->addWidget(inventorySearchBox);
-    invSearchLayout->addStretch();
-    
-    inventoryLayout->addLayout(invSearchLayout);
-    inventoryLayout->addWidget(m_inventoryView);
-    
-    m_tabs->addTab(inventoryTab, "📦 Inventory");
+void MainWindow::paintEvent(QPaintEvent *event)
+{
+  QMainWindow::paintEvent(event);
+
+  if (!m_firstPaintSeen) {
+    m_firstPaintSeen = true;
+    // Runs after this paint pass has been flushed to the screen
+    QTimer::singleShot(0, this, &MainWindow::onFirstFramePainted);
   }
+}
+
+void MainWindow::onFirstFramePainted()
+{
+  StartupProfiler::instance().finish("main window: first frame");
+  emit firstFramePainted();
 
-  if (Authorization::hasPermission(m_userType, Authorization::Permission::AddOrders)) {
-    m_ordersModel = new QSqlTableModel(this, db);
-    m_ordersModel->setTable("orders");
-    m_ordersModel->setEditStrategy(QSqlTableModel::OnManualSubmit);
-    // Note: orders still reference household_id for now, will be updated in next migration
+  // Build the remaining tabs once the window is up, while the user looks at the dashboard
+  QTimer::singleShot(0, this, &MainWindow::preloadNextTab);
+}
 
-    if (!m_ordersModel->select()) {
-      qDebug() << "ERROR: Failed to select orders table:" << m_ordersModel->lastError().text();
-    }
-    else {
-      qDebug() << "Orders model loaded successfully, rows:" << m_ordersModel->rowCount();
+void MainWindow::preloadNextTab()
+{
+  // Build one idle tab per pass so input is handled between them
+  for (int i = 0; i < m_tabs->count(); ++i) {
+    if (m_tabBuilders.contains(m_tabs->widget(i))) {
+      ensureTabBuilt(i);
+      if (!m_tabBuilders.isEmpty()) {
+        QTimer::singleShot(0, this, &MainWindow::preloadNextTab);
+      }
+      return;
     }
+  }
+}
 
-    m_ordersView = new QTableView(this);
-    m_ordersView->setModel(m_ordersModel);
-    m_ordersView->setSelectionBehavior(QAbstractItemView::SelectRows);
-    m_ordersView->setSelectionMode(QAbstractItemView::SingleSelection);
-    m_ordersView->setAlternatingRowColors(true);
-    m_ordersView->setEditTriggers(QAbstractItemView::NoEditTriggers);
-    m_ordersView->setStyleSheet(AdobeStyles::TABLE_VIEW);
-    m_ordersView->setSortingEnabled(true);
-    connect(m_ordersView, &QTableView::doubleClicked, this, &MainWindow::onWorkOrderDoubleClicked);
-
-    // Set user-friendly column headers
-    m_ordersModel->setHeaderData(0, Qt::Horizontal, "ID");
-    m_ordersModel->setHeaderData(1, Qt::Horizontal, "Client ID");
-    m_ordersModel->setHeaderData(2, Qt::Horizontal, "Order Date");
-    m_ordersModel->setHeaderData(3, Qt::Horizontal, "Requested");
-    m_ordersModel->setHeaderData(4, Qt::Horizontal, "Delivered");
-    m_ordersModel->setHeaderData(5, Qt::Horizontal, "Status");
-    m_ordersModel->setHeaderData(6, Qt::Horizontal, "Priority");
-    m_ordersModel->setHeaderData(7, Qt::Horizontal, "Delivery Date");
-    m_ordersModel->setHeaderData(10, Qt::Horizontal, "Driver");
-    m_ordersModel->setHeaderData(11, Qt::Horizontal, "Payment");
-    m_ordersModel->setHeaderData(12, Qt::Horizontal, "Amount");
-    
-    // Hide some detailed columns
-    m_ordersView->hideColumn(0); // ID
-    m_ordersView->hideColumn(8); // delivery_address
-    m_ordersView->hideColumn(9); // delivery_notes
-    m_ordersView->hideColumn(13); // notes
-    m_ordersView->hideColumn(14); // created_by
-    m_ordersView->hideColumn(15); // created_at
-    m_ordersView->hideColumn(16); // updated_at
-    m_ordersView->hideColumn(17); // delivery_time
-    m_ordersView->hideColumn(18); // start_mileage
-    m_ordersView->hideColumn(19); // end_mileage
-    m_ordersView->hideColumn(20); // completed_date
-
-    // Create orders tab with search functionality
-    auto *ordersTab = new QWidget();
-    auto *ordersLayout = new QVBoxLayout(ordersTab);
-    ordersLayout->setSpacing(10);
-    ordersLayout->setContentsMargins(10, 10, 10, 10);
-    
-    // Add search box
-    auto *orderSearchLayout = new QHBoxLayout();
-    auto *orderSearchLabel = new QLabel("🔍 Search Orders:", ordersTab);
-    auto *orderSearchBox = new QLineEdit(ordersTab);
-    orderSearchBox->setPlaceholderText("Search by status, priority, or date...");
-    orderSearchBox->setStyleSheet(AdobeStyles::LINE_EDIT);
-    
-    connect(orderSearchBox, &QLineEdit::textChanged, this, &MainWindow::searchOrders);
-    
-    orderSearchLayout->addWidget(orderSearchLabel);
-    orderSearchLayout->addWidget(orderSearchBox);
-    orderSearchLayout->addStretch();
-    
-    ordersLayout->addLayout(orderSearchLayout);
-    ordersLayout->addWidget(m_ordersView);
-    
-    m_tabs->addTab(ordersTab, "📋 Work Orders");
+void MainWindow::buildClientsTab(QWidget *clientsTab)
+{
+  QSqlDatabase db = QSqlDatabase::database();
+
+  m_householdsModel = new QSqlTableModel(this, db);
+  m_householdsModel->setTable("users");
+  m_householdsModel->setEditStrategy(QSqlTableModel::OnFieldChange);
+  // Filter to show only clients and volunteers (people who can receive firewood)
+  m_householdsModel->setFilter("user_type IN ('client', 'volunteer')");
+
+  if (!m_householdsModel->select()) {
+    qDebug() << "ERROR: Failed to select households table:" << m_householdsModel->lastError().text();
+  }
+  else {
+    qDebug() << "Households model loaded successfully, rows:" << m_householdsModel->rowCount();
   }
+
+  m_householdsView = new QTableView(this);
+  m_householdsView->setModel(m_householdsModel);
+  m_householdsView->setSelectionBehavior(QAbstractItemView::SelectRows);
+  m_householdsView->setSelectionMode(QAbstractItemView::SingleSelection);
+  m_householdsView->setAlternatingRowColors(true);
+  m_householdsView->setSortingEnabled(true);
+  connect(m_householdsView, &QTableView::doubleClicked, this, &MainWindow::onClientDoubleClicked);
+
+  // Set user-friendly column headers for users table
+  m_householdsModel->setHeaderData(4, Qt::Horizontal, "Name");        // full_name
+  m_householdsModel->setHeaderData(5, Qt::Horizontal, "Email");       // email
+  m_householdsModel->setHeaderData(6, Qt::Horizontal, "Phone");       // phone
+  m_householdsModel->setHeaderData(7, Qt::Horizontal, "Address");     // address
+  m_householdsModel->setHeaderData(11, Qt::Horizontal, "Stove Size"); // stove_size
+  m_householdsModel->setHeaderData(12, Qt::Horizontal, "Volunteer");  // is_volunteer
+  m_householdsModel->setHeaderData(23, Qt::Horizontal, "Orders");     // order_count
+  m_householdsModel->setHeaderData(2, Qt::Horizontal, "Type");        // user_type
   
-  // Add Bookkeeping tab for Admin and Lead roles
-  if (Authorization::isAdmin(m_userType) || Authorization::isLead(m_userType)) {
-    auto* bookkeepingWidget = new BookkeepingWidget(m_username, this);
-    m_tabs->addTab(bookkeepingWidget, "💰 Bookkeeping");
-    qDebug() << "Added Bookkeeping tab for user type:" << m_userType;
+  // Hide some detailed columns for the table view
+  m_householdsView->hideColumn(0); // ID
+  m_householdsView->hideColumn(1); // username
+  m_householdsView->hideColumn(3); // role (legacy)
+  m_householdsView->hideColumn(8); // mailing_address
+  m_householdsView->hideColumn(9); // gate_code
+  m_householdsView->hideColumn(10); // notes
+  m_householdsView->hideColumn(13); // waiver_signed
+  m_householdsView->hideColumn(14); // has_license
+  m_householdsView->hideColumn(15); // has_working_vehicle
+  m_householdsView->hideColumn(16); // works_for_wood
+  m_householdsView->hideColumn(17); // wood_credit_received
+  m_householdsView->hideColumn(18); // credit_balance
+  m_householdsView->hideColumn(19); // last_volunteer_date
+  m_householdsView->hideColumn(20); // last_order_date
+  m_householdsView->hideColumn(21); // availability
+  m_householdsView->hideColumn(22); // active
+  m_householdsView->hideColumn(24); // created_at
+  m_householdsView->hideColumn(25); // last_login
+
+  m_householdsView->setItemDelegateForColumn(m_householdsModel->fieldIndex("is_volunteer"),
+                                             new YesNoDelegate(m_householdsView));
+
+  // Fill the clients tab with search functionality
+  auto *clientsLayout = new QVBoxLayout(clientsTab);
+  clientsLayout->setSpacing(10);
+  clientsLayout->setContentsMargins(10, 10, 10, 10);
+  
+  // Add search box
+  auto *searchLayout = new QHBoxLayout();
+  auto *searchLabel = new QLabel("🔍 Search Clients:", clientsTab);
+  auto *clientSearchBox = new QLineEdit(clientsTab);
+  clientSearchBox->setPlaceholderText("Search by name, phone, or address...");
+  
+  connect(clientSearchBox, &QLineEdit::textChanged, this, &MainWindow::searchClients);
+  
+  searchLayout->addWidget(searchLabel);
+  searchLayout->addWidget(clientSearchBox);
+  searchLayout->addStretch();
+  
+  clientsLayout->addLayout(searchLayout);
+  clientsLayout->addWidget(m_householdsView);
+}
+
+void MainWindow::buildInventoryTab(QWidget *inventoryTab)
+{
+  QSqlDatabase db = QSqlDatabase::database();
+
+  auto* inventoryRelModel = new QSqlRelationalTableModel(this, db);
+  inventoryRelModel->setTable("inventory_items");
+  inventoryRelModel->setEditStrategy(QSqlTableModel::OnManualSubmit);
+  inventoryRelModel->setRelation(1, QSqlRelation("inventory_categories", "id", "name"));
+
+  if (!inventoryRelModel->select()) {
+    qDebug() << "ERROR: Failed to select inventory_items table:" << inventoryRelModel->lastError().text();
+  }
+  else {
+    qDebug() << "Inventory model loaded successfully, rows:" << inventoryRelModel->rowCount();
   }
+
+  m_inventoryView = new QTableView(this);
+  m_inventoryView->setModel(inventoryRelModel);
+  m_inventoryView->setSelectionBehavior(QAbstractItemView::SelectRows);
+  m_inventoryView->setSelectionMode(QAbstractItemView::SingleSelection);
+  m_inventoryView->setAlternatingRowColors(true);
+  m_inventoryView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  m_inventoryView->setSortingEnabled(true);
+  connect(m_inventoryView, &QTableView::doubleClicked, this, &MainWindow::onInventoryDoubleClicked);
+
+  m_inventoryModel = inventoryRelModel;
+
+  // Set user-friendly column headers
+  inventoryRelModel->setHeaderData(0, Qt::Horizontal, "ID");
+  inventoryRelModel->setHeaderData(1, Qt::Horizontal, "Category");
+  inventoryRelModel->setHeaderData(2, Qt::Horizontal, "Item Name");
+  inventoryRelModel->setHeaderData(3, Qt::Horizontal, "Quantity");
+  inventoryRelModel->setHeaderData(4, Qt::Horizontal, "Unit");
+  inventoryRelModel->setHeaderData(5, Qt::Horizontal, "Location");
+  inventoryRelModel->setHeaderData(6, Qt::Horizontal, "Notes");
+  
+  // Hide some columns
+  m_inventoryView->hideColumn(0); // ID
+  m_inventoryView->hideColumn(7); // last_updated
+  m_inventoryView->hideColumn(8); // created_at
+
+  // Fill the inventory tab with search functionality
+  auto *inventoryLayout = new QVBoxLayout(inventoryTab);
+  inventoryLayout->setSpacing(10);
+  inventoryLayout->setContentsMargins(10, 10, 10, 10);
+  
+  // Add search box
+  auto *invSearchLayout = new QHBoxLayout();
+  auto *invSearchLabel = new QLabel("🔍 Search Inventory:", inventoryTab);
+  auto *inventorySearchBox = new QLineEdit(inventoryTab);
+  inventorySearchBox->setPlaceholderText("Search by item name or category...");
+  
+  connect(inventorySearchBox, &QLineEdit::textChanged, this, &MainWindow::searchInventory);
+  
+  invSearchLayout->addWidget(invSearchLabel);
+  invSearchLayout->addWidget(inventorySearchBox);
+  invSearchLayout->addStretch();
+  
+  inventoryLayout->addLayout(invSearchLayout);
+  inventoryLayout->addWidget(m_inventoryView);
+}
+
+void MainWindow::buildOrdersTab(QWidget *ordersTab)
+{
+  QSqlDatabase db = QSqlDatabase::database();
+
+  m_ordersModel = new QSqlTableModel(this, db);
+  m_ordersModel->setTable("orders");
+  m_ordersModel->setEditStrategy(QSqlTableModel::OnManualSubmit);
+  // Note: orders still reference household_id for now, will be updated in next migration
+
+  if (!m_ordersModel->select()) {
+    qDebug() << "ERROR: Failed to select orders table:" << m_ordersModel->lastError().text();
+  }
+  else {
+    qDebug() << "Orders model loaded successfully, rows:" << m_ordersModel->rowCount();
+  }
+
+  m_ordersView = new QTableView(this);
+  m_ordersView->setModel(m_ordersModel);
+  m_ordersView->setSelectionBehavior(QAbstractItemView::SelectRows);
+  m_ordersView->setSelectionMode(QAbstractItemView::SingleSelection);
+  m_ordersView->setAlternatingRowColors(true);
+  m_ordersView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  m_ordersView->setSortingEnabled(true);
+  connect(m_ordersView, &QTableView::doubleClicked, this, &MainWindow::onWorkOrderDoubleClicked);
+
+  // Set user-friendly column headers
+  m_ordersModel->setHeaderData(0, Qt::Horizontal, "ID");
+  m_ordersModel->setHeaderData(1, Qt::Horizontal, "Client ID");
+  m_ordersModel->setHeaderData(2, Qt::Horizontal, "Order Date");
+  m_ordersModel->setHeaderData(3, Qt::Horizontal, "Requested");
+  m_ordersModel->setHeaderData(4, Qt::Horizontal, "Delivered");
+  m_ordersModel->setHeaderData(5, Qt::Horizontal, "Status");
+  m_ordersModel->setHeaderData(6, Qt::Horizontal, "Priority");
+  m_ordersModel->setHeaderData(7, Qt::Horizontal, "Delivery Date");
+  m_ordersModel->setHeaderData(10, Qt::Horizontal, "Driver");
+  m_ordersModel->setHeaderData(11, Qt::Horizontal, "Payment");
+  m_ordersModel->setHeaderData(12, Qt::Horizontal, "Amount");
+  
+  // Hide some detailed columns
+  m_ordersView->hideColumn(0); // ID
+  m_ordersView->hideColumn(8); // delivery_address
+  m_ordersView->hideColumn(9); // delivery_notes
+  m_ordersView->hideColumn(13); // notes
+  m_ordersView->hideColumn(14); // created_by
+  m_ordersView->hideColumn(15); // created_at
+  m_ordersView->hideColumn(16); // updated_at
+  m_ordersView->hideColumn(17); // delivery_time
+  m_ordersView->hideColumn(18); // start_mileage
+  m_ordersView->hideColumn(19); // end_mileage
+  m_ordersView->hideColumn(20); // completed_date
+
+  // Painted straight from the model values, no per-cell widgets
+  m_ordersView->setItemDelegateForColumn(5, new StatusBadgeDelegate(m_ordersView));  // status
+  m_ordersView->setItemDelegateForColumn(6, new PriorityDelegate(m_ordersView));     // priority
+  m_ordersView->setItemDelegateForColumn(12, new MoneyDelegate(MoneyDelegate::Unit::Dollars, m_ordersView)); // amount
+
+  // Fill the orders tab with search functionality
+  auto *ordersLayout = new QVBoxLayout(ordersTab);
+  ordersLayout->setSpacing(10);
+  ordersLayout->setContentsMargins(10, 10, 10, 10);
+  
+  // Add search box
+  auto *orderSearchLayout = new QHBoxLayout();
+  auto *orderSearchLabel = new QLabel("🔍 Search Orders:", ordersTab);
+  auto *orderSearchBox = new QLineEdit(ordersTab);
+  orderSearchBox->setPlaceholderText("Search by status, priority, or date...");
+  
+  connect(orderSearchBox, &QLineEdit::textChanged, this, &MainWindow::searchOrders);
+  
+  orderSearchLayout->addWidget(orderSearchLabel);
+  orderSearchLayout->addWidget(orderSearchBox);
+  orderSearchLayout->addStretch();
+  
+  ordersLayout->addLayout(orderSearchLayout);
+  ordersLayout->addWidget(m_ordersView);
+}
+
+void MainWindow::buildBookkeepingTab(QWidget *bookkeepingTab)
+{
+  auto *layout = new QVBoxLayout(bookkeepingTab);
+  layout->setContentsMargins(0, 0, 0, 0);
+  layout->addWidget(new BookkeepingWidget(m_username, bookkeepingTab));
 }
 
 void MainWindow::searchClients(const QString &text)
@@ -412,7 +502,7 @@ void MainWindow::updateStatusBar()
     
     QString statusText = QString("📊 System Status - User: %1 (%2)").arg(m_fullName).arg(m_userType);
     
-    // Add record counts if models are available
+    // Add record counts for the tabs that have been opened
     QStringList counts;
     if (m_householdsModel) {
         counts << QString("Clients: %1").arg(m_householdsModel->rowCount());
@@ -552,7 +642,7 @@ void MainWindow::setupMenuBar()
     connect(exitAction, &QAction::triggered, this, &QWidget::close);
     
     // Admin menu (only for admin users)
-    if (Authorization::hasPermission(m_userType, Authorization::Permission::ManageUsers)) {
+    if (Authorization::hasPermission(m_role, Authorization::Permission::ManageUsers)) {
         auto *adminMenu = menuBar->addMenu("&Admin");
         
         auto *loadSampleDataAction = adminMenu->addAction("&Load Sample Data");
@@ -560,6 +650,9 @@ void MainWindow::setupMenuBar()
         
         adminMenu->addSeparator();
         
+        auto *findDuplicatesAction = adminMenu->addAction("Find &Duplicate Clients...");
+        connect(findDuplicatesAction, &QAction::triggered, this, &MainWindow::findDuplicateClients);
+        
         auto *exportClientsAction = adminMenu->addAction("Export &Clients to CSV");
         connect(exportClientsAction, &QAction::triggered, this, &MainWindow::exportClientsToCSV);
         
@@ -571,6 +664,11 @@ void MainWindow::setupMenuBar()
         
         adminMenu->addSeparator();
         
+        auto *backupAction = adminMenu->addAction("&Back Up Database Now");
+        connect(backupAction, &QAction::triggered, this, &MainWindow::backupDatabase);
+        
+        adminMenu->addSeparator();
+        
         auto *clearDataAction = adminMenu->addAction("&Clear All Data");
         connect(clearDataAction, &QAction::triggered, this, &MainWindow::clearAllData);
     }
@@ -604,7 +702,7 @@ void MainWindow::setupToolbar()
     tb->addAction(myProfileAction);
     
     // Employees and Admins can view employee directory
-    if (Authorization::hasPermission(m_userType, Authorization::Permission::ViewClients)) {
+    if (Authorization::hasPermission(m_role, Authorization::Permission::ViewClients)) {
         auto *employeeDirectoryAction = new QAction(AdobeStyles::ICON_USERS + " Employee Directory", this);
         employeeDirectoryAction->setToolTip("CRM employee contact information");
         connect(employeeDirectoryAction, &QAction::triggered, this, &MainWindow::viewEmployeeDirectory);
@@ -614,7 +712,7 @@ void MainWindow::setupToolbar()
     tb->addSeparator();
     
     // Admin-only actions
-    if (Authorization::hasPermission(m_userType, Authorization::Permission::ManageUsers)) {
+    if (Authorization::hasPermission(m_role, Authorization::Permission::ManageUsers)) {
         auto *changeRequestsAction = new QAction(AdobeStyles::ICON_ORDERS + " Change Requests", this);
         changeRequestsAction->setToolTip("Review profile change requests");
         connect(changeRequestsAction, &QAction::triggered, this, &MainWindow::viewProfileChangeRequests);
@@ -634,7 +732,7 @@ void MainWindow::setupToolbar()
     }
     
     // Admin and Employee actions
-    if (Authorization::hasPermission(m_userType, Authorization::Permission::EditClients)) {
+    if (Authorization::hasPermission(m_role, Authorization::Permission::EditClients)) {
         auto *addClient = new QAction(AdobeStyles::ICON_ADD + " Add Client", this);
         addClient->setToolTip("Add a new client/household");
         connect(addClient, &QAction::triggered, this, &MainWindow::addClient);
@@ -649,7 +747,7 @@ void MainWindow::setupToolbar()
     }
     
     // Add/Edit Orders (Admin and Employees)
-    if (Authorization::hasPermission(m_userType, Authorization::Permission::AddOrders)) {
+    if (Authorization::hasPermission(m_role, Authorization::Permission::AddOrders)) {
         auto *addOrder = new QAction(AdobeStyles::ICON_ORDERS + " New Order", this);
         addOrder->setToolTip("Create a new work order");
         connect(addOrder, &QAction::triggered, this, &MainWindow::addWorkOrder);
@@ -664,7 +762,7 @@ void MainWindow::setupToolbar()
     }
     
     // Inventory Management (Admin and Employees)
-    if (Authorization::hasPermission(m_userType, Authorization::Permission::EditInventory)) {
+    if (Authorization::hasPermission(m_role, Authorization::Permission::EditInventory)) {
         auto *addInventory = new QAction(AdobeStyles::ICON_INVENTORY + " Add Inventory", this);
         addInventory->setToolTip("Add or update inventory item");
         connect(addInventory, &QAction::triggered, this, &MainWindow::addInventoryItem);
@@ -717,7 +815,7 @@ void MainWindow::addClient()
 
 void MainWindow::editClient()
 {
-    if (!m_householdsView->selectionModel()->hasSelection()) {
+    if (!m_householdsView || !m_householdsView->selectionModel()->hasSelection()) {
         QMessageBox::information(this, "No Selection", "Please select a client to edit.");
         return;
     }
@@ -809,7 +907,7 @@ void MainWindow::addInventoryItem()
 
 void MainWindow::editInventoryItem()
 {
-    if (!m_inventoryView->selectionModel()->hasSelection()) {
+    if (!m_inventoryView || !m_inventoryView->selectionModel()->hasSelection()) {
         QMessageBox::information(this, "No Selection", "Please select an inventory item to edit.");
         return;
     }
@@ -839,27 +937,68 @@ void MainWindow::onInventoryDoubleClicked(const QModelIndex &index)
 
 void MainWindow::deleteSelectedClient()
 {
-    if (!m_householdsView->selectionModel()->hasSelection()) {
+    if (!m_householdsView || !m_householdsView->selectionModel()->hasSelection()) {
         QMessageBox::information(this, "No Selection", "Please select a client to delete.");
         return;
     }
     
     QModelIndex index = m_householdsView->selectionModel()->currentIndex();
     int row = index.row();
+    int userId = m_householdsModel->data(m_householdsModel->index(row, 0)).toInt();
     QString clientName = m_householdsModel->data(m_householdsModel->index(row, 4)).toString(); // full_name column
     
+    QSqlDatabase db = QSqlDatabase::database();
+    
+    int orderCount = 0;
+    QSqlQuery countQuery(db);
+    countQuery.prepare("SELECT COUNT(*) FROM orders WHERE household_id IN "
+                       "(SELECT household_id FROM household_user_mapping WHERE user_id = :id)");
+    countQuery.bindValue(":id", userId);
+    if (countQuery.exec() && countQuery.next()) {
+        orderCount = countQuery.value(0).toInt();
+    }
+    
     QMessageBox::StandardButton reply = QMessageBox::question(this, "Confirm Delete",
-        QString("Are you sure you want to delete client '%1'?\n\nThis action cannot be undone.").arg(clientName),
+        QString("Are you sure you want to delete client '%1'?\n\n"
+                "Their %2 work order(s), delivery log entries, volunteer hours and sign-ups will also be deleted.\n\n"
+                "This action cannot be undone.").arg(clientName).arg(orderCount),
         QMessageBox::Yes | QMessageBox::No);
     
-    if (reply == QMessageBox::Yes) {
-        m_householdsModel->removeRow(row);
-        if (m_householdsModel->submitAll()) {
-            QMessageBox::information(this, "Success", "Client deleted successfully.");
-        } else {
-            QMessageBox::warning(this, "Error", "Failed to delete client: " + m_householdsModel->lastError().text());
-            m_householdsModel->revertAll();
-        }
+    if (reply != QMessageBox::Yes) {
+        return;
+    }
+    
+    // Foreign keys do the rest: deleting the linked household cascades to orders (and
+    // their delivery log), volunteer hours, certifications and sign-ups; deleting the
+    // account cascades to its credential and profile rows, change requests and the
+    // household mapping. Every child column is indexed, so each cascade is an index
+    // lookup rather than a table scan. Both deletes must land together, so nothing is
+    // deleted without a transaction.
+    if (!db.transaction()) {
+        QMessageBox::warning(this, "Error", "Failed to delete client: could not start a transaction: "
+                             + db.lastError().text());
+        return;
+    }
+    QSqlQuery deleteQuery(db);
+    deleteQuery.prepare("DELETE FROM households WHERE id IN "
+                        "(SELECT household_id FROM household_user_mapping WHERE user_id = :id)");
+    deleteQuery.bindValue(":id", userId);
+    bool ok = deleteQuery.exec();
+    if (ok) {
+        deleteQuery.prepare("DELETE FROM user_accounts WHERE id = :id");
+        deleteQuery.bindValue(":id", userId);
+        ok = deleteQuery.exec();
+    }
+    
+    if (ok && db.commit()) {
+        m_householdsModel->select();
+        if (m_ordersModel) m_ordersModel->select();
+        updateStatusBar();
+        QMessageBox::information(this, "Success", "Client deleted successfully.");
+    } else {
+        QString error = deleteQuery.lastError().isValid() ? deleteQuery.lastError().text() : db.lastError().text();
+        db.rollback();
+        QMessageBox::warning(this, "Error", "Failed to delete client: " + error);
     }
 }
 
@@ -875,43 +1014,60 @@ void MainWindow::deleteSelectedOrder()
     int orderId = m_ordersModel->data(m_ordersModel->index(row, 0)).toInt();
     
     QMessageBox::StandardButton reply = QMessageBox::question(this, "Confirm Delete",
-        QString("Are you sure you want to delete work order #%1?\n\nThis action cannot be undone.").arg(orderId),
+        QString("Are you sure you want to delete work order #%1?\n\n"
+                "Its delivery log entries will also be deleted.\n\n"
+                "This action cannot be undone.").arg(orderId),
         QMessageBox::Yes | QMessageBox::No);
     
-    if (reply == QMessageBox::Yes) {
-        m_ordersModel->removeRow(row);
-        if (m_ordersModel->submitAll()) {
-            QMessageBox::information(this, "Success", "Work order deleted successfully.");
-        } else {
-            QMessageBox::warning(this, "Error", "Failed to delete work order: " + m_ordersModel->lastError().text());
-            m_ordersModel->revertAll();
-        }
+    if (reply != QMessageBox::Yes) {
+        return;
+    }
+    
+    // delivery_log rows go with the order (ON DELETE CASCADE via idx_delivery_log_order)
+    QSqlQuery deleteQuery(QSqlDatabase::database());
+    deleteQuery.prepare("DELETE FROM orders WHERE id = :id");
+    deleteQuery.bindValue(":id", orderId);
+    
+    if (deleteQuery.exec()) {
+        m_ordersModel->select();
+        updateStatusBar();
+        QMessageBox::information(this, "Success", "Work order deleted successfully.");
+    } else {
+        QMessageBox::warning(this, "Error", "Failed to delete work order: " + deleteQuery.lastError().text());
     }
 }
 
 void MainWindow::deleteSelectedInventoryItem()
 {
-    if (!m_inventoryView->selectionModel()->hasSelection()) {
+    if (!m_inventoryView || !m_inventoryView->selectionModel()->hasSelection()) {
         QMessageBox::information(this, "No Selection", "Please select an inventory item to delete.");
         return;
     }
     
     QModelIndex index = m_inventoryView->selectionModel()->currentIndex();
     int row = index.row();
+    int itemId = m_inventoryModel->data(m_inventoryModel->index(row, 0)).toInt();
     QString itemName = m_inventoryModel->data(m_inventoryModel->index(row, 2)).toString(); // item_name column
     
     QMessageBox::StandardButton reply = QMessageBox::question(this, "Confirm Delete",
         QString("Are you sure you want to delete inventory item '%1'?\n\nThis action cannot be undone.").arg(itemName),
         QMessageBox::Yes | QMessageBox::No);
     
-    if (reply == QMessageBox::Yes) {
-        m_inventoryModel->removeRow(row);
-        if (m_inventoryModel->submitAll()) {
-            QMessageBox::information(this, "Success", "Inventory item deleted successfully.");
-        } else {
-            QMessageBox::warning(this, "Error", "Failed to delete inventory item: " + m_inventoryModel->lastError().text());
-            m_inventoryModel->revertAll();
-        }
+    if (reply != QMessageBox::Yes) {
+        return;
+    }
+    
+    // The item's alert state goes with it (ON DELETE CASCADE on inventory_alert_state)
+    QSqlQuery deleteQuery(QSqlDatabase::database());
+    deleteQuery.prepare("DELETE FROM inventory_items WHERE id = :id");
+    deleteQuery.bindValue(":id", itemId);
+    
+    if (deleteQuery.exec()) {
+        m_inventoryModel->select();
+        updateStatusBar();
+        QMessageBox::information(this, "Success", "Inventory item deleted successfully.");
+    } else {
+        QMessageBox::warning(this, "Error", "Failed to delete inventory item: " + deleteQuery.lastError().text());
     }
 }
 
@@ -1003,6 +1159,13 @@ void MainWindow::loadSampleData()
     }
 }
 
+void MainWindow::findDuplicateClients()
+{
+    qDebug() << "Scanning for duplicate clients...";
+    DuplicateClientsDialog dialog(this);
+    dialog.exec();
+}
+
 void MainWindow::exportClientsToCSV()
 {
     qDebug() << "Exporting clients to CSV...";
@@ -1021,6 +1184,39 @@ void MainWindow::exportInventoryToCSV()
     QMessageBox::information(this, "Coming Soon", "CSV export feature coming soon!");
 }
 
+void MainWindow::backupDatabase()
+{
+    auto *scheduler = firewood::db::BackupScheduler::instance();
+    if (!scheduler) {
+        QMessageBox::warning(this, "Backup Unavailable", "The backup service is not running.");
+        return;
+    }
+    
+    // One-shot connection: report the result of this backup only
+    auto connection = std::make_shared<QMetaObject::Connection>();
+    *connection = connect(scheduler, &firewood::db::BackupScheduler::backupFinished, this,
+        [this, connection](const firewood::db::BackupResult &result) {
+            disconnect(*connection);
+            if (result.success) {
+                m_statusBar->showMessage("Database backup completed", 5000);
+                QMessageBox::information(this, "Backup Complete",
+                    QString("Database backed up and verified.\n\n%1\n%2 KB in %3 ms")
+                        .arg(QDir::toNativeSeparators(result.filePath))
+                        .arg(result.bytes / 1024)
+                        .arg(result.elapsedMs));
+            } else {
+                QMessageBox::warning(this, "Backup Failed", "Database backup failed:\n" + result.error);
+            }
+        });
+    
+    if (scheduler->backupNow()) {
+        m_statusBar->showMessage("Backing up database in the background...");
+    } else {
+        disconnect(*connection);
+        QMessageBox::information(this, "Backup In Progress", "A backup is already running. Please try again shortly.");
+    }
+}
+
 void MainWindow::clearAllData()
 {
     QMessageBox::StandardButton reply = QMessageBox::question(this, "Confirm Clear All Data",
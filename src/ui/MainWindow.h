@@ -5,6 +5,9 @@
 #include <QTableView>
 #include <QSqlTableModel>
 #include <QString>
+#include <QHash>
+#include <optional>
+#include "Codes.h"
 
 struct UserInfo; // Forward declaration
 
@@ -19,6 +22,14 @@ public:
 signals:
     void logoutRequested();
 
+    /**
+     * @brief Emitted once, after the window's first frame has been painted
+     */
+    void firstFramePainted();
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
 private slots:
     void logout();
     void viewMyProfile();
@@ -38,9 +49,11 @@ private slots:
     void manageUsers();
     void manageAgencies();
     void loadSampleData();
+    void findDuplicateClients();
     void exportClientsToCSV();
     void exportOrdersToCSV();
     void exportInventoryToCSV();
+    void backupDatabase();
     void clearAllData();
     void deleteSelectedClient();
     void deleteSelectedOrder();
@@ -61,11 +74,23 @@ private:
     void addSearchBoxToTab(QWidget *tabWidget, QTableView *tableView, QSqlTableModel *model, const QString &searchColumns);
     void updateStatusBar();
     void setupKeyboardShortcuts();
+
+    // Tabs other than the dashboard are built on first show
+    using TabBuilder = void (MainWindow::*)(QWidget *page);
+    void addLazyTab(const QString &label, TabBuilder builder);
+    void ensureTabBuilt(int index);
+    void preloadNextTab();
+    void onFirstFramePainted();
+    void buildClientsTab(QWidget *clientsTab);
+    void buildInventoryTab(QWidget *inventoryTab);
+    void buildOrdersTab(QWidget *ordersTab);
+    void buildBookkeepingTab(QWidget *bookkeepingTab);
     
     // User info
     QString m_username;
     QString m_fullName;
     QString m_userType;
+    std::optional<firewood::core::UserType> m_role;  // m_userType parsed once for permission checks
     QString m_contactNumber;
     QString m_email;
     
@@ -81,6 +106,9 @@ private:
     QSqlTableModel *m_householdsModel = nullptr;
     QSqlTableModel *m_inventoryModel = nullptr;
     QSqlTableModel *m_ordersModel = nullptr;
+
+    QHash<QWidget *, TabBuilder> m_tabBuilders;  // Pages not built yet
+    bool m_firstPaintSeen = false;
 };
 
 // Factory function for creating MainWindow instances
@@ -1,4 +1,6 @@
 #include "ProfileChangeRequestDialog.h"
+#include "StyleSheet.h"
+#include "ResultTableModel.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QHeaderView>
@@ -8,6 +10,23 @@
 #include <QSqlError>
 #include <QDebug>
 #include <QDateTime>
+#include <QBrush>
+#include <QFont>
+
+namespace {
+
+// Shows a placeholder in place of an empty value
+ResultTableModel::Formatter placeholderFormatter(int column, const QString &placeholder)
+{
+    return [column, placeholder](const ResultTableModel &model, int row, int role) -> QVariant {
+        if (role == Qt::DisplayRole && model.text(row, column).isEmpty()) {
+            return placeholder;
+        }
+        return QVariant();
+    };
+}
+
+} // namespace
 
 ProfileChangeRequestDialog::ProfileChangeRequestDialog(const QString &adminUsername, QWidget *parent)
     : QDialog(parent), m_adminUsername(adminUsername)
@@ -41,11 +60,52 @@ void ProfileChangeRequestDialog::setupUI()
     mainLayout->addLayout(filterLayout);
     
     // Requests table
-    m_requestsTable = new QTableWidget(this);
-    m_requestsTable->setColumnCount(8);
-    m_requestsTable->setHorizontalHeaderLabels({
+    m_requestsModel = new ResultTableModel(this);
+    m_requestsModel->setHeaders({
         "ID", "User", "Field", "Old Value", "New Value", "Requested", "Status", "Reviewed By"
     });
+    m_requestsModel->setFormatter(2, [](const ResultTableModel &, int, int role) -> QVariant {
+        if (role == Qt::FontRole) {
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+        return QVariant();
+    });
+    m_requestsModel->setFormatter(3, placeholderFormatter(3, "(empty)"));
+    m_requestsModel->setFormatter(4, [](const ResultTableModel &, int, int role) -> QVariant {
+        if (role == Qt::ForegroundRole) {
+            return QBrush(QColor(0, 128, 0));
+        }
+        return QVariant();
+    });
+    m_requestsModel->setFormatter(5, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        if (role == Qt::DisplayRole) {
+            return QDateTime::fromString(model.text(row, 5), Qt::ISODate).toString("MM/dd/yy hh:mm");
+        }
+        return QVariant();
+    });
+    m_requestsModel->setFormatter(6, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        const QString status = model.text(row, 6);
+        if (role == Qt::ForegroundRole) {
+            if (status == "Pending") {
+                return QBrush(QColor(255, 165, 0)); // Orange
+            } else if (status == "Approved") {
+                return QBrush(QColor(0, 128, 0)); // Green
+            } else if (status == "Rejected") {
+                return QBrush(QColor(220, 53, 69)); // Red
+            }
+        } else if (role == Qt::FontRole && status == "Pending") {
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+        return QVariant();
+    });
+    m_requestsModel->setFormatter(7, placeholderFormatter(7, "-"));
+    
+    m_requestsTable = new QTableView(this);
+    m_requestsTable->setModel(m_requestsModel);
     m_requestsTable->horizontalHeader()->setStretchLastSection(true);
     m_requestsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_requestsTable->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -60,12 +120,12 @@ void ProfileChangeRequestDialog::setupUI()
     auto *buttonLayout = new QHBoxLayout();
     
     m_approveButton = new QPushButton("✅ Approve Request", this);
-    m_approveButton->setStyleSheet("QPushButton { background-color: #28a745; color: white; padding: 8px 16px; }");
+    AdobeStyles::setVariant(m_approveButton, "approve");
     connect(m_approveButton, &QPushButton::clicked, this, &ProfileChangeRequestDialog::approveRequest);
     buttonLayout->addWidget(m_approveButton);
     
     m_rejectButton = new QPushButton("❌ Reject Request", this);
-    m_rejectButton->setStyleSheet("QPushButton { background-color: #dc3545; color: white; padding: 8px 16px; }");
+    AdobeStyles::setVariant(m_rejectButton, "danger");
     connect(m_rejectButton, &QPushButton::clicked, this, &ProfileChangeRequestDialog::rejectRequest);
     buttonLayout->addWidget(m_rejectButton);
     
@@ -84,8 +144,6 @@ void ProfileChangeRequestDialog::setupUI()
 
 void ProfileChangeRequestDialog::loadRequests()
 {
-    m_requestsTable->setRowCount(0);
-    
     QString sql = "SELECT pr.id, pr.requested_by, pr.field_name, pr.old_value, pr.new_value, "
                   "pr.request_date, pr.status, pr.reviewed_by "
                   "FROM profile_change_requests pr ";
@@ -97,6 +155,7 @@ void ProfileChangeRequestDialog::loadRequests()
     sql += "ORDER BY pr.request_date DESC";
     
     QSqlQuery query;
+    query.setForwardOnly(true);
     query.prepare(sql);
     
     if (m_currentFilter != "All") {
@@ -105,75 +164,25 @@ void ProfileChangeRequestDialog::loadRequests()
     
     if (!query.exec()) {
         QMessageBox::critical(this, "Error", "Failed to load requests: " + query.lastError().text());
+        m_requestsModel->clear();
         return;
     }
     
-    int row = 0;
-    while (query.next()) {
-        m_requestsTable->insertRow(row);
-        
-        // ID (hidden)
-        m_requestsTable->setItem(row, 0, new QTableWidgetItem(query.value(0).toString()));
-        
-        // Requested By
-        m_requestsTable->setItem(row, 1, new QTableWidgetItem(query.value(1).toString()));
-        
-        // Field Name
-        QString fieldName = query.value(2).toString();
-        auto *fieldItem = new QTableWidgetItem(fieldName);
-        QFont font = fieldItem->font();
-        font.setBold(true);
-        fieldItem->setFont(font);
-        m_requestsTable->setItem(row, 2, fieldItem);
-        
-        // Old Value
-        QString oldValue = query.value(3).toString();
-        m_requestsTable->setItem(row, 3, new QTableWidgetItem(oldValue.isEmpty() ? "(empty)" : oldValue));
-        
-        // New Value
-        QString newValue = query.value(4).toString();
-        auto *newValueItem = new QTableWidgetItem(newValue);
-        newValueItem->setForeground(QBrush(QColor(0, 128, 0)));
-        m_requestsTable->setItem(row, 4, newValueItem);
-        
-        // Request Date
-        QString requestDate = query.value(5).toString();
-        QDateTime dt = QDateTime::fromString(requestDate, Qt::ISODate);
-        m_requestsTable->setItem(row, 5, new QTableWidgetItem(dt.toString("MM/dd/yy hh:mm")));
-        
-        // Status
-        QString status = query.value(6).toString();
-        auto *statusItem = new QTableWidgetItem(status);
-        if (status == "Pending") {
-            statusItem->setForeground(QBrush(QColor(255, 165, 0))); // Orange
-            statusItem->setFont(font);
-        } else if (status == "Approved") {
-            statusItem->setForeground(QBrush(QColor(0, 128, 0))); // Green
-        } else if (status == "Rejected") {
-            statusItem->setForeground(QBrush(QColor(220, 53, 69))); // Red
-        }
-        m_requestsTable->setItem(row, 6, statusItem);
-        
-        // Reviewed By
-        QString reviewedBy = query.value(7).toString();
-        m_requestsTable->setItem(row, 7, new QTableWidgetItem(reviewedBy.isEmpty() ? "-" : reviewedBy));
-        
-        row++;
-    }
+    m_requestsModel->load(query);
     
     m_requestsTable->resizeColumnsToContents();
 }
 
 void ProfileChangeRequestDialog::approveRequest()
 {
-    if (m_requestsTable->currentRow() < 0) {
+    if (m_requestsTable->currentIndex().row() < 0) {
         QMessageBox::information(this, "No Selection", "Please select a request to approve.");
         return;
     }
     
-    int row = m_requestsTable->currentRow();
-    int requestId = m_requestsTable->item(row, 0)->text().toInt();
-    QString status = m_requestsTable->item(row, 6)->text();
+    int row = m_requestsTable->currentIndex().row();
+    int requestId = static_cast<int>(m_requestsModel->integer(row, 0));
+    QString status = m_requestsModel->text(row, 6);
     
     if (status != "Pending") {
         QMessageBox::information(this, "Already Processed", 
@@ -192,14 +201,14 @@ void ProfileChangeRequestDialog::approveRequest()
 
 void ProfileChangeRequestDialog::rejectRequest()
 {
-    if (m_requestsTable->currentRow() < 0) {
+    if (m_requestsTable->currentIndex().row() < 0) {
         QMessageBox::information(this, "No Selection", "Please select a request to reject.");
         return;
     }
     
-    int row = m_requestsTable->currentRow();
-    int requestId = m_requestsTable->item(row, 0)->text().toInt();
-    QString status = m_requestsTable->item(row, 6)->text();
+    int row = m_requestsTable->currentIndex().row();
+    int requestId = static_cast<int>(m_requestsModel->integer(row, 0));
+    QString status = m_requestsModel->text(row, 6);
     
     if (status != "Pending") {
         QMessageBox::information(this, "Already Processed", 
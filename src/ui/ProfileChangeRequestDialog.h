@@ -1,7 +1,7 @@
 #pragma once
 
 #include <QDialog>
-#include <QTableWidget>
+#include <QTableView>
 #include <QPushButton>
 #include <QComboBox>
 
@@ -24,7 +24,8 @@ private:
     
     QString m_adminUsername;
     
-    QTableWidget *m_requestsTable = nullptr;
+    QTableView *m_requestsTable = nullptr;
+    class ResultTableModel *m_requestsModel = nullptr;
     QComboBox *m_statusFilter = nullptr;
     QPushButton *m_approveButton = nullptr;
     QPushButton *m_rejectButton = nullptr;
@@ -0,0 +1,375 @@
+#include "ResultTableModel.h"
+#include <QSqlRecord>
+#include <QBrush>
+#include <QFont>
+#include <algorithm>
+
+namespace {
+
+bool isInteger(int type)
+{
+    return type == QMetaType::Int || type == QMetaType::UInt || type == QMetaType::LongLong
+        || type == QMetaType::ULongLong || type == QMetaType::Bool;
+}
+
+bool isReal(int type)
+{
+    return type == QMetaType::Double || type == QMetaType::Float;
+}
+
+bool variantLess(const QVariant &left, const QVariant &right)
+{
+    const int leftType = left.typeId();
+    const int rightType = right.typeId();
+    if ((isInteger(leftType) || isReal(leftType)) && (isInteger(rightType) || isReal(rightType))) {
+        return left.toDouble() < right.toDouble();
+    }
+    return QString::localeAwareCompare(left.toString(), right.toString()) < 0;
+}
+
+} // namespace
+
+ResultTableModel::ResultTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+void ResultTableModel::setHeaders(const QStringList &headers)
+{
+    m_headers = headers;
+    if (!m_columns.isEmpty()) {
+        emit headerDataChanged(Qt::Horizontal, 0, m_columns.size() - 1);
+    }
+}
+
+void ResultTableModel::setFormatter(int column, Formatter formatter)
+{
+    if (column < 0) {
+        return;
+    }
+    if (column >= m_formatters.size()) {
+        m_formatters.resize(column + 1);
+    }
+    m_formatters[column] = std::move(formatter);
+}
+
+void ResultTableModel::setEmptyText(const QString &text)
+{
+    beginResetModel();
+    m_emptyText = text;
+    endResetModel();
+}
+
+void ResultTableModel::clear()
+{
+    beginResetModel();
+    m_columns.clear();
+    m_strings.clear();
+    m_stringIds.clear();
+    m_order.clear();
+    m_rowCount = 0;
+    endResetModel();
+}
+
+bool ResultTableModel::load(QSqlQuery &query)
+{
+    beginResetModel();
+    m_columns.clear();
+    m_strings.clear();
+    m_stringIds.clear();
+    m_order.clear();
+    m_rowCount = 0;
+
+    if (!query.isActive()) {
+        endResetModel();
+        return false;
+    }
+
+    const QSqlRecord record = query.record();
+    m_columns.resize(record.count());
+    for (int column = 0; column < m_columns.size(); ++column) {
+        m_columns[column].name = record.fieldName(column);
+    }
+
+    int row = 0;
+    while (query.next()) {
+        for (int column = 0; column < m_columns.size(); ++column) {
+            append(m_columns[column], row, query.value(column));
+        }
+        ++row;
+    }
+    m_rowCount = row;
+
+    if (m_sortColumn >= 0 && m_sortColumn < m_columns.size()) {
+        sortRows();
+    }
+    endResetModel();
+    return true;
+}
+
+int ResultTableModel::intern(const QString &text)
+{
+    const auto existing = m_stringIds.constFind(text);
+    if (existing != m_stringIds.constEnd()) {
+        return existing.value();
+    }
+    const int id = m_strings.size();
+    m_strings.append(text);
+    m_stringIds.insert(text, id);
+    return id;
+}
+
+void ResultTableModel::append(Column &column, int row, const QVariant &value)
+{
+    using ColumnKind = Column::Kind;
+
+    if (value.isNull()) {
+        column.nulls.resize(row + 1, false);
+        column.nulls[row] = true;
+        switch (column.kind) {
+        case ColumnKind::Empty: break;
+        case ColumnKind::Integer: column.integers.push_back(0); break;
+        case ColumnKind::Real: column.reals.push_back(0.0); break;
+        case ColumnKind::Text: column.strings.push_back(-1); break;
+        case ColumnKind::Variant: column.variants.emplace_back(); break;
+        }
+        return;
+    }
+
+    const int type = value.typeId();
+    ColumnKind kind = isInteger(type) ? ColumnKind::Integer
+        : isReal(type) ? ColumnKind::Real
+        : type == QMetaType::QString ? ColumnKind::Text
+        : ColumnKind::Variant;
+
+    if (column.kind == ColumnKind::Empty) {
+        // Every earlier row was null
+        column.kind = kind;
+        switch (kind) {
+        case ColumnKind::Integer: column.integers.resize(row, 0); break;
+        case ColumnKind::Real: column.reals.resize(row, 0.0); break;
+        case ColumnKind::Text: column.strings.resize(row, -1); break;
+        default: column.variants.resize(row); break;
+        }
+    } else if (column.kind != kind && column.kind != ColumnKind::Variant) {
+        if (column.kind == ColumnKind::Real && kind == ColumnKind::Integer) {
+            kind = ColumnKind::Real;
+        } else if (column.kind == ColumnKind::Integer && kind == ColumnKind::Real) {
+            column.reals.assign(column.integers.begin(), column.integers.end());
+            column.integers.clear();
+            column.integers.shrink_to_fit();
+            column.kind = ColumnKind::Real;
+        } else {
+            convertToVariants(column);
+        }
+    }
+
+    switch (column.kind) {
+    case ColumnKind::Integer: column.integers.push_back(value.toLongLong()); break;
+    case ColumnKind::Real: column.reals.push_back(value.toDouble()); break;
+    case ColumnKind::Text: column.strings.push_back(intern(value.toString())); break;
+    default: column.variants.push_back(value); break;
+    }
+}
+
+void ResultTableModel::convertToVariants(Column &column)
+{
+    const size_t size = column.kind == Column::Kind::Integer ? column.integers.size()
+        : column.kind == Column::Kind::Real ? column.reals.size()
+        : column.strings.size();
+
+    std::vector<QVariant> variants;
+    variants.reserve(size + 1);
+    for (size_t i = 0; i < size; ++i) {
+        variants.push_back(storedValue(column, static_cast<int>(i)));
+    }
+
+    column.integers = {};
+    column.reals = {};
+    column.strings = {};
+    column.variants = std::move(variants);
+    column.kind = Column::Kind::Variant;
+}
+
+QVariant ResultTableModel::storedValue(const Column &column, int index) const
+{
+    if (index < static_cast<int>(column.nulls.size()) && column.nulls[index]) {
+        return QVariant();
+    }
+    switch (column.kind) {
+    case Column::Kind::Integer: return column.integers[index];
+    case Column::Kind::Real: return column.reals[index];
+    case Column::Kind::Text: return column.strings[index] < 0 ? QString() : m_strings[column.strings[index]];
+    case Column::Kind::Variant: return column.variants[index];
+    default: return QVariant();
+    }
+}
+
+QVariant ResultTableModel::value(int row, int column) const
+{
+    if (row < 0 || row >= m_rowCount || column < 0 || column >= m_columns.size()) {
+        return QVariant();
+    }
+    return storedValue(m_columns[column], storageRow(row));
+}
+
+QString ResultTableModel::text(int row, int column) const
+{
+    if (row < 0 || row >= m_rowCount || column < 0 || column >= m_columns.size()) {
+        return QString();
+    }
+    const Column &entry = m_columns[column];
+    if (entry.kind == Column::Kind::Text) {
+        const int id = entry.strings[storageRow(row)];
+        return id < 0 ? QString() : m_strings[id];
+    }
+    return storedValue(entry, storageRow(row)).toString();
+}
+
+qint64 ResultTableModel::integer(int row, int column) const
+{
+    if (row < 0 || row >= m_rowCount || column < 0 || column >= m_columns.size()) {
+        return 0;
+    }
+    const Column &entry = m_columns[column];
+    if (entry.kind == Column::Kind::Integer) {
+        return entry.integers[storageRow(row)];
+    }
+    return storedValue(entry, storageRow(row)).toLongLong();
+}
+
+double ResultTableModel::real(int row, int column) const
+{
+    if (row < 0 || row >= m_rowCount || column < 0 || column >= m_columns.size()) {
+        return 0.0;
+    }
+    const Column &entry = m_columns[column];
+    if (entry.kind == Column::Kind::Real) {
+        return entry.reals[storageRow(row)];
+    }
+    return storedValue(entry, storageRow(row)).toDouble();
+}
+
+bool ResultTableModel::isNull(int row, int column) const
+{
+    return value(row, column).isNull();
+}
+
+int ResultTableModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return showsEmptyText() ? 1 : m_rowCount;
+}
+
+int ResultTableModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return std::max<int>(m_columns.size(), m_headers.size());
+}
+
+QVariant ResultTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid()) {
+        return QVariant();
+    }
+
+    if (showsEmptyText()) {
+        if (index.column() != 0) {
+            return QVariant();
+        }
+        switch (role) {
+        case Qt::DisplayRole:
+            return m_emptyText;
+        case Qt::TextAlignmentRole:
+            return QVariant::fromValue(Qt::Alignment(Qt::AlignCenter));
+        case Qt::FontRole: {
+            QFont font;
+            font.setItalic(true);
+            return font;
+        }
+        case Qt::ForegroundRole:
+            return QBrush(Qt::gray);
+        default:
+            return QVariant();
+        }
+    }
+
+    const int column = index.column();
+    if (column < m_formatters.size() && m_formatters[column]) {
+        const QVariant formatted = m_formatters[column](*this, index.row(), role);
+        if (formatted.isValid()) {
+            return formatted;
+        }
+    }
+    if (role == Qt::DisplayRole || role == Qt::EditRole) {
+        return value(index.row(), column);
+    }
+    return QVariant();
+}
+
+QVariant ResultTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole && section >= 0) {
+        if (section < m_headers.size() && !m_headers[section].isEmpty()) {
+            return m_headers[section];
+        }
+        if (section < m_columns.size()) {
+            return m_columns[section].name;
+        }
+    }
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+void ResultTableModel::sort(int column, Qt::SortOrder order)
+{
+    if (column < 0 || column >= m_columns.size()) {
+        return;
+    }
+    m_sortColumn = column;
+    m_sortOrder = order;
+
+    // Reset rather than remap persistent indexes; the selection is cleared
+    beginResetModel();
+    sortRows();
+    endResetModel();
+}
+
+void ResultTableModel::sortRows()
+{
+    const Column &column = m_columns[m_sortColumn];
+    m_order.resize(m_rowCount);
+    for (int row = 0; row < m_rowCount; ++row) {
+        m_order[row] = row;
+    }
+
+    // Sorts on the raw values, so formatted dates and numbers still order correctly
+    const auto less = [this, &column](int left, int right) {
+        const bool leftNull = left < static_cast<int>(column.nulls.size()) && column.nulls[left];
+        const bool rightNull = right < static_cast<int>(column.nulls.size()) && column.nulls[right];
+        if (leftNull || rightNull) {
+            return leftNull && !rightNull;
+        }
+        switch (column.kind) {
+        case Column::Kind::Integer:
+            return column.integers[left] < column.integers[right];
+        case Column::Kind::Real:
+            return column.reals[left] < column.reals[right];
+        case Column::Kind::Text:
+            return QString::localeAwareCompare(m_strings[column.strings[left]], m_strings[column.strings[right]]) < 0;
+        case Column::Kind::Variant:
+            return variantLess(column.variants[left], column.variants[right]);
+        default:
+            return false;
+        }
+    };
+
+    if (m_sortOrder == Qt::AscendingOrder) {
+        std::stable_sort(m_order.begin(), m_order.end(), less);
+    } else {
+        std::stable_sort(m_order.begin(), m_order.end(), [&less](int left, int right) { return less(right, left); });
+    }
+}
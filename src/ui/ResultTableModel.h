@@ -0,0 +1,101 @@
+#pragma once
+
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QSqlQuery>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Read-only table of a query result, stored column by column
+ *
+ * load() reads an executed (ideally forward-only) query in one pass. Each column
+ * keeps its values in one contiguous array of integers, reals or string ids;
+ * strings go into a pool shared by every column, so a status or name repeated
+ * down the table is stored once. A column that mixes kinds falls back to
+ * QVariants. Nothing is allocated per cell.
+ *
+ * Columns show their raw value unless a formatter is set. A formatter gets the
+ * model, the row and the role, and returns QVariant() for roles it leaves alone,
+ * so one function can supply the text, colour, font and alignment of a column
+ * and read any other column of the row to do it.
+ */
+class ResultTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    using Formatter = std::function<QVariant(const ResultTableModel &model, int row, int role)>;
+
+    explicit ResultTableModel(QObject *parent = nullptr);
+    ~ResultTableModel() = default;
+
+    /**
+     * @brief Header labels by column; columns without a label show the query's column name
+     */
+    void setHeaders(const QStringList &headers);
+    void setFormatter(int column, Formatter formatter);
+
+    /**
+     * @brief Text shown in a single placeholder row while the model has no rows
+     */
+    void setEmptyText(const QString &text);
+    bool showsEmptyText() const { return m_rowCount == 0 && !m_emptyText.isEmpty(); }
+
+    /**
+     * @brief Replaces the contents with every remaining row of an executed query
+     * @return false if the query is not active
+     */
+    bool load(QSqlQuery &query);
+    void clear();
+
+    int resultRowCount() const { return m_rowCount; }
+
+    // Raw values of a row as currently sorted
+    QVariant value(int row, int column) const;
+    QString text(int row, int column) const;
+    qint64 integer(int row, int column) const;
+    double real(int row, int column) const;
+    bool isNull(int row, int column) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+private:
+    struct Column {
+        enum class Kind { Empty, Integer, Real, Text, Variant };
+
+        QString name;
+        Kind kind = Kind::Empty;
+        std::vector<qint64> integers;
+        std::vector<double> reals;
+        std::vector<int> strings;           // Ids into m_strings
+        std::vector<QVariant> variants;
+        std::vector<bool> nulls;            // Only as long as the last null
+    };
+
+    void append(Column &column, int row, const QVariant &value);
+    void convertToVariants(Column &column);
+    QVariant storedValue(const Column &column, int index) const;
+    int intern(const QString &text);
+    void sortRows();
+    int storageRow(int row) const { return m_order.empty() ? row : m_order[row]; }
+
+    QVector<Column> m_columns;
+    QStringList m_headers;
+    QVector<Formatter> m_formatters;
+    QString m_emptyText;
+    int m_rowCount = 0;
+
+    QVector<QString> m_strings;
+    QHash<QString, int> m_stringIds;
+
+    std::vector<int> m_order;               // Sorted row -> stored row; empty when unsorted
+    int m_sortColumn = -1;
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+};
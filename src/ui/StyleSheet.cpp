@@ -0,0 +1,678 @@
+#include "StyleSheet.h"
+#include <QWidget>
+#include <QStyle>
+
+namespace AdobeStyles {
+
+namespace {
+
+// ==================== BASE COMPONENTS ====================
+
+QString mainWindowRules()
+{
+    return
+        "QMainWindow { "
+        "   background-color: " + DARK_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QMainWindow::separator { "
+        "   background: " + BORDER_GRAY + "; "
+        "   width: 1px; "
+        "   height: 1px; "
+        "} "
+        "DashboardWidget { "
+        "   background-color: " + DARK_BG + "; "
+        "} "
+        "LoginDialog { "
+        "   background-color: " + SURFACE_BG + "; "
+        "} ";
+}
+
+QString toolbarRules()
+{
+    return
+        "QToolBar { "
+        "   background: " + CARD_BG + "; "
+        "   border: none; "
+        "   border-bottom: 1px solid " + BORDER_GRAY + "; "
+        "   padding: 12px 16px; "
+        "   spacing: 8px; "
+        "} "
+        "QToolBar::separator { "
+        "   background: " + BORDER_GRAY + "; "
+        "   width: 1px; "
+        "   margin: 8px 4px; "
+        "} "
+        "QToolButton { "
+        "   background: transparent; "
+        "   border: none; "
+        "   color: " + TEXT_SECONDARY + "; "
+        "   padding: 8px 12px; "
+        "   border-radius: 6px; "
+        "   font-size: 13px; "
+        "   font-weight: 500; "
+        "   min-width: 32px; "
+        "   min-height: 32px; "
+        "} "
+        "QToolButton:hover { "
+        "   background: " + HOVER_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QToolButton:pressed { "
+        "   background: " + ACTIVE_BG + "; "
+        "   color: " + ADOBE_BLUE + "; "
+        "} "
+        "QToolButton:checked { "
+        "   background: " + SELECTED_BG + "; "
+        "   color: white; "
+        "} ";
+}
+
+QString tableRules()
+{
+    return
+        "QTableView { "
+        "   background-color: " + CARD_BG + "; "
+        "   alternate-background-color: " + SURFACE_BG + "; "
+        "   selection-background-color: " + SELECTED_BG + "; "
+        "   selection-color: white; "
+        "   gridline-color: " + BORDER_GRAY + "; "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "   border-radius: 8px; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QTableView::item { "
+        "   padding: 12px 8px; "
+        "   border: none; "
+        "} "
+        "QTableView::item:hover { "
+        "   background-color: " + HOVER_BG + "; "
+        "} "
+        "QTableView::item:selected { "
+        "   background-color: " + SELECTED_BG + "; "
+        "   color: white; "
+        "} "
+        "QHeaderView::section { "
+        "   background: " + SURFACE_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   padding: 12px 8px; "
+        "   border: none; "
+        "   border-right: 1px solid " + BORDER_GRAY + "; "
+        "   border-bottom: 1px solid " + BORDER_GRAY + "; "
+        "   font-weight: 600; "
+        "   font-size: 13px; "
+        "} ";
+}
+
+QString tabRules()
+{
+    return
+        "QTabWidget::pane { "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "   border-radius: 8px; "
+        "   background: " + CARD_BG + "; "
+        "   top: -1px; "
+        "} "
+        "QTabBar::tab { "
+        "   background: " + SURFACE_BG + "; "
+        "   color: " + TEXT_SECONDARY + "; "
+        "   padding: 12px 20px; "
+        "   margin-right: 2px; "
+        "   border-top-left-radius: 8px; "
+        "   border-top-right-radius: 8px; "
+        "   font-size: 14px; "
+        "   font-weight: 500; "
+        "   min-width: 120px; "
+        "   border: 1px solid transparent; "
+        "   border-bottom: none; "
+        "} "
+        "QTabBar::tab:hover { "
+        "   background: " + HOVER_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QTabBar::tab:selected { "
+        "   background: " + CARD_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   border-color: " + BORDER_GRAY + "; "
+        "   font-weight: 600; "
+        "} "
+        "QTabBar::tab:!selected { "
+        "   margin-top: 2px; "
+        "} ";
+}
+
+QString inputRules()
+{
+    return
+        "QLineEdit { "
+        "   border: 2px solid " + BORDER_GRAY + "; "
+        "   border-radius: 10px; "
+        "   padding: 14px 18px; "
+        "   background: " + SURFACE_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   font-size: 14px; "
+        "   min-height: 24px; "
+        "} "
+        "QLineEdit:focus { "
+        "   border-color: " + NMERA_PRIMARY + "; "
+        "   background: " + CARD_BG + "; "
+        "} "
+        "QLineEdit:disabled { "
+        "   background: " + SURFACE_BG + "; "
+        "   color: " + TEXT_MUTED + "; "
+        "   border-color: " + BORDER_GRAY + "; "
+        "} "
+        "QTextEdit { "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "   border-radius: 8px; "
+        "   padding: 12px 16px; "
+        "   background: " + SURFACE_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   font-size: 14px; "
+        "   min-height: 80px; "
+        "} "
+        "QTextEdit:focus { "
+        "   border-color: " + ADOBE_BLUE + "; "
+        "   border-width: 2px; "
+        "   background: " + CARD_BG + "; "
+        "} "
+        "QTextEdit:disabled { "
+        "   background: " + SURFACE_BG + "; "
+        "   color: " + TEXT_MUTED + "; "
+        "} "
+        "QComboBox { "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "   border-radius: 8px; "
+        "   padding: 12px 16px; "
+        "   background: " + SURFACE_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   font-size: 14px; "
+        "   min-width: 120px; "
+        "   min-height: 20px; "
+        "} "
+        "QComboBox:focus { "
+        "   border-color: " + ADOBE_BLUE + "; "
+        "   border-width: 2px; "
+        "   background: " + CARD_BG + "; "
+        "} "
+        "QComboBox::drop-down { "
+        "   border: none; "
+        "   background: " + BORDER_GRAY + "; "
+        "   width: 32px; "
+        "   border-top-right-radius: 7px; "
+        "   border-bottom-right-radius: 7px; "
+        "} "
+        "QComboBox::down-arrow { "
+        "   image: none; "
+        "   border-left: 5px solid transparent; "
+        "   border-right: 5px solid transparent; "
+        "   border-top: 6px solid " + TEXT_SECONDARY + "; "
+        "   margin-right: 8px; "
+        "} "
+        "QComboBox QAbstractItemView { "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "   border-radius: 8px; "
+        "   selection-background-color: " + SELECTED_BG + "; "
+        "   selection-color: white; "
+        "   background: " + CARD_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   font-size: 14px; "
+        "   padding: 8px; "
+        "} "
+        "QSpinBox, QDoubleSpinBox, QDateEdit, QTimeEdit { "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "   border-radius: 8px; "
+        "   padding: 12px 16px; "
+        "   background: " + SURFACE_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   font-size: 14px; "
+        "   min-height: 20px; "
+        "} "
+        "QSpinBox:focus, QDoubleSpinBox:focus, QDateEdit:focus, QTimeEdit:focus { "
+        "   border-color: " + ADOBE_BLUE + "; "
+        "   border-width: 2px; "
+        "   background: " + CARD_BG + "; "
+        "} "
+        "QDoubleSpinBox[variant=\"compact\"] { "
+        "   padding: 8px; "
+        "   font-size: 11pt; "
+        "} "
+        "QCheckBox { "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   font-size: 10pt; "
+        "} "
+        "QProgressBar { "
+        "   border: 2px solid " + BORDER_GRAY + "; "
+        "   border-radius: 8px; "
+        "   background: " + SURFACE_BG + "; "
+        "   text-align: center; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   font-weight: 600; "
+        "   height: 20px; "
+        "} "
+        "QProgressBar::chunk { "
+        "   background: " + GRADIENT_PRIMARY + "; "
+        "   border-radius: 6px; "
+        "} ";
+}
+
+QString calendarRules()
+{
+    return
+        "QCalendarWidget { "
+        "   background: " + SURFACE_BG + "; "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "   border-radius: 8px; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QCalendarWidget QAbstractItemView { "
+        "   selection-background-color: " + ADOBE_BLUE + "; "
+        "   selection-color: white; "
+        "} "
+        "QCalendarWidget QToolButton { "
+        "   background: " + ADOBE_BLUE + "; "
+        "   color: white; "
+        "   border-radius: 4px; "
+        "   padding: 4px; "
+        "} "
+        "QCalendarWidget QToolButton:hover { "
+        "   background: " + ADOBE_BLUE_LIGHT + "; "
+        "} "
+        // Small month view beside the dashboard statistics
+        "QCalendarWidget[variant=\"compact\"] { "
+        "   background-color: white; "
+        "   border: 2px solid " + BORDER_GRAY + "; "
+        "   border-radius: 6px; "
+        "   padding: 3px; "
+        "} "
+        "QCalendarWidget[variant=\"compact\"] QWidget { "
+        "   alternate-background-color: " + SURFACE_BG + "; "
+        "   background-color: white; "
+        "} "
+        "QCalendarWidget[variant=\"compact\"] QAbstractItemView { "
+        "   font-size: 9pt; "
+        "   border-radius: 3px; "
+        "} "
+        "QCalendarWidget[variant=\"compact\"] QAbstractItemView:enabled { "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QCalendarWidget[variant=\"compact\"] QAbstractItemView:disabled { "
+        "   color: #cccccc; "
+        "} "
+        "QCalendarWidget[variant=\"compact\"] QToolButton { "
+        "   border-radius: 3px; "
+        "   padding: 3px; "
+        "   font-weight: bold; "
+        "   font-size: 9pt; "
+        "   min-width: 20px; "
+        "   margin: 1px; "
+        "} "
+        "QCalendarWidget[variant=\"compact\"] QToolButton:pressed { "
+        "   background-color: " + ADOBE_BLUE_DARK + "; "
+        "} "
+        "QCalendarWidget[variant=\"compact\"] QMenu { "
+        "   background-color: white; "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "} "
+        "QCalendarWidget[variant=\"compact\"] QSpinBox { "
+        "   font-size: 9pt; "
+        "   padding: 2px; "
+        "} "
+        "QCalendarWidget[variant=\"compact\"] QWidget#qt_calendar_navigationbar { "
+        "   background-color: " + ADOBE_BLUE + "; "
+        "   border-radius: 4px; "
+        "   padding: 1px; "
+        "} ";
+}
+
+// ==================== BUTTON VARIANTS ====================
+
+QString buttonRules()
+{
+    return
+        "QPushButton[variant=\"primary\"] { "
+        "   background: " + GRADIENT_PRIMARY + "; "
+        "   color: white; "
+        "   border: none; "
+        "   border-radius: 10px; "
+        "   padding: 14px 28px; "
+        "   font-weight: 600; "
+        "   font-size: 14px; "
+        "   min-width: 140px; "
+        "   min-height: 44px; "
+        "} "
+        "QPushButton[variant=\"primary\"]:hover { "
+        "   background: " + GRADIENT_FIRE + "; "
+        "} "
+        "QPushButton[variant=\"primary\"]:pressed { "
+        "   background: " + NMERA_PRIMARY_DARK + "; "
+        "} "
+        "QPushButton[variant=\"primary\"]:disabled { "
+        "   background: " + BORDER_GRAY + "; "
+        "   color: " + TEXT_MUTED + "; "
+        "} "
+        "QPushButton[variant=\"secondary\"] { "
+        "   background: " + CARD_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   border: 2px solid " + BORDER_GRAY + "; "
+        "   border-radius: 10px; "
+        "   padding: 14px 28px; "
+        "   font-weight: 500; "
+        "   font-size: 14px; "
+        "   min-width: 140px; "
+        "   min-height: 44px; "
+        "} "
+        "QPushButton[variant=\"secondary\"]:hover { "
+        "   background: " + HOVER_BG + "; "
+        "   border-color: " + NMERA_PRIMARY + "; "
+        "} "
+        "QPushButton[variant=\"secondary\"]:pressed { "
+        "   background: " + ACTIVE_BG + "; "
+        "} "
+        "QPushButton[variant=\"cancel\"] { "
+        "   background: " + CARD_BG + "; "
+        "   color: " + ERROR_RED + "; "
+        "   border: 1px solid " + ERROR_RED + "; "
+        "   border-radius: 8px; "
+        "   padding: 12px 24px; "
+        "   font-weight: 500; "
+        "   font-size: 14px; "
+        "   min-width: 120px; "
+        "   min-height: 40px; "
+        "} "
+        "QPushButton[variant=\"cancel\"]:hover { "
+        "   background: " + ERROR_RED + "; "
+        "   color: white; "
+        "} "
+        "QPushButton[variant=\"cancel\"]:pressed { "
+        "   background: #DC2626; "
+        "} "
+        // Small filled buttons for approve/reject style actions
+        "QPushButton[variant=\"approve\"], QPushButton[variant=\"danger\"] { "
+        "   color: white; "
+        "   border: none; "
+        "   border-radius: 6px; "
+        "   padding: 8px 16px; "
+        "   font-weight: 600; "
+        "} "
+        "QPushButton[variant=\"approve\"] { "
+        "   background: " + SUCCESS_GREEN + "; "
+        "} "
+        "QPushButton[variant=\"danger\"] { "
+        "   background: " + ERROR_RED + "; "
+        "} "
+        "QPushButton[variant=\"approve\"]:disabled, QPushButton[variant=\"danger\"]:disabled { "
+        "   background: " + BORDER_GRAY + "; "
+        "   color: " + TEXT_MUTED + "; "
+        "} ";
+}
+
+// ==================== CARDS AND GROUP BOXES ====================
+
+QString groupBoxRule(const QString &selector, const QString &accent)
+{
+    return
+        selector + " { "
+        "   border: 1px solid " + accent + "; "
+        "   border-radius: 12px; "
+        "   margin-top: 16px; "
+        "   padding: 20px; "
+        "   font-weight: 600; "
+        "   background: " + CARD_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} " +
+        selector + "::title { "
+        "   subcontrol-origin: margin; "
+        "   subcontrol-position: top left; "
+        "   padding: 8px 16px; "
+        "   background: " + accent + "; "
+        "   color: white; "
+        "   border-radius: 8px; "
+        "   left: 16px; "
+        "   font-size: 14px; "
+        "   font-weight: 600; "
+        "} ";
+}
+
+QString groupBoxRules()
+{
+    return
+        "QGroupBox { "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "   border-radius: 12px; "
+        "   margin-top: 16px; "
+        "   padding: 20px; "
+        "   font-weight: 600; "
+        "   font-size: 14px; "
+        "   background: " + CARD_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QGroupBox::title { "
+        "   subcontrol-origin: margin; "
+        "   subcontrol-position: top left; "
+        "   padding: 8px 16px; "
+        "   background: " + SURFACE_BG + "; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "   border-radius: 8px; "
+        "   left: 16px; "
+        "   font-size: 14px; "
+        "   font-weight: 600; "
+        "} " +
+        groupBoxRule("QGroupBox[variant=\"success\"]", SUCCESS_GREEN) +
+        groupBoxRule("QGroupBox[variant=\"fire\"]", ADOBE_BLUE) +
+        groupBoxRule("QGroupBox[variant=\"urgent\"]", WARNING_ORANGE) +
+        groupBoxRule("QGroupBox[variant=\"danger\"]", ERROR_RED) +
+        // Statistics banner across the top of the dashboard
+        "QGroupBox[variant=\"stats\"] { "
+        "   border: 3px solid " + ADOBE_BLUE + "; "
+        "   border-radius: 15px; "
+        "   margin-top: 18px; "
+        "   padding: 15px 20px 15px 20px; "
+        "   font-weight: bold; "
+        "   background: " + CARD_BG + "; "
+        "} "
+        "QGroupBox[variant=\"stats\"]::title { "
+        "   subcontrol-origin: margin; "
+        "   subcontrol-position: top center; "
+        "   padding: 8px 20px; "
+        "   background: " + GRADIENT_PRIMARY + "; "
+        "   color: white; "
+        "   border-radius: 8px; "
+        "   font-size: 13pt; "
+        "   font-weight: bold; "
+        "} "
+        "QWidget[variant=\"card\"] { "
+        "   background: " + CARD_BG + "; "
+        "   border-radius: 12px; "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "} "
+        "QWidget[variant=\"tile\"] { "
+        "   background: " + SURFACE_BG + "; "
+        "   border-radius: 8px; "
+        "   border: 1px solid " + BORDER_GRAY + "; "
+        "} "
+        "QWidget[variant=\"alertPanel\"] { "
+        "   background-color: #ffebe0; "
+        "   border: 2px solid #ff6b35; "
+        "   border-radius: 8px; "
+        "   margin: 5px; "
+        "} "
+        "QFrame[variant=\"separator\"] { "
+        "   background-color: " + BORDER_GRAY + "; "
+        "   min-height: 1px; "
+        "   max-height: 1px; "
+        "   margin: 5px 0px; "
+        "} ";
+}
+
+// ==================== LABELS ====================
+
+QString labelRules()
+{
+    return
+        "QLabel { "
+        "   color: " + TEXT_SECONDARY + "; "
+        "   font-size: 14px; "
+        "   font-weight: 500; "
+        "   padding: 4px 0px; "
+        "} "
+        "QLabel[variant=\"header\"] { "
+        "   font-size: 24px; "
+        "   font-weight: 700; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QLabel[variant=\"subheader\"] { "
+        "   font-size: 18px; "
+        "   font-weight: 600; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QLabel[variant=\"value\"] { "
+        "   font-size: 16px; "
+        "   font-weight: 600; "
+        "   color: " + TEXT_PRIMARY + "; "
+        "} "
+        "QLabel[variant=\"icon\"] { "
+        "   font-size: 16px; "
+        "} "
+        "QLabel[variant=\"caption\"] { "
+        "   font-size: 12px; "
+        "} "
+        "QLabel[variant=\"fine\"] { "
+        "   font-size: 8pt; "
+        "} "
+        "QLabel[variant=\"strong\"], QCheckBox[variant=\"strong\"] { "
+        "   font-weight: bold; "
+        "} "
+        // Gradient title strip at the top of a page or dialog
+        "QLabel[variant=\"banner\"] { "
+        "   background: " + GRADIENT_PRIMARY + "; "
+        "   color: white; "
+        "   font-size: 16pt; "
+        "   font-weight: bold; "
+        "   padding: 15px; "
+        "   border-radius: 10px; "
+        "   margin-bottom: 10px; "
+        "} "
+        "QLabel[variant=\"infoBanner\"] { "
+        "   background: qlineargradient(x1:0, y1:0, x2:1, y2:0, "
+        "       stop:0 " + ADOBE_BLUE + ", stop:1 " + ADOBE_BLUE_DARK + "); "
+        "   color: white; "
+        "   font-size: 18pt; "
+        "   font-weight: bold; "
+        "   padding: 15px; "
+        "   border-radius: 8px; "
+        "   margin-bottom: 10px; "
+        "} "
+        "QLabel[variant=\"error\"] { "
+        "   color: white; "
+        "   background-color: " + ERROR_RED + "; "
+        "   padding: 12px; "
+        "   border-radius: 6px; "
+        "   font-size: 10pt; "
+        "   font-weight: bold; "
+        "} "
+        // Numbers: total > figure > metric > stat > reading
+        "QLabel[variant=\"total\"] { "
+        "   font-size: 24pt; "
+        "   font-weight: bold; "
+        "} "
+        "QLabel[variant=\"figure\"] { "
+        "   font-size: 18pt; "
+        "   font-weight: bold; "
+        "} "
+        "QLabel[variant=\"metric\"] { "
+        "   font-size: 13pt; "
+        "   padding: 5px; "
+        "} "
+        "QLabel[variant=\"stat\"] { "
+        "   font-size: 11pt; "
+        "   padding: 3px; "
+        "} "
+        "QLabel[variant=\"reading\"] { "
+        "   font-size: 9pt; "
+        "   font-weight: bold; "
+        "} "
+        // Boxed notice whose colours follow its tone
+        "QLabel[variant=\"notice\"] { "
+        "   padding: 10px; "
+        "   border-radius: 5px; "
+        "} "
+        "QLabel[variant=\"notice\"][tone=\"error\"], QLabel[variant=\"notice\"][tone=\"warning\"] { "
+        "   font-weight: bold; "
+        "} ";
+}
+
+// ==================== TONES ====================
+
+QString toneRules()
+{
+    return
+        "QLabel[tone=\"primary\"] { color: " + TEXT_PRIMARY + "; } "
+        "QLabel[tone=\"muted\"] { color: #6b7280; } "
+        "QLabel[tone=\"accent\"] { color: " + ADOBE_BLUE + "; } "
+        "QLabel[tone=\"success\"] { color: " + SUCCESS_GREEN + "; } "
+        "QLabel[tone=\"warning\"] { color: " + WARNING_ORANGE + "; } "
+        "QLabel[tone=\"error\"] { color: " + ERROR_RED + "; } "
+        "QLabel[tone=\"alert\"] { color: #ff6b35; } "
+        "QLabel[tone=\"critical\"] { color: #c1421e; font-weight: bold; } "
+        "QLabel[tone=\"low\"] { color: #d97732; } "
+        "QLabel[variant=\"notice\"][tone=\"success\"] { background-color: #ccffcc; color: #006600; } "
+        "QLabel[variant=\"notice\"][tone=\"warning\"] { background-color: #ffffcc; color: #cc6600; } "
+        "QLabel[variant=\"notice\"][tone=\"error\"] { background-color: #ffcccc; color: #cc0000; } "
+        "QTextEdit[tone=\"success\"] { "
+        "   background-color: #d4edda; "
+        "   border: 1px solid #28a745; "
+        "   color: #155724; "
+        "} "
+        "QTextEdit[tone=\"warning\"] { "
+        "   background-color: #fff3cd; "
+        "   border: 1px solid #ffc107; "
+        "   color: #856404; "
+        "} "
+        "QTextEdit[tone=\"error\"] { "
+        "   background-color: #f8d7da; "
+        "   border: 1px solid #dc3545; "
+        "   color: #721c24; "
+        "} ";
+}
+
+void repolish(QWidget *widget)
+{
+    // Property selectors are only re-evaluated when the widget is polished again
+    if (widget->testAttribute(Qt::WA_WState_Polished)) {
+        widget->style()->unpolish(widget);
+        widget->style()->polish(widget);
+    }
+}
+
+} // namespace
+
+const QString &applicationStyleSheet()
+{
+    static const QString sheet =
+        mainWindowRules() +
+        toolbarRules() +
+        tableRules() +
+        tabRules() +
+        inputRules() +
+        calendarRules() +
+        buttonRules() +
+        groupBoxRules() +
+        labelRules() +
+        toneRules();
+    return sheet;
+}
+
+void setVariant(QWidget *widget, const char *variant)
+{
+    widget->setProperty("variant", QString::fromLatin1(variant));
+    repolish(widget);
+}
+
+void setTone(QWidget *widget, const char *tone)
+{
+    widget->setProperty("tone", QString::fromLatin1(tone));
+    repolish(widget);
+}
+
+} // namespace AdobeStyles
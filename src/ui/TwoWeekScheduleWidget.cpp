@@ -0,0 +1,218 @@
+#include "TwoWeekScheduleWidget.h"
+#include "StyleSheet.h"
+#include "Codes.h"
+#include "DateRange.h"
+#include <QPainter>
+#include <QHelpEvent>
+#include <QToolTip>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+
+using namespace firewood::core;
+
+namespace {
+
+constexpr int Columns = 7;
+constexpr int Spacing = 6;
+constexpr int Padding = 6;
+constexpr int TextLines = 4;
+
+} // namespace
+
+TwoWeekScheduleWidget::TwoWeekScheduleWidget(QWidget *parent)
+    : QWidget(parent), m_start(QDate::currentDate())
+{
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
+    reload();
+}
+
+void TwoWeekScheduleWidget::setStartDate(const QDate &date)
+{
+    if (date == m_start) {
+        return;
+    }
+    m_start = date;
+    reload();
+}
+
+void TwoWeekScheduleWidget::reload()
+{
+    m_days.fill(Day());
+
+    const DateRange range = DateRange::between(m_start, m_start.addDays(DayCount - 1));
+
+    // Open orders per delivery day and shifts per work day, both read in day order
+    // from their day-number indexes
+    QSqlQuery query;
+    query.prepare(QString("SELECT 0, delivery_day, COUNT(*), COALESCE(SUM(requested_cords), 0), 0 FROM orders "
+                          "WHERE status_code IN (%1) AND delivery_day >= ? AND delivery_day < ? "
+                          "GROUP BY delivery_day "
+                          "UNION ALL "
+                          "SELECT 1, work_day, COUNT(*), COALESCE(SUM(slots_filled), 0), COALESCE(SUM(volunteer_slots), 0) "
+                          "FROM work_schedule WHERE work_day >= ? AND work_day < ? "
+                          "GROUP BY work_day")
+                      .arg(openOrderStatusCodeList()));
+    query.addBindValue(range.firstDay());
+    query.addBindValue(range.endDay());
+    query.addBindValue(range.firstDay());
+    query.addBindValue(range.endDay());
+
+    if (!query.exec()) {
+        qDebug() << "ERROR: Failed to load two-week schedule:" << query.lastError().text();
+        update();
+        return;
+    }
+
+    while (query.next()) {
+        const qint64 index = query.value(1).toLongLong() - range.firstDay();
+        if (index < 0 || index >= DayCount) {
+            continue;
+        }
+        Day &day = m_days[index];
+        if (query.value(0).toInt() == 0) {
+            day.orders = query.value(2).toInt();
+            day.cords = query.value(3).toDouble();
+        } else {
+            day.shifts = query.value(2).toInt();
+            day.volunteers = query.value(3).toInt();
+            day.slots = query.value(4).toInt();
+        }
+    }
+
+    update();
+}
+
+QSize TwoWeekScheduleWidget::sizeHint() const
+{
+    const QFontMetrics metrics(font());
+    const int cellWidth = metrics.horizontalAdvance("99.9 cords") + 2 * Padding;
+    const int cellHeight = TextLines * metrics.lineSpacing() + 2 * Padding;
+    const int rows = DayCount / Columns;
+    return QSize(Columns * cellWidth + (Columns - 1) * Spacing, rows * cellHeight + (rows - 1) * Spacing);
+}
+
+QSize TwoWeekScheduleWidget::minimumSizeHint() const
+{
+    const QFontMetrics metrics(font());
+    const int cellWidth = metrics.horizontalAdvance("Wed 30") + 2 * Padding;
+    return QSize(Columns * cellWidth + (Columns - 1) * Spacing, sizeHint().height());
+}
+
+QRect TwoWeekScheduleWidget::cellRect(int index) const
+{
+    const int rows = DayCount / Columns;
+    const int cellWidth = (width() - (Columns - 1) * Spacing) / Columns;
+    const int cellHeight = (height() - (rows - 1) * Spacing) / rows;
+    const int column = index % Columns;
+    const int row = index / Columns;
+    return QRect(column * (cellWidth + Spacing), row * (cellHeight + Spacing), cellWidth, cellHeight);
+}
+
+int TwoWeekScheduleWidget::dayAt(const QPoint &pos) const
+{
+    for (int i = 0; i < DayCount; ++i) {
+        if (cellRect(i).contains(pos)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void TwoWeekScheduleWidget::paintEvent(QPaintEvent *)
+{
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    const QDate today = QDate::currentDate();
+    const QFontMetrics metrics(font());
+    QFont boldFont = font();
+    boldFont.setBold(true);
+
+    const QColor emptyBackground(AdobeStyles::CARD_BG);
+    const QColor busyBackground(AdobeStyles::SURFACE_BG);
+    const QColor border(AdobeStyles::BORDER_GRAY);
+    const QColor todayBorder(AdobeStyles::NMERA_PRIMARY);
+    const QColor dayColor(AdobeStyles::ADOBE_BLUE_LIGHT);
+    const QColor textColor(AdobeStyles::TEXT_PRIMARY);
+    const QColor mutedColor(AdobeStyles::TEXT_MUTED);
+    const QColor shiftColor(AdobeStyles::INFO_CYAN);
+
+    for (int i = 0; i < DayCount; ++i) {
+        const QDate date = m_start.addDays(i);
+        const Day &day = m_days[i];
+        const bool busy = day.orders > 0 || day.shifts > 0;
+        const QRectF cell = QRectF(cellRect(i)).adjusted(0.5, 0.5, -0.5, -0.5);
+
+        painter.setPen(date == today ? QPen(todayBorder, 2) : QPen(border, 1));
+        painter.setBrush(busy ? busyBackground : emptyBackground);
+        painter.drawRoundedRect(cell, 4, 4);
+
+        QRect line = cellRect(i).adjusted(Padding, Padding, -Padding, 0);
+        line.setHeight(metrics.lineSpacing());
+        const auto drawLine = [&](const QString &text, const QColor &color) {
+            painter.setPen(color);
+            painter.drawText(line, Qt::AlignLeft | Qt::AlignVCenter,
+                             metrics.elidedText(text, Qt::ElideRight, line.width()));
+            line.translate(0, metrics.lineSpacing());
+        };
+
+        painter.setFont(boldFont);
+        drawLine(date.toString("ddd d"), date == today ? todayBorder : dayColor);
+        painter.setFont(font());
+
+        if (day.orders > 0) {
+            drawLine(QString("%1 %2").arg(day.orders).arg(day.orders == 1 ? "order" : "orders"), textColor);
+            drawLine(QString("%1 cords").arg(day.cords, 0, 'f', 1), textColor);
+        } else {
+            drawLine("No orders", mutedColor);
+            line.translate(0, metrics.lineSpacing());
+        }
+
+        if (day.shifts > 0) {
+            drawLine(QString("%1 %2").arg(day.shifts).arg(day.shifts == 1 ? "shift" : "shifts"), shiftColor);
+        }
+    }
+}
+
+bool TwoWeekScheduleWidget::event(QEvent *event)
+{
+    if (event->type() == QEvent::ToolTip) {
+        auto *helpEvent = static_cast<QHelpEvent *>(event);
+        const int index = dayAt(helpEvent->pos());
+        if (index >= 0) {
+            QToolTip::showText(helpEvent->globalPos(), toolTipFor(index), this, cellRect(index));
+        } else {
+            QToolTip::hideText();
+            event->ignore();
+        }
+        return true;
+    }
+    return QWidget::event(event);
+}
+
+QString TwoWeekScheduleWidget::toolTipFor(int index) const
+{
+    const Day &day = m_days[index];
+    QStringList lines;
+    lines << m_start.addDays(index).toString("dddd, MMMM d, yyyy");
+
+    if (day.orders > 0) {
+        lines << QString("%1 open %2, %3 cords requested")
+                     .arg(day.orders)
+                     .arg(day.orders == 1 ? "order" : "orders")
+                     .arg(day.cords, 0, 'f', 1);
+    } else {
+        lines << "No deliveries scheduled";
+    }
+
+    if (day.shifts > 0) {
+        lines << QString("%1 %2, %3 of %4 volunteer slots filled")
+                     .arg(day.shifts)
+                     .arg(day.shifts == 1 ? "work shift" : "work shifts")
+                     .arg(day.volunteers)
+                     .arg(day.slots);
+    }
+
+    return lines.join('\n');
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QWidget>
+#include <QDate>
+#include <array>
+
+/**
+ * @brief Fourteen days of open deliveries and work shifts, painted as two rows of seven
+ *
+ * Each day shows how many open orders are due and their requested cords, and the
+ * work_schedule shifts with volunteers signed up against slots. All of it comes
+ * from one range query over the day-number indexes; hover a day for details.
+ */
+class TwoWeekScheduleWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    static constexpr int DayCount = 14;
+
+    explicit TwoWeekScheduleWidget(QWidget *parent = nullptr);
+    ~TwoWeekScheduleWidget() = default;
+
+    /**
+     * @brief First day shown; reloads if it changed
+     */
+    void setStartDate(const QDate &date);
+    QDate startDate() const { return m_start; }
+
+    QSize sizeHint() const override;
+    QSize minimumSizeHint() const override;
+
+public slots:
+    void reload();
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    bool event(QEvent *event) override;
+
+private:
+    struct Day {
+        int orders = 0;
+        double cords = 0;
+        int shifts = 0;
+        int volunteers = 0;
+        int slots = 0;
+    };
+
+    QRect cellRect(int index) const;
+    int dayAt(const QPoint &pos) const;
+    QString toolTipFor(int index) const;
+
+    QDate m_start;
+    std::array<Day, DayCount> m_days;
+};
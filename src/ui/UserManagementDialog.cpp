@@ -1,4 +1,6 @@
 #include "UserManagementDialog.h"
+#include "StyleSheet.h"
+#include "ResultTableModel.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QHeaderView>
@@ -44,11 +46,55 @@ void UserManagementDialog::setupUI()
     mainLayout->addLayout(searchLayout);
     
     // Users table
-    m_usersTable = new QTableWidget(this);
-    m_usersTable->setColumnCount(7);
-    m_usersTable->setHorizontalHeaderLabels({
+    m_usersModel = new ResultTableModel(this);
+    m_usersModel->setHeaders({
         "ID", "Username", "Full Name", "Role", "Email", "Status", "Last Login"
     });
+    
+    // Role
+    m_usersModel->setFormatter(3, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        const QString userRole = model.text(row, 3);
+        if (role == Qt::ForegroundRole) {
+            if (userRole == "admin") {
+                return QBrush(QColor(220, 53, 69)); // Red
+            }
+            if (userRole == "employee") {
+                return QBrush(QColor(0, 123, 255)); // Blue
+            }
+        } else if (role == Qt::FontRole && userRole == "admin") {
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+        return QVariant();
+    });
+    
+    // Status
+    m_usersModel->setFormatter(5, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        const bool active = model.integer(row, 5) == 1;
+        if (role == Qt::DisplayRole) {
+            return active ? "✓ Active" : "✗ Inactive";
+        }
+        if (role == Qt::ForegroundRole && !active) {
+            return QBrush(QColor(128, 128, 128)); // Gray
+        }
+        return QVariant();
+    });
+    
+    // Last Login
+    m_usersModel->setFormatter(6, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        if (role != Qt::DisplayRole) {
+            return QVariant();
+        }
+        const QString lastLogin = model.text(row, 6);
+        if (lastLogin.isEmpty()) {
+            return "Never";
+        }
+        return QDateTime::fromString(lastLogin, Qt::ISODate).toString("MM/dd/yyyy hh:mm AP");
+    });
+    
+    m_usersTable = new QTableView(this);
+    m_usersTable->setModel(m_usersModel);
     m_usersTable->horizontalHeader()->setStretchLastSection(true);
     m_usersTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_usersTable->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -57,7 +103,7 @@ void UserManagementDialog::setupUI()
     m_usersTable->verticalHeader()->setVisible(false);
     m_usersTable->hideColumn(0); // Hide ID column
     
-    connect(m_usersTable, &QTableWidget::doubleClicked, this, &UserManagementDialog::viewUserProfile);
+    connect(m_usersTable, &QTableView::doubleClicked, this, &UserManagementDialog::viewUserProfile);
     
     mainLayout->addWidget(m_usersTable);
     
@@ -77,7 +123,7 @@ void UserManagementDialog::setupUI()
     buttonLayout->addWidget(m_addButton);
     
     m_removeButton = new QPushButton("🗑️ Remove User", this);
-    m_removeButton->setStyleSheet("QPushButton { background-color: #dc3545; color: white; }");
+    AdobeStyles::setVariant(m_removeButton, "danger");
     connect(m_removeButton, &QPushButton::clicked, this, &UserManagementDialog::removeUser);
     buttonLayout->addWidget(m_removeButton);
     
@@ -96,77 +142,29 @@ void UserManagementDialog::setupUI()
 
 void UserManagementDialog::loadUsers()
 {
-    m_usersTable->setRowCount(0);
-    
-    QSqlQuery query("SELECT id, username, full_name, role, email, active, last_login "
-                   "FROM users ORDER BY role, username");
-    
-    if (!query.exec()) {
+    QSqlQuery query;
+    query.setForwardOnly(true);
+    if (!query.exec("SELECT id, username, full_name, role, email, active, last_login "
+                    "FROM users ORDER BY role, username")) {
+        m_usersModel->clear();
         QMessageBox::critical(this, "Error", "Failed to load users: " + query.lastError().text());
         return;
     }
     
-    int row = 0;
-    while (query.next()) {
-        m_usersTable->insertRow(row);
-        
-        // ID (hidden)
-        m_usersTable->setItem(row, 0, new QTableWidgetItem(query.value(0).toString()));
-        
-        // Username
-        m_usersTable->setItem(row, 1, new QTableWidgetItem(query.value(1).toString()));
-        
-        // Full Name
-        m_usersTable->setItem(row, 2, new QTableWidgetItem(query.value(2).toString()));
-        
-        // Role
-        QString role = query.value(3).toString();
-        auto *roleItem = new QTableWidgetItem(role);
-        if (role == "admin") {
-            roleItem->setForeground(QBrush(QColor(220, 53, 69))); // Red
-            QFont font = roleItem->font();
-            font.setBold(true);
-            roleItem->setFont(font);
-        } else if (role == "employee") {
-            roleItem->setForeground(QBrush(QColor(0, 123, 255))); // Blue
-        }
-        m_usersTable->setItem(row, 3, roleItem);
-        
-        // Email
-        m_usersTable->setItem(row, 4, new QTableWidgetItem(query.value(4).toString()));
-        
-        // Status
-        bool active = query.value(5).toInt() == 1;
-        auto *statusItem = new QTableWidgetItem(active ? "✓ Active" : "✗ Inactive");
-        if (!active) {
-            statusItem->setForeground(QBrush(QColor(128, 128, 128))); // Gray
-        }
-        m_usersTable->setItem(row, 5, statusItem);
-        
-        // Last Login
-        QString lastLogin = query.value(6).toString();
-        if (!lastLogin.isEmpty()) {
-            QDateTime dt = QDateTime::fromString(lastLogin, Qt::ISODate);
-            m_usersTable->setItem(row, 6, new QTableWidgetItem(dt.toString("MM/dd/yyyy hh:mm AP")));
-        } else {
-            m_usersTable->setItem(row, 6, new QTableWidgetItem("Never"));
-        }
-        
-        row++;
-    }
-    
+    m_usersModel->load(query);
     m_usersTable->resizeColumnsToContents();
+    searchUsers();
 }
 
 void UserManagementDialog::viewUserProfile()
 {
-    if (m_usersTable->currentRow() < 0) {
+    if (m_usersTable->currentIndex().row() < 0) {
         QMessageBox::information(this, "No Selection", "Please select a user to view.");
         return;
     }
     
-    int row = m_usersTable->currentRow();
-    int userId = m_usersTable->item(row, 0)->text().toInt();
+    int row = m_usersTable->currentIndex().row();
+    int userId = static_cast<int>(m_usersModel->integer(row, 0));
     
     QSqlQuery query;
     query.prepare("SELECT username, full_name, role, email, active, created_at, last_login "
@@ -242,14 +240,14 @@ void UserManagementDialog::viewUserProfile()
 
 void UserManagementDialog::editUser()
 {
-    if (m_usersTable->currentRow() < 0) {
+    if (m_usersTable->currentIndex().row() < 0) {
         QMessageBox::information(this, "No Selection", "Please select a user to edit.");
         return;
     }
     
-    int row = m_usersTable->currentRow();
-    int userId = m_usersTable->item(row, 0)->text().toInt();
-    QString currentUsername = m_usersTable->item(row, 1)->text();
+    int row = m_usersTable->currentIndex().row();
+    int userId = static_cast<int>(m_usersModel->integer(row, 0));
+    QString currentUsername = m_usersModel->text(row, 1);
     
     QSqlQuery query;
     query.prepare("SELECT username, full_name, role, email, active FROM users WHERE id = :id");
@@ -445,14 +443,14 @@ void UserManagementDialog::addUser()
 
 void UserManagementDialog::removeUser()
 {
-    if (m_usersTable->currentRow() < 0) {
+    if (m_usersTable->currentIndex().row() < 0) {
         QMessageBox::information(this, "No Selection", "Please select a user to remove.");
         return;
     }
     
-    int row = m_usersTable->currentRow();
-    int userId = m_usersTable->item(row, 0)->text().toInt();
-    QString username = m_usersTable->item(row, 1)->text();
+    int row = m_usersTable->currentIndex().row();
+    int userId = static_cast<int>(m_usersModel->integer(row, 0));
+    QString username = m_usersModel->text(row, 1);
     
     auto response = QMessageBox::question(this, "Confirm Removal",
                                          QString("Are you sure you want to remove user '%1'?\n\n"
@@ -482,12 +480,12 @@ void UserManagementDialog::searchUsers()
 {
     QString searchText = m_searchEdit->text().toLower();
     
-    for (int row = 0; row < m_usersTable->rowCount(); ++row) {
+    for (int row = 0; row < m_usersModel->resultRowCount(); ++row) {
         bool match = false;
         
         // Search in username, full name, and email columns
         for (int col = 1; col <= 4; ++col) {
-            QString cellText = m_usersTable->item(row, col)->text().toLower();
+            QString cellText = m_usersModel->text(row, col).toLower();
             if (cellText.contains(searchText)) {
                 match = true;
                 break;
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <QDialog>
-#include <QTableWidget>
+#include <QTableView>
 #include <QPushButton>
 #include <QLineEdit>
 #include <QComboBox>
@@ -24,7 +24,8 @@ private slots:
 private:
     void setupUI();
     
-    QTableWidget *m_usersTable = nullptr;
+    QTableView *m_usersTable = nullptr;
+    class ResultTableModel *m_usersModel = nullptr;
     QLineEdit *m_searchEdit = nullptr;
     QPushButton *m_viewButton = nullptr;
     QPushButton *m_editButton = nullptr;
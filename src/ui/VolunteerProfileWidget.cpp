@@ -1,4 +1,7 @@
 #include "VolunteerProfileWidget.h"
+#include "StyleSheet.h"
+#include "ResultTableModel.h"
+#include "shift_signup.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QGridLayout>
@@ -13,6 +16,36 @@
 #include <QSqlError>
 #include <QDebug>
 #include <QDate>
+#include <QBrush>
+#include <QFont>
+
+namespace {
+
+// Hidden columns of the work days query
+constexpr int WorkDayIdColumn = 6;
+constexpr int WorkDayEndTimeColumn = 7;
+constexpr int WorkDaySlotsColumn = 8;
+constexpr int WorkDayWaitlistColumn = 9;
+
+// My Status column: NULL when not signed up, 0 when confirmed, else the waitlist position
+constexpr int WorkDaySignupColumn = 5;
+
+// Hidden flag column of the volunteer hours query
+constexpr int HoursTotalColumn = 3;
+
+// Shows an ISO date column as MM/dd/yyyy; empty dates stay empty
+ResultTableModel::Formatter isoDateFormatter(int column)
+{
+    return [column](const ResultTableModel &model, int row, int role) -> QVariant {
+        if (role != Qt::DisplayRole) {
+            return QVariant();
+        }
+        const QString text = model.text(row, column);
+        return text.isEmpty() ? QString() : QDate::fromString(text, Qt::ISODate).toString("MM/dd/yyyy");
+    };
+}
+
+} // namespace
 
 VolunteerProfileWidget::VolunteerProfileWidget(const QString &username, QWidget *parent)
     : QWidget(parent), m_username(username)
@@ -52,10 +85,7 @@ void VolunteerProfileWidget::setupUI()
     
     // Top Section: Personal Information
     auto *profileBox = new QGroupBox("Personal Information", this);
-    profileBox->setStyleSheet(
-        "QGroupBox { font-weight: bold; border: 2px solid #0078d4; "
-        "border-radius: 5px; margin-top: 10px; padding-top: 10px; }"
-    );
+    AdobeStyles::setVariant(profileBox, "fire");
     auto *profileLayout = new QGridLayout(profileBox);
     
     profileLayout->addWidget(new QLabel("<b>Name:</b>"), 0, 0);
@@ -84,10 +114,7 @@ void VolunteerProfileWidget::setupUI()
     
     // Status Section
     auto *statusBox = new QGroupBox("Status & Requirements", this);
-    statusBox->setStyleSheet(
-        "QGroupBox { font-weight: bold; border: 2px solid #0078d4; "
-        "border-radius: 5px; margin-top: 10px; padding-top: 10px; }"
-    );
+    AdobeStyles::setVariant(statusBox, "fire");
     auto *statusLayout = new QHBoxLayout(statusBox);
     
     m_waiverCheck = new QCheckBox("Waiver Signed", this);
@@ -107,10 +134,7 @@ void VolunteerProfileWidget::setupUI()
     
     // Availability Section
     auto *availBox = new QGroupBox("My Availability", this);
-    availBox->setStyleSheet(
-        "QGroupBox { font-weight: bold; border: 2px solid #0078d4; "
-        "border-radius: 5px; margin-top: 10px; padding-top: 10px; }"
-    );
+    AdobeStyles::setVariant(availBox, "fire");
     auto *availLayout = new QVBoxLayout(availBox);
     
     m_availabilityText = new QTextEdit(this);
@@ -126,35 +150,60 @@ void VolunteerProfileWidget::setupUI()
     
     // Left: Volunteer Hours Log
     auto *hoursBox = new QGroupBox("⏱️ My Volunteer Hours", this);
-    hoursBox->setStyleSheet(
-        "QGroupBox { font-weight: bold; border: 2px solid #28a745; "
-        "border-radius: 5px; margin-top: 10px; padding-top: 10px; }"
-    );
+    AdobeStyles::setVariant(hoursBox, "success");
     auto *hoursLayout = new QVBoxLayout(hoursBox);
     
-    m_hoursTable = new QTableWidget(this);
-    m_hoursTable->setColumnCount(3);
-    m_hoursTable->setHorizontalHeaderLabels({"Date", "Hours", "Activity"});
+    m_hoursModel = new ResultTableModel(this);
+    m_hoursModel->setHeaders({"Date", "Hours", "Activity"});
+    m_hoursModel->setFormatter(0, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        const bool total = model.integer(row, HoursTotalColumn) == 1;
+        if (role == Qt::DisplayRole) {
+            return total ? QString("TOTAL")
+                         : QDate::fromString(model.text(row, 0), Qt::ISODate).toString("MM/dd/yyyy");
+        }
+        if (role == Qt::FontRole && total) {
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+        return QVariant();
+    });
+    m_hoursModel->setFormatter(1, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        if (role == Qt::DisplayRole) {
+            return QString::number(model.real(row, 1), 'f', 1);
+        }
+        if (role == Qt::FontRole && model.integer(row, HoursTotalColumn) == 1) {
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+        return QVariant();
+    });
+    
+    m_hoursTable = new QTableView(this);
+    m_hoursTable->setModel(m_hoursModel);
     m_hoursTable->horizontalHeader()->setStretchLastSection(true);
     m_hoursTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_hoursTable->setSelectionBehavior(QAbstractItemView::SelectRows);
     m_hoursTable->setAlternatingRowColors(true);
     m_hoursTable->verticalHeader()->setVisible(false);
+    m_hoursTable->hideColumn(HoursTotalColumn);
     hoursLayout->addWidget(m_hoursTable);
     
     middleLayout->addWidget(hoursBox);
     
     // Right: Certifications
     auto *certBox = new QGroupBox("🏆 My Certifications", this);
-    certBox->setStyleSheet(
-        "QGroupBox { font-weight: bold; border: 2px solid #ffc107; "
-        "border-radius: 5px; margin-top: 10px; padding-top: 10px; }"
-    );
+    AdobeStyles::setVariant(certBox, "urgent");
     auto *certLayout = new QVBoxLayout(certBox);
     
-    m_certificationsTable = new QTableWidget(this);
-    m_certificationsTable->setColumnCount(3);
-    m_certificationsTable->setHorizontalHeaderLabels({"Certification", "Issued", "Expires"});
+    m_certificationsModel = new ResultTableModel(this);
+    m_certificationsModel->setHeaders({"Certification", "Issued", "Expires"});
+    m_certificationsModel->setFormatter(1, isoDateFormatter(1));
+    m_certificationsModel->setFormatter(2, isoDateFormatter(2));
+    
+    m_certificationsTable = new QTableView(this);
+    m_certificationsTable->setModel(m_certificationsModel);
     m_certificationsTable->horizontalHeader()->setStretchLastSection(true);
     m_certificationsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_certificationsTable->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -175,20 +224,71 @@ void VolunteerProfileWidget::setupUI()
     
     // Bottom Section: Available Work Days
     auto *workDaysBox = new QGroupBox("📅 Available Work Days", this);
-    workDaysBox->setStyleSheet(
-        "QGroupBox { font-weight: bold; border: 2px solid #dc3545; "
-        "border-radius: 5px; margin-top: 10px; padding-top: 10px; }"
-    );
+    AdobeStyles::setVariant(workDaysBox, "danger");
     auto *workDaysLayout = new QVBoxLayout(workDaysBox);
     
-    m_workDaysTable = new QTableWidget(this);
-    m_workDaysTable->setColumnCount(6);
-    m_workDaysTable->setHorizontalHeaderLabels({"Date", "Time", "Activity", "Location", "Slots", "My Status"});
+    m_workDaysModel = new ResultTableModel(this);
+    m_workDaysModel->setHeaders({"Date", "Time", "Activity", "Location", "Slots", "My Status"});
+    m_workDaysModel->setFormatter(0, isoDateFormatter(0));
+    m_workDaysModel->setFormatter(1, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        if (role == Qt::DisplayRole) {
+            return QString("%1 - %2").arg(model.text(row, 1), model.text(row, WorkDayEndTimeColumn));
+        }
+        return QVariant();
+    });
+    m_workDaysModel->setFormatter(4, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        const qint64 totalSlots = model.integer(row, WorkDaySlotsColumn);
+        const qint64 filledSlots = model.integer(row, 4);
+        const qint64 availableSlots = totalSlots - filledSlots;
+        if (role == Qt::DisplayRole) {
+            const qint64 waiting = model.integer(row, WorkDayWaitlistColumn);
+            return waiting > 0 ? QString("%1 / %2 (+%3 waiting)").arg(filledSlots).arg(totalSlots).arg(waiting)
+                               : QString("%1 / %2").arg(filledSlots).arg(totalSlots);
+        }
+        if (role == Qt::BackgroundRole) {
+            if (availableSlots <= 0) {
+                return QBrush(QColor(255, 200, 200)); // Light red
+            }
+            if (availableSlots <= 2) {
+                return QBrush(QColor(255, 255, 200)); // Light yellow
+            }
+            return QBrush(QColor(200, 255, 200)); // Light green
+        }
+        return QVariant();
+    });
+    m_workDaysModel->setFormatter(WorkDaySignupColumn, [](const ResultTableModel &model, int row, int role) -> QVariant {
+        const bool hasSignup = !model.isNull(row, WorkDaySignupColumn);
+        const qint64 waitlistPosition = model.integer(row, WorkDaySignupColumn);
+        const bool signedUp = hasSignup && waitlistPosition == 0;
+        if (role == Qt::DisplayRole) {
+            if (hasSignup) {
+                return signedUp ? QString("✓ Signed Up") : QString("⏳ Waitlist #%1").arg(waitlistPosition);
+            }
+            const qint64 availableSlots = model.integer(row, WorkDaySlotsColumn) - model.integer(row, 4);
+            return QString(availableSlots > 0 ? "Available" : "Full (waitlist open)");
+        }
+        if (signedUp && role == Qt::FontRole) {
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+        if (signedUp && role == Qt::ForegroundRole) {
+            return QBrush(QColor(0, 128, 0));
+        }
+        return QVariant();
+    });
+    
+    m_workDaysTable = new QTableView(this);
+    m_workDaysTable->setModel(m_workDaysModel);
     m_workDaysTable->horizontalHeader()->setStretchLastSection(true);
     m_workDaysTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_workDaysTable->setSelectionBehavior(QAbstractItemView::SelectRows);
     m_workDaysTable->setAlternatingRowColors(true);
     m_workDaysTable->verticalHeader()->setVisible(false);
+    m_workDaysTable->hideColumn(WorkDayIdColumn);
+    m_workDaysTable->hideColumn(WorkDayEndTimeColumn);
+    m_workDaysTable->hideColumn(WorkDaySlotsColumn);
+    m_workDaysTable->hideColumn(WorkDayWaitlistColumn);
     workDaysLayout->addWidget(m_workDaysTable);
     
     auto *workDayButtonLayout = new QHBoxLayout();
@@ -245,49 +345,24 @@ void VolunteerProfileWidget::loadVolunteerHours()
 {
     if (m_householdId < 0) return;
     
+    // The last 20 entries, then a total row over the same entries
     QSqlQuery query;
-    query.prepare("SELECT date, hours, activity FROM volunteer_hours "
-                 "WHERE household_id = :id ORDER BY date DESC LIMIT 20");
+    query.setForwardOnly(true);
+    query.prepare("WITH recent AS ("
+                 "SELECT date, hours, activity FROM volunteer_hours "
+                 "WHERE household_id = :id ORDER BY date DESC LIMIT 20) "
+                 "SELECT date, hours, activity, 0 AS is_total FROM recent "
+                 "UNION ALL "
+                 "SELECT NULL, SUM(hours), NULL, 1 FROM recent HAVING COUNT(*) > 0");
     query.bindValue(":id", m_householdId);
     
-    m_hoursTable->setRowCount(0);
-    
     if (!query.exec()) {
         qDebug() << "ERROR: Failed to load volunteer hours:" << query.lastError().text();
+        m_hoursModel->clear();
         return;
     }
     
-    double totalHours = 0.0;
-    int row = 0;
-    
-    while (query.next()) {
-        m_hoursTable->insertRow(row);
-        
-        QString dateStr = query.value(0).toString();
-        QDate date = QDate::fromString(dateStr, Qt::ISODate);
-        m_hoursTable->setItem(row, 0, new QTableWidgetItem(date.toString("MM/dd/yyyy")));
-        
-        double hours = query.value(1).toDouble();
-        totalHours += hours;
-        m_hoursTable->setItem(row, 1, new QTableWidgetItem(QString::number(hours, 'f', 1)));
-        
-        m_hoursTable->setItem(row, 2, new QTableWidgetItem(query.value(2).toString()));
-        row++;
-    }
-    
-    // Add total row
-    if (row > 0) {
-        m_hoursTable->insertRow(row);
-        auto *totalItem = new QTableWidgetItem("TOTAL");
-        QFont font = totalItem->font();
-        font.setBold(true);
-        totalItem->setFont(font);
-        m_hoursTable->setItem(row, 0, totalItem);
-        
-        auto *hoursItem = new QTableWidgetItem(QString::number(totalHours, 'f', 1));
-        hoursItem->setFont(font);
-        m_hoursTable->setItem(row, 1, hoursItem);
-    }
+    m_hoursModel->load(query);
 }
 
 void VolunteerProfileWidget::loadCertifications()
@@ -295,49 +370,34 @@ void VolunteerProfileWidget::loadCertifications()
     if (m_householdId < 0) return;
     
     QSqlQuery query;
+    query.setForwardOnly(true);
     query.prepare("SELECT certification_name, issue_date, expiration_date "
                  "FROM volunteer_certifications WHERE household_id = :id "
                  "ORDER BY expiration_date DESC");
     query.bindValue(":id", m_householdId);
     
-    m_certificationsTable->setRowCount(0);
-    
     if (!query.exec()) {
         qDebug() << "ERROR: Failed to load certifications:" << query.lastError().text();
+        m_certificationsModel->clear();
         return;
     }
     
-    int row = 0;
-    while (query.next()) {
-        m_certificationsTable->insertRow(row);
-        
-        m_certificationsTable->setItem(row, 0, new QTableWidgetItem(query.value(0).toString()));
-        
-        QString issueStr = query.value(1).toString();
-        if (!issueStr.isEmpty()) {
-            QDate issueDate = QDate::fromString(issueStr, Qt::ISODate);
-            m_certificationsTable->setItem(row, 1, new QTableWidgetItem(issueDate.toString("MM/dd/yyyy")));
-        }
-        
-        QString expireStr = query.value(2).toString();
-        if (!expireStr.isEmpty()) {
-            QDate expireDate = QDate::fromString(expireStr, Qt::ISODate);
-            m_certificationsTable->setItem(row, 2, new QTableWidgetItem(expireDate.toString("MM/dd/yyyy")));
-        }
-        
-        row++;
-    }
+    m_certificationsModel->load(query);
 }
 
 void VolunteerProfileWidget::loadAvailableWorkDays()
 {
-    m_workDaysTable->setRowCount(0);
-    
-    // Load upcoming work days
+    // Load upcoming work days; the shown columns come first, then the ones the
+    // formatters and sign-up read (id, end_time, volunteer_slots, waitlisted)
     QSqlQuery query;
-    query.prepare("SELECT ws.id, ws.work_date, ws.start_time, ws.end_time, ws.activity_type, "
-                 "ws.location, ws.volunteer_slots, ws.slots_filled, "
-                 "(SELECT COUNT(*) FROM work_schedule_signups WHERE schedule_id = ws.id AND household_id = :household_id) as signed_up "
+    query.setForwardOnly(true);
+    query.prepare("SELECT ws.work_date, ws.start_time, ws.activity_type, ws.location, ws.slots_filled, "
+                 "(SELECT CASE WHEN s.status = 'Waitlisted' THEN "
+                 "(SELECT COUNT(*) FROM work_schedule_signups w "
+                 "WHERE w.schedule_id = s.schedule_id AND w.status = 'Waitlisted' AND w.id <= s.id) ELSE 0 END "
+                 "FROM work_schedule_signups s WHERE s.schedule_id = ws.id AND s.household_id = :household_id) as signup_state, "
+                 "ws.id, ws.end_time, ws.volunteer_slots, "
+                 "(SELECT COUNT(*) FROM work_schedule_signups w WHERE w.schedule_id = ws.id AND w.status = 'Waitlisted') as waitlisted "
                  "FROM work_schedule ws "
                  "WHERE ws.work_date >= date('now') "
                  "ORDER BY ws.work_date, ws.start_time");
@@ -345,150 +405,112 @@ void VolunteerProfileWidget::loadAvailableWorkDays()
     
     if (!query.exec()) {
         qDebug() << "ERROR: Failed to load work days:" << query.lastError().text();
+        m_workDaysModel->clear();
         return;
     }
     
-    int row = 0;
-    while (query.next()) {
-        m_workDaysTable->insertRow(row);
-        
-        int scheduleId = query.value(0).toInt();
-        m_workDaysTable->setItem(row, 0, new QTableWidgetItem(QString::number(scheduleId)));
-        m_workDaysTable->item(row, 0)->setData(Qt::UserRole, scheduleId); // Store ID in user data
-        
-        QString dateStr = query.value(1).toString();
-        QDate date = QDate::fromString(dateStr, Qt::ISODate);
-        m_workDaysTable->item(row, 0)->setText(date.toString("MM/dd/yyyy"));
-        
-        QString timeRange = QString("%1 - %2").arg(query.value(2).toString(), query.value(3).toString());
-        m_workDaysTable->setItem(row, 1, new QTableWidgetItem(timeRange));
-        
-        m_workDaysTable->setItem(row, 2, new QTableWidgetItem(query.value(4).toString()));
-        m_workDaysTable->setItem(row, 3, new QTableWidgetItem(query.value(5).toString()));
-        
-        int totalSlots = query.value(6).toInt();
-        int filledSlots = query.value(7).toInt();
-        int availableSlots = totalSlots - filledSlots;
-        QString slotInfo = QString("%1 / %2").arg(filledSlots).arg(totalSlots);
-        auto *slotsItem = new QTableWidgetItem(slotInfo);
-        if (availableSlots <= 0) {
-            slotsItem->setBackground(QBrush(QColor(255, 200, 200))); // Light red
-        } else if (availableSlots <= 2) {
-            slotsItem->setBackground(QBrush(QColor(255, 255, 200))); // Light yellow
-        } else {
-            slotsItem->setBackground(QBrush(QColor(200, 255, 200))); // Light green
-        }
-        m_workDaysTable->setItem(row, 4, slotsItem);
-        
-        bool signedUp = query.value(8).toInt() > 0;
-        auto *statusItem = new QTableWidgetItem(signedUp ? "✓ Signed Up" : availableSlots > 0 ? "Available" : "Full");
-        QFont font = statusItem->font();
-        if (signedUp) {
-            font.setBold(true);
-            statusItem->setFont(font);
-            statusItem->setForeground(QBrush(QColor(0, 128, 0)));
-        }
-        m_workDaysTable->setItem(row, 5, statusItem);
-        
-        row++;
-    }
+    m_workDaysModel->load(query);
 }
 
 void VolunteerProfileWidget::signUpForWorkDay()
 {
-    if (m_workDaysTable->currentRow() < 0) {
+    using firewood::db::SignupResult;
+
+    if (m_workDaysTable->currentIndex().row() < 0) {
         QMessageBox::information(this, "No Selection", "Please select a work day to sign up for.");
         return;
     }
     
-    int row = m_workDaysTable->currentRow();
-    int scheduleId = m_workDaysTable->item(row, 0)->data(Qt::UserRole).toInt();
-    QString status = m_workDaysTable->item(row, 5)->text();
+    int row = m_workDaysTable->currentIndex().row();
+    const qint64 scheduleId = m_workDaysModel->integer(row, WorkDayIdColumn);
     
-    if (status == "✓ Signed Up") {
+    if (!m_workDaysModel->isNull(row, WorkDaySignupColumn)) {
         QMessageBox::information(this, "Already Signed Up", 
-                               "You are already signed up for this work day.");
-        return;
-    }
-    
-    if (status == "Full") {
-        QMessageBox::warning(this, "Work Day Full", 
-                           "This work day is already full. Please choose another day.");
+                               "You are already signed up or on the waitlist for this work day.");
         return;
     }
     
-    QString workDay = m_workDaysTable->item(row, 0)->text();
-    QString time = m_workDaysTable->item(row, 1)->text();
-    QString activity = m_workDaysTable->item(row, 2)->text();
+    // The shown count may be stale; the sign-up itself decides between a slot and the waitlist
+    const bool looksFull = m_workDaysModel->integer(row, 4) >= m_workDaysModel->integer(row, WorkDaySlotsColumn);
+    QString workDay = m_workDaysModel->index(row, 0).data().toString();
+    QString time = m_workDaysModel->index(row, 1).data().toString();
+    QString activity = m_workDaysModel->index(row, 2).data().toString();
     
-    auto response = QMessageBox::question(this, "Confirm Sign-Up",
-                                         QString("Sign up for:\n\n%1\n%2\n%3\n\nAre you sure?")
+    auto response = QMessageBox::question(this, looksFull ? "Join Waitlist" : "Confirm Sign-Up",
+                                         QString(looksFull ? "This work day is full. Join the waitlist for:\n\n%1\n%2\n%3\n\n"
+                                                             "You will get the first slot that opens."
+                                                           : "Sign up for:\n\n%1\n%2\n%3\n\nAre you sure?")
                                          .arg(workDay, time, activity),
                                          QMessageBox::Yes | QMessageBox::No);
     
     if (response != QMessageBox::Yes) return;
     
-    QSqlQuery query;
-    query.prepare("INSERT INTO work_schedule_signups (schedule_id, household_id, status) "
-                 "VALUES (:schedule_id, :household_id, 'Confirmed')");
-    query.bindValue(":schedule_id", scheduleId);
-    query.bindValue(":household_id", m_householdId);
-    
-    if (!query.exec()) {
+    QSqlDatabase db = QSqlDatabase::database();
+    const firewood::db::SignupOutcome outcome = firewood::db::signUpForShift(db, scheduleId, m_householdId);
+    
+    switch (outcome.result) {
+    case SignupResult::Confirmed:
+        QMessageBox::information(this, "Success", "You have been signed up for this work day!");
+        break;
+    case SignupResult::Waitlisted:
+        QMessageBox::information(this, "Waitlisted",
+                                 QString("This work day is full. You are #%1 on the waitlist.")
+                                 .arg(outcome.waitlistPosition));
+        break;
+    case SignupResult::AlreadySignedUp:
+        QMessageBox::information(this, "Already Signed Up", 
+                               "You are already signed up or on the waitlist for this work day.");
+        break;
+    case SignupResult::ShiftNotFound:
+        QMessageBox::warning(this, "Work Day Removed", "This work day is no longer on the schedule.");
+        break;
+    default:
         QMessageBox::critical(this, "Error", 
-                            "Failed to sign up: " + query.lastError().text());
+                            "Failed to sign up: " + outcome.error);
         return;
     }
-    
-    // Update slots_filled count
-    query.prepare("UPDATE work_schedule SET slots_filled = slots_filled + 1 WHERE id = :id");
-    query.bindValue(":id", scheduleId);
-    query.exec();
-    
-    QMessageBox::information(this, "Success", "You have been signed up for this work day!");
     refreshData();
 }
 
 void VolunteerProfileWidget::cancelSignUp()
 {
-    if (m_workDaysTable->currentRow() < 0) {
+    using firewood::db::SignupResult;
+
+    if (m_workDaysTable->currentIndex().row() < 0) {
         QMessageBox::information(this, "No Selection", "Please select a work day to cancel.");
         return;
     }
     
-    int row = m_workDaysTable->currentRow();
-    int scheduleId = m_workDaysTable->item(row, 0)->data(Qt::UserRole).toInt();
-    QString status = m_workDaysTable->item(row, 5)->text();
+    int row = m_workDaysTable->currentIndex().row();
+    const qint64 scheduleId = m_workDaysModel->integer(row, WorkDayIdColumn);
     
-    if (status != "✓ Signed Up") {
+    if (m_workDaysModel->isNull(row, WorkDaySignupColumn)) {
         QMessageBox::information(this, "Not Signed Up", 
                                "You are not signed up for this work day.");
         return;
     }
+    const bool waitlisted = m_workDaysModel->integer(row, WorkDaySignupColumn) > 0;
     
     auto response = QMessageBox::question(this, "Confirm Cancellation",
-                                         "Are you sure you want to cancel your sign-up?",
+                                         waitlisted ? "Are you sure you want to leave the waitlist?"
+                                                    : "Are you sure you want to cancel your sign-up?",
                                          QMessageBox::Yes | QMessageBox::No);
     
     if (response != QMessageBox::Yes) return;
     
-    QSqlQuery query;
-    query.prepare("DELETE FROM work_schedule_signups WHERE schedule_id = :schedule_id AND household_id = :household_id");
-    query.bindValue(":schedule_id", scheduleId);
-    query.bindValue(":household_id", m_householdId);
+    QSqlDatabase db = QSqlDatabase::database();
+    const firewood::db::SignupOutcome outcome = firewood::db::cancelShiftSignup(db, scheduleId, m_householdId);
     
-    if (!query.exec()) {
+    if (outcome.result == SignupResult::Failed) {
         QMessageBox::critical(this, "Error", 
-                            "Failed to cancel sign-up: " + query.lastError().text());
+                            "Failed to cancel sign-up: " + outcome.error);
         return;
     }
     
-    // Update slots_filled count
-    query.prepare("UPDATE work_schedule SET slots_filled = slots_filled - 1 WHERE id = :id");
-    query.bindValue(":id", scheduleId);
-    query.exec();
-    
-    QMessageBox::information(this, "Cancelled", "Your sign-up has been cancelled.");
+    if (outcome.result == SignupResult::Cancelled) {
+        QMessageBox::information(this, "Cancelled", waitlisted ? "You have left the waitlist."
+                                                               : "Your sign-up has been cancelled.");
+    }
     refreshData();
 }
 
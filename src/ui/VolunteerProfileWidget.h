@@ -3,7 +3,7 @@
 #include <QWidget>
 #include <QLabel>
 #include <QGroupBox>
-#include <QTableWidget>
+#include <QTableView>
 #include <QCheckBox>
 #include <QPushButton>
 #include <QTextEdit>
@@ -46,9 +46,12 @@ private:
     QCheckBox *m_vehicleCheck = nullptr;
     
     // Tables
-    QTableWidget *m_hoursTable = nullptr;
-    QTableWidget *m_certificationsTable = nullptr;
-    QTableWidget *m_workDaysTable = nullptr;
+    QTableView *m_hoursTable = nullptr;
+    QTableView *m_certificationsTable = nullptr;
+    QTableView *m_workDaysTable = nullptr;
+    class ResultTableModel *m_hoursModel = nullptr;
+    class ResultTableModel *m_certificationsModel = nullptr;
+    class ResultTableModel *m_workDaysModel = nullptr;
     
     // Action buttons
     QPushButton *m_signUpButton = nullptr;
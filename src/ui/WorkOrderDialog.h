@@ -23,11 +23,13 @@ private:
   void loadOrder();
   void loadClients();
   void saveOrder();
+  void loadCredit();
+  double creditAfterOrder() const;
 
   int m_orderId;
 
   // Order fields
-  QComboBox* m_clientCombo = nullptr;
+  QComboBox* m_clientCombo = nullptr;     // Data is households.id
   QPushButton* m_newClientButton = nullptr;
   QDateEdit* m_orderDateEdit = nullptr;
   QDoubleSpinBox* m_requestedCordsEdit = nullptr;
@@ -40,6 +42,12 @@ private:
   QLineEdit* m_assignedDriverEdit = nullptr;
   QComboBox* m_paymentMethodCombo = nullptr;
   QDoubleSpinBox* m_amountPaidEdit = nullptr;
+
+  // Work-for-Wood credit of the selected client, read once per client change
+  QLabel* m_creditLabel = nullptr;
+  QPushButton* m_applyCreditButton = nullptr;
+  double m_creditBalance = 0;
+  double m_orderCredit = 0;    // Already posted by this order, included in m_creditBalance
   QTextEdit* m_notesEdit = nullptr;
 
   // Delivery tracking fields (NEW!)
@@ -50,4 +58,6 @@ private:
 private slots:
   void onStatusChanged(const QString& status);
   void onNewClientClicked();
+  void onApplyCreditClicked();
+  void updateCreditPreview();
 };
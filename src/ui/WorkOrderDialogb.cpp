@@ -1,6 +1,8 @@
 #include "WorkOrderDialog.h"
 #include "ClientDialog.h"
 #include "StyleSheet.h"
+#include "Codes.h"
+#include "credit_ledger.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QFormLayout>
@@ -41,21 +43,14 @@ void WorkOrderDialog::setupUI()
     "</div>"
   );
   orgHeader->setAlignment(Qt::AlignCenter);
-  orgHeader->setStyleSheet(
-    "background: " + AdobeStyles::GRADIENT_PRIMARY + "; "
-    "color: white; "
-    "border-radius: 10px; "
-    "padding: 16px; "
-    "margin-bottom: 10px;"
-  );
+  AdobeStyles::setVariant(orgHeader, "banner");
   mainLayout->addWidget(orgHeader);
 
   auto* orderHeaderLayout = new QHBoxLayout();
   QString orderNumText = m_orderId >= 0 ? QString("Order #%1").arg(m_orderId) : "New Order";
   auto* orderNumLabel = new QLabel("<b>" + orderNumText + "</b>", this);
-  orderNumLabel->setStyleSheet("font-size: 11pt; color: " + AdobeStyles::SUCCESS_GREEN + ";");
+  AdobeStyles::setTone(orderNumLabel, "success");
   auto* dateLabel = new QLabel("<b>Date:</b> " + QDate::currentDate().toString("MMMM dd, yyyy"), this);
-  dateLabel->setStyleSheet("font-size: 11pt; color: " + AdobeStyles::TEXT_SECONDARY + ";");
   orderHeaderLayout->addWidget(orderNumLabel);
   orderHeaderLayout->addStretch();
   orderHeaderLayout->addWidget(dateLabel);
@@ -63,16 +58,15 @@ void WorkOrderDialog::setupUI()
 
   auto* orderGroup = new QGroupBox(AdobeStyles::ICON_ORDERS + " Order Information", this);
   orderGroup->setProperty("class", "fire");
-  orderGroup->setStyleSheet(AdobeStyles::GROUP_BOX_FIRE);
+  AdobeStyles::setVariant(orderGroup, "fire");
   auto* orderLayout = new QFormLayout(orderGroup);
 
   auto* clientLayout = new QHBoxLayout();
   m_clientCombo = new QComboBox(this);
-  m_clientCombo->setStyleSheet(AdobeStyles::COMBO_BOX);
   clientLayout->addWidget(m_clientCombo, 1);
   m_newClientButton = new QPushButton(AdobeStyles::ICON_ADD + " New Client...", this);
   m_newClientButton->setProperty("class", "secondary");
-  m_newClientButton->setStyleSheet(AdobeStyles::SECONDARY_BUTTON);
+  AdobeStyles::setVariant(m_newClientButton, "secondary");
   connect(m_newClientButton, &QPushButton::clicked, this, &WorkOrderDialog::onNewClientClicked);
   clientLayout->addWidget(m_newClientButton);
 
@@ -81,62 +75,51 @@ void WorkOrderDialog::setupUI()
 
   m_orderDateEdit = new QDateEdit(QDate::currentDate(), this);
   m_orderDateEdit->setCalendarPopup(true);
-  m_orderDateEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   orderLayout->addRow("Order Date:", m_orderDateEdit);
 
   m_requestedCordsEdit = new QDoubleSpinBox(this);
   m_requestedCordsEdit->setRange(0.0, 999.0);
   m_requestedCordsEdit->setSingleStep(0.5);
   m_requestedCordsEdit->setSuffix(" cords");
-  m_requestedCordsEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   orderLayout->addRow("Requested Cords:", m_requestedCordsEdit);
 
   m_statusCombo = new QComboBox(this);
   m_statusCombo->addItems({ "Pending", "Scheduled", "In Progress", "Completed", "Cancelled" });
-  m_statusCombo->setStyleSheet(AdobeStyles::COMBO_BOX);
   connect(m_statusCombo, &QComboBox::currentTextChanged, this, &WorkOrderDialog::onStatusChanged);
   orderLayout->addRow("Status:", m_statusCombo);
 
   m_priorityCombo = new QComboBox(this);
   m_priorityCombo->addItems({ "Low", "Normal", "High", "Emergency" });
   m_priorityCombo->setCurrentText("Normal");
-  m_priorityCombo->setStyleSheet(AdobeStyles::COMBO_BOX);
   orderLayout->addRow("Priority:", m_priorityCombo);
 
   mainLayout->addWidget(orderGroup);
 
   auto* deliveryGroup = new QGroupBox(AdobeStyles::ICON_TRUCK + " Delivery Information", this);
-  deliveryGroup->setStyleSheet(AdobeStyles::GROUP_BOX);
   auto* deliveryLayout = new QFormLayout(deliveryGroup);
 
   m_deliveryDateEdit = new QDateEdit(QDate::currentDate(), this);
   m_deliveryDateEdit->setCalendarPopup(true);
-  m_deliveryDateEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   deliveryLayout->addRow("Delivery Date:", m_deliveryDateEdit);
 
   m_deliveredCordsEdit = new QDoubleSpinBox(this);
   m_deliveredCordsEdit->setRange(0.0, 999.0);
   m_deliveredCordsEdit->setSingleStep(0.5);
   m_deliveredCordsEdit->setSuffix(" cords");
-  m_deliveredCordsEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   deliveryLayout->addRow("Delivered Cords:", m_deliveredCordsEdit);
 
   m_deliveryAddressEdit = new QLineEdit(this);
-  m_deliveryAddressEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   deliveryLayout->addRow("Delivery Address:", m_deliveryAddressEdit);
 
   m_deliveryNotesEdit = new QTextEdit(this);
   m_deliveryNotesEdit->setMaximumHeight(60);
-  m_deliveryNotesEdit->setStyleSheet(AdobeStyles::TEXT_EDIT);
   deliveryLayout->addRow("Delivery Notes:", m_deliveryNotesEdit);
 
   m_assignedDriverEdit = new QLineEdit(this);
-  m_assignedDriverEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   deliveryLayout->addRow("Assigned Driver:", m_assignedDriverEdit);
 
   m_deliveryTimeEdit = new QLineEdit(this);
   m_deliveryTimeEdit->setPlaceholderText("e.g., 9:00 AM");
-  m_deliveryTimeEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   deliveryLayout->addRow("Departure Time:", m_deliveryTimeEdit);
 
   m_startMileageEdit = new QDoubleSpinBox(this);
@@ -144,7 +127,6 @@ void WorkOrderDialog::setupUI()
   m_startMileageEdit->setDecimals(1);
   m_startMileageEdit->setSuffix(" mi");
   m_startMileageEdit->setPrefix("Start: ");
-  m_startMileageEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   deliveryLayout->addRow("Starting Odometer:", m_startMileageEdit);
 
   m_endMileageEdit = new QDoubleSpinBox(this);
@@ -153,36 +135,49 @@ void WorkOrderDialog::setupUI()
   m_endMileageEdit->setSuffix(" mi");
   m_endMileageEdit->setPrefix("End: ");
   m_endMileageEdit->setEnabled(false);
-  m_endMileageEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   deliveryLayout->addRow("Ending Odometer:", m_endMileageEdit);
 
   mainLayout->addWidget(deliveryGroup);
 
   auto* paymentGroup = new QGroupBox(AdobeStyles::ICON_MONEY + " Payment Information", this);
-  paymentGroup->setStyleSheet(AdobeStyles::GROUP_BOX_SUCCESS);
+  AdobeStyles::setVariant(paymentGroup, "success");
   auto* paymentLayout = new QFormLayout(paymentGroup);
 
   m_paymentMethodCombo = new QComboBox(this);
   m_paymentMethodCombo->addItems({ "Cash", "Check", "Credit Card", "Work-for-Wood", "Voucher", "Free" });
-  m_paymentMethodCombo->setStyleSheet(AdobeStyles::COMBO_BOX);
   paymentLayout->addRow("Payment Method:", m_paymentMethodCombo);
 
   m_amountPaidEdit = new QDoubleSpinBox(this);
   m_amountPaidEdit->setRange(0.0, 99999.0);
   m_amountPaidEdit->setPrefix("$");
   m_amountPaidEdit->setSingleStep(1.0);
-  m_amountPaidEdit->setStyleSheet(AdobeStyles::LINE_EDIT);
   paymentLayout->addRow("Amount Paid:", m_amountPaidEdit);
 
+  auto* creditLayout = new QHBoxLayout();
+  m_creditLabel = new QLabel(this);
+  m_creditLabel->setWordWrap(true);
+  creditLayout->addWidget(m_creditLabel, 1);
+  m_applyCreditButton = new QPushButton("Use Credit", this);
+  m_applyCreditButton->setToolTip("Pay for this order with the client's Work-for-Wood credit");
+  AdobeStyles::setVariant(m_applyCreditButton, "secondary");
+  connect(m_applyCreditButton, &QPushButton::clicked, this, &WorkOrderDialog::onApplyCreditClicked);
+  creditLayout->addWidget(m_applyCreditButton);
+  paymentLayout->addRow("Work-for-Wood Credit:", creditLayout);
+
+  // The balance is read when the client changes; everything else only recomputes the preview
+  connect(m_clientCombo, &QComboBox::currentIndexChanged, this, &WorkOrderDialog::loadCredit);
+  connect(m_paymentMethodCombo, &QComboBox::currentTextChanged, this, &WorkOrderDialog::updateCreditPreview);
+  connect(m_requestedCordsEdit, &QDoubleSpinBox::valueChanged, this, &WorkOrderDialog::updateCreditPreview);
+  connect(m_deliveredCordsEdit, &QDoubleSpinBox::valueChanged, this, &WorkOrderDialog::updateCreditPreview);
+  loadCredit();
+
   mainLayout->addWidget(paymentGroup);
 
   auto* notesGroup = new QGroupBox("📝 Additional Notes", this);
-  notesGroup->setStyleSheet(AdobeStyles::GROUP_BOX);
   auto* notesLayout = new QVBoxLayout(notesGroup);
 
   m_notesEdit = new QTextEdit(this);
   m_notesEdit->setMaximumHeight(80);
-  m_notesEdit->setStyleSheet(AdobeStyles::TEXT_EDIT);
   notesLayout->addWidget(m_notesEdit);
 
   mainLayout->addWidget(notesGroup);
@@ -192,14 +187,14 @@ void WorkOrderDialog::setupUI()
 
   auto* saveButton = new QPushButton(AdobeStyles::ICON_SAVE + " Save Order", this);
   saveButton->setProperty("class", "primary");
-  saveButton->setStyleSheet(AdobeStyles::PRIMARY_BUTTON);
+  AdobeStyles::setVariant(saveButton, "primary");
   saveButton->setDefault(true);
   connect(saveButton, &QPushButton::clicked, this, &WorkOrderDialog::saveOrder);
   buttonLayout->addWidget(saveButton);
 
   auto* cancelButton = new QPushButton(AdobeStyles::ICON_ERROR + " Cancel", this);
   cancelButton->setProperty("class", "cancel");
-  cancelButton->setStyleSheet(AdobeStyles::CANCEL_BUTTON);
+  AdobeStyles::setVariant(cancelButton, "cancel");
   connect(cancelButton, &QPushButton::clicked, this, &QDialog::reject);
   buttonLayout->addWidget(cancelButton);
 
@@ -228,6 +223,51 @@ void WorkOrderDialog::onNewClientClicked()
   }
 }
 
+void WorkOrderDialog::loadCredit()
+{
+  m_creditBalance = 0;
+  m_orderCredit = 0;
+  if (m_clientCombo->currentIndex() != -1) {
+    QSqlDatabase db = QSqlDatabase::database();
+    const qint64 householdId = m_clientCombo->currentData().toLongLong();
+    m_creditBalance = firewood::db::creditBalance(db, householdId);
+    if (m_orderId > 0) {
+      m_orderCredit = firewood::db::creditPostedForOrder(db, householdId, m_orderId);
+    }
+  }
+  updateCreditPreview();
+}
+
+double WorkOrderDialog::creditAfterOrder() const
+{
+  // Open orders are previewed with the requested cords until some are delivered
+  const double cords = m_deliveredCordsEdit->value() > 0 ? m_deliveredCordsEdit->value()
+                                                         : m_requestedCordsEdit->value();
+  const bool workForWood = firewood::core::parsePaymentMethod(m_paymentMethodCombo->currentText())
+                           == firewood::core::PaymentMethod::WorkForWood;
+  return m_creditBalance - m_orderCredit - (workForWood ? cords : 0);
+}
+
+void WorkOrderDialog::updateCreditPreview()
+{
+  const bool workForWood = firewood::core::parsePaymentMethod(m_paymentMethodCombo->currentText())
+                           == firewood::core::PaymentMethod::WorkForWood;
+  QString text = QString("%1 cords available").arg(m_creditBalance - m_orderCredit, 0, 'f', 2);
+  if (workForWood) {
+    text += QString(", %1 after this order").arg(creditAfterOrder(), 0, 'f', 2);
+  }
+  m_creditLabel->setText(text);
+  AdobeStyles::setTone(m_creditLabel, workForWood && creditAfterOrder() < 0 ? "error" : "success");
+  m_applyCreditButton->setEnabled(!workForWood && m_creditBalance - m_orderCredit > 0);
+}
+
+void WorkOrderDialog::onApplyCreditClicked()
+{
+  // Redeemed by the ledger when the order is saved with delivered cords
+  m_paymentMethodCombo->setCurrentText(firewood::core::toString(firewood::core::PaymentMethod::WorkForWood));
+  m_amountPaidEdit->setValue(0);
+}
+
 void WorkOrderDialog::loadOrder()
 {
     if (m_orderId <= 0) {
@@ -287,7 +327,11 @@ void WorkOrderDialog::loadClients()
     
     QSqlDatabase db = QSqlDatabase::database();
     QSqlQuery query(db);
-    query.prepare("SELECT id, full_name FROM users WHERE user_type IN ('client', 'volunteer') ORDER BY full_name");
+    // Orders and the credit ledger are keyed on households.id, so each client is
+    // listed by its household; accounts without one cannot be ordered for
+    query.prepare("SELECT m.household_id, u.full_name FROM users u "
+                  "JOIN household_user_mapping m ON m.user_id = u.id "
+                  "WHERE u.user_type IN ('client', 'volunteer') ORDER BY u.full_name");
     
     if (!query.exec()) {
         qDebug() << "ERROR: Failed to load clients:" << query.lastError().text();
@@ -321,6 +365,16 @@ void WorkOrderDialog::saveOrder()
     QString deliveryAddress = m_deliveryAddressEdit->text();
     QString deliveryNotes = m_deliveryNotesEdit->toPlainText();
     QString notes = m_notesEdit->toPlainText();
+
+    if (firewood::core::parsePaymentMethod(paymentMethod) == firewood::core::PaymentMethod::WorkForWood
+        && creditAfterOrder() < 0) {
+        const auto answer = QMessageBox::question(this, "Work-for-Wood Credit",
+            QString("This order exceeds the client's Work-for-Wood credit by %1 cords.\n\nSave it anyway?")
+                .arg(-creditAfterOrder(), 0, 'f', 2));
+        if (answer != QMessageBox::Yes) {
+            return;
+        }
+    }
     
     QSqlDatabase db = QSqlDatabase::database();
     QSqlQuery query(db);
@@ -382,8 +436,8 @@ void WorkOrderDialog::saveOrder()
 void WorkOrderDialog::onStatusChanged(const QString &status)
 {
     // Enable/disable fields based on status
-    bool isCompleted = (status == "Completed");
-    bool isDelivered = (status == "Delivered" || status == "Completed");
+    bool isCompleted = firewood::core::parseOrderStatus(status) == firewood::core::OrderStatus::Completed;
+    bool isDelivered = isCompleted;
     
     m_deliveredCordsEdit->setEnabled(isDelivered);
     m_deliveryDateEdit->setEnabled(isDelivered);